@@ -20,6 +20,7 @@
 #ifndef _FASTDDS_ENTITY_HPP_
 #define _FASTDDS_ENTITY_HPP_
 
+#include <fastdds/dds/core/conditions/StatusCondition.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/rtps/common/InstanceHandle.h>
 #include <fastrtps/types/TypesBase.h>
@@ -45,6 +46,7 @@ public:
             const StatusMask& mask = StatusMask::all())
         : status_mask_(mask)
         , status_changes_(StatusMask::none())
+        , status_condition_(this)
         , enable_(false)
     {
     }
@@ -95,6 +97,15 @@ public:
         return status_changes_;
     }
 
+    /**
+     * @brief Allows access to the StatusCondition associated with the Entity
+     * @return Reference to the StatusCondition
+     */
+    RTPS_DllAPI StatusCondition& get_statuscondition()
+    {
+        return status_condition_;
+    }
+
     /**
      * @brief Retrieves the instance handler that represents the Entity
      * @return Reference to the InstanceHandle
@@ -131,12 +142,36 @@ protected:
         instance_handle_ = handle;
     }
 
+    /**
+     * @brief Updates the triggered state of some statuses, triggering the StatusCondition if needed.
+     * Calls for the same Entity should be serialized by the caller.
+     * @param status Statuses to update
+     * @param triggered Whether the statuses become triggered or not
+     */
+    void set_status_changes(
+            const StatusMask& status,
+            bool triggered)
+    {
+        if (triggered)
+        {
+            status_changes_ |= status;
+        }
+        else
+        {
+            status_changes_ &= ~status;
+        }
+        status_condition_.set_status_changes(status_changes_);
+    }
+
     //! StatusMask with relevant statuses set to 1
     StatusMask status_mask_;
 
     //! StatusMask with triggered statuses set to 1
     StatusMask status_changes_;
 
+    //! StatusCondition associated to the Entity
+    StatusCondition status_condition_;
+
     //! InstanceHandle associated to the Entity
     fastrtps::rtps::InstanceHandle_t instance_handle_;
 
@@ -0,0 +1,90 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Condition.hpp
+ *
+ */
+
+#ifndef _FASTDDS_CONDITION_HPP_
+#define _FASTDDS_CONDITION_HPP_
+
+#include <fastrtps/fastrtps_dll.h>
+
+#include <memory>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+namespace detail {
+
+class ConditionNotifier;
+
+} // namespace detail
+
+/**
+ * @brief The Condition class is the base class for all the conditions that may be attached to a WaitSet.
+ *
+ * A condition has a trigger value. Every time the trigger value of a condition may have changed to true,
+ * the WaitSets it is attached to are woken up, so they only need to check the conditions that were notified.
+ * A condition should be detached from all the WaitSets before being destroyed.
+ *
+ * @ingroup FASTDDS_MODULE
+ */
+class Condition
+{
+public:
+
+    /**
+     * @brief Retrieves the trigger_value of the Condition
+     * @return true if trigger_value is set to 'true', 'false' otherwise
+     */
+    RTPS_DllAPI virtual bool get_trigger_value() const = 0;
+
+    RTPS_DllAPI virtual ~Condition();
+
+protected:
+
+    RTPS_DllAPI Condition();
+
+    Condition(
+            const Condition&) = delete;
+
+    Condition& operator =(
+            const Condition&) = delete;
+
+    /**
+     * @brief Wakes up the WaitSets this condition is attached to, so they check its trigger value.
+     * Triggering a condition that is not attached to any WaitSet does not take any lock.
+     */
+    RTPS_DllAPI void notify();
+
+private:
+
+    friend class WaitSetImpl;
+
+    std::unique_ptr<detail::ConditionNotifier> notifier_;
+
+};
+
+//! Sequence of conditions, as returned by WaitSet operations
+using ConditionSeq = std::vector<Condition*>;
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_CONDITION_HPP_
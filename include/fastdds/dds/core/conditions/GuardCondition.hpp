@@ -0,0 +1,67 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GuardCondition.hpp
+ *
+ */
+
+#ifndef _FASTDDS_GUARD_CONDITION_HPP_
+#define _FASTDDS_GUARD_CONDITION_HPP_
+
+#include <fastdds/dds/core/conditions/Condition.hpp>
+#include <fastrtps/types/TypesBase.h>
+
+#include <atomic>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * @brief A GuardCondition is a Condition whose trigger value is completely under the control of the application.
+ * @ingroup FASTDDS_MODULE
+ */
+class GuardCondition : public Condition
+{
+public:
+
+    RTPS_DllAPI GuardCondition();
+
+    RTPS_DllAPI ~GuardCondition();
+
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Sets the trigger value of the GuardCondition.
+     * Setting it to true wakes up the WaitSets the condition is attached to.
+     * @param value New trigger value
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t set_trigger_value(
+            bool value);
+
+private:
+
+    std::atomic<bool> trigger_value_;
+
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_GUARD_CONDITION_HPP_
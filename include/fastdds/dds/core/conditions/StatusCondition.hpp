@@ -0,0 +1,98 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatusCondition.hpp
+ *
+ */
+
+#ifndef _FASTDDS_STATUS_CONDITION_HPP_
+#define _FASTDDS_STATUS_CONDITION_HPP_
+
+#include <fastdds/dds/core/conditions/Condition.hpp>
+#include <fastdds/dds/core/status/StatusMask.hpp>
+#include <fastrtps/types/TypesBase.h>
+
+#include <atomic>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class Entity;
+
+/**
+ * @brief A StatusCondition is a Condition associated with each Entity.
+ *
+ * Its trigger value is true when any of the enabled statuses has changed on the Entity since the application
+ * last read it.
+ * @ingroup FASTDDS_MODULE
+ */
+class StatusCondition : public Condition
+{
+public:
+
+    RTPS_DllAPI StatusCondition(
+            Entity* parent);
+
+    RTPS_DllAPI ~StatusCondition();
+
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Defines the list of communication statuses that are taken into account to determine the trigger value
+     * @param mask defines the mask for the status
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t set_enabled_statuses(
+            const StatusMask& mask);
+
+    /**
+     * @brief Retrieves the list of communication statuses that are taken into account to determine the trigger value
+     * @return Status set or default status if it has not been set
+     */
+    RTPS_DllAPI StatusMask get_enabled_statuses() const;
+
+    /**
+     * @brief Returns the Entity associated
+     * @return Entity
+     */
+    RTPS_DllAPI Entity* get_entity() const;
+
+private:
+
+    friend class Entity;
+
+    /**
+     * Called by the Entity when its set of triggered statuses changes.
+     * @param status_changes Triggered statuses of the Entity.
+     */
+    RTPS_DllAPI void set_status_changes(
+            const StatusMask& status_changes);
+
+    Entity* entity_;
+
+    std::atomic<unsigned long> enabled_statuses_;
+
+    std::atomic<unsigned long> status_changes_;
+
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_STATUS_CONDITION_HPP_
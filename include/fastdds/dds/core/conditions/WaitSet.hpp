@@ -0,0 +1,108 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSet.hpp
+ *
+ */
+
+#ifndef _FASTDDS_WAIT_SET_HPP_
+#define _FASTDDS_WAIT_SET_HPP_
+
+#include <fastdds/dds/core/conditions/Condition.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <memory>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class WaitSetImpl;
+
+/**
+ * @brief A WaitSet allows an application to wait until one or more of the attached Conditions has a trigger value
+ * of true or until a timeout expires.
+ *
+ * Conditions notify the WaitSet when their trigger value may have changed, so a wait only checks the conditions
+ * that were notified since the previous one and those that were active on it. This makes a single thread able to
+ * wait on a large number of conditions.
+ * @ingroup FASTDDS_MODULE
+ */
+class WaitSet
+{
+public:
+
+    RTPS_DllAPI WaitSet();
+
+    RTPS_DllAPI ~WaitSet();
+
+    WaitSet(
+            const WaitSet&) = delete;
+
+    WaitSet& operator =(
+            const WaitSet&) = delete;
+
+    /**
+     * @brief Attaches a Condition to the WaitSet.
+     * Attaching a condition that is already attached has no effect.
+     * @param cond Condition to attach
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t attach_condition(
+            Condition& cond);
+
+    /**
+     * @brief Detaches a Condition from the WaitSet.
+     * @param cond Condition to detach
+     * @return RETCODE_OK if detached, RETCODE_PRECONDITION_NOT_MET if the condition was not attached
+     */
+    RTPS_DllAPI ReturnCode_t detach_condition(
+            Condition& cond);
+
+    /**
+     * @brief Blocks the calling thread until at least one of the attached conditions has a trigger value of true,
+     * or until the timeout expires.
+     * Only one thread may be waiting on a WaitSet at a time.
+     * @param active_conditions Filled with the conditions whose trigger value is true
+     * @param timeout Maximum blocking time
+     * @return RETCODE_OK if some condition is active, RETCODE_TIMEOUT if the timeout expired, and
+     * RETCODE_PRECONDITION_NOT_MET if another thread is already waiting on the WaitSet
+     */
+    RTPS_DllAPI ReturnCode_t wait(
+            ConditionSeq& active_conditions,
+            const fastrtps::Duration_t& timeout) const;
+
+    /**
+     * @brief Retrieves the list of attached conditions
+     * @param attached_conditions Filled with the attached conditions
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t get_conditions(
+            ConditionSeq& attached_conditions) const;
+
+private:
+
+    std::unique_ptr<WaitSetImpl> impl_;
+
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_WAIT_SET_HPP_
@@ -2685,6 +2685,7 @@ public:
         : user_defined_id(-1)
         , entity_id(-1)
         , history_memory_policy(fastrtps::rtps::PREALLOCATED_MEMORY_MODE)
+        , data_sharing(false)
     {
     }
 
@@ -2698,7 +2699,9 @@ public:
                (this->remote_locator_list == b.remote_locator_list) &&
                (this->user_defined_id == b.user_defined_id) &&
                (this->entity_id == b.entity_id) &&
-               (this->history_memory_policy == b.history_memory_policy);
+               (this->history_memory_policy == b.history_memory_policy) &&
+               (this->data_sharing == b.data_sharing) &&
+               (this->data_sharing_listener_thread == b.data_sharing_listener_thread);
     }
 
     //!Unicast locator list
@@ -2718,6 +2721,15 @@ public:
 
     //!Underlying History memory policy. <br> By default, PREALLOCATED_MEMORY_MODE.
     fastrtps::rtps::MemoryManagementPolicy_t history_memory_policy;
+
+    /**
+     * Deliver samples through shared memory to the matched endpoints on the same host, when both ends enable it.
+     * Writers need a history with a maximum number of samples. <br> By default, false.
+     */
+    bool data_sharing;
+
+    //!Settings of the thread a DataReader uses to listen for data-sharing notifications.
+    rtps::ThreadSettings data_sharing_listener_thread;
 };
 
 //!Qos Policy to configure the limit of the writer resources
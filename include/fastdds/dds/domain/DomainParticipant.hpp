@@ -31,6 +31,7 @@
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/core/Entity.hpp>
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/statistics/EntityStatistics.hpp>
 
 #include <utility>
 
@@ -497,6 +498,16 @@ public:
     RTPS_DllAPI ReturnCode_t get_current_time(
             fastrtps::Time_t& current_time) const;
 
+    /**
+     * This operation retrieves the current value of the performance counters of the DomainParticipant and all
+     * its DataWriters and DataReaders, including the builtin ones.
+     * @param statistics Vector where a snapshot of the counters of each entity is returned
+     * @return RETCODE_OK, RETCODE_NOT_ENABLED if the participant is not enabled, or RETCODE_UNSUPPORTED if
+     * the library was built without FASTDDS_STATISTICS
+     */
+    RTPS_DllAPI ReturnCode_t get_statistics(
+            std::vector<statistics::EntityStatistics>& statistics) const;
+
     /**
      * This method gives access to a registered type based on its name.
      * @param type_name Name of the type
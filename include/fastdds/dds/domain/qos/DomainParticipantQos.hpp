@@ -22,6 +22,7 @@
 
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -59,6 +60,8 @@ public:
                (this->properties_ == b.properties()) &&
                (this->wire_protocol_ == b.wire_protocol()) &&
                (this->transport_ == b.transport()) &&
+               (this->timed_events_thread_ == b.timed_events_thread()) &&
+               (this->async_writer_thread_ == b.async_writer_thread()) &&
                (this->name_ == b.name());
     }
 
@@ -230,6 +233,62 @@ public:
         transport_ = transport;
     }
 
+    /**
+     * Getter for the settings of the thread running the timed events
+     * @return ThreadSettings reference
+     */
+    const rtps::ThreadSettings& timed_events_thread() const
+    {
+        return timed_events_thread_;
+    }
+
+    /**
+     * Getter for the settings of the thread running the timed events
+     * @return ThreadSettings reference
+     */
+    rtps::ThreadSettings& timed_events_thread()
+    {
+        return timed_events_thread_;
+    }
+
+    /**
+     * Setter for the settings of the thread running the timed events
+     * @param timed_events_thread ThreadSettings
+     */
+    void timed_events_thread(
+            const rtps::ThreadSettings& timed_events_thread)
+    {
+        timed_events_thread_ = timed_events_thread;
+    }
+
+    /**
+     * Getter for the settings of the thread sending the data of asynchronous writers
+     * @return ThreadSettings reference
+     */
+    const rtps::ThreadSettings& async_writer_thread() const
+    {
+        return async_writer_thread_;
+    }
+
+    /**
+     * Getter for the settings of the thread sending the data of asynchronous writers
+     * @return ThreadSettings reference
+     */
+    rtps::ThreadSettings& async_writer_thread()
+    {
+        return async_writer_thread_;
+    }
+
+    /**
+     * Setter for the settings of the thread sending the data of asynchronous writers
+     * @param async_writer_thread ThreadSettings
+     */
+    void async_writer_thread(
+            const rtps::ThreadSettings& async_writer_thread)
+    {
+        async_writer_thread_ = async_writer_thread;
+    }
+
     /**
      * Getter for the Participant name
      * @return name
@@ -278,6 +337,12 @@ private:
     //!Transport options
     TransportConfigQos transport_;
 
+    //!Settings of the thread running the timed events
+    rtps::ThreadSettings timed_events_thread_;
+
+    //!Settings of the thread sending the data of asynchronous writers
+    rtps::ThreadSettings async_writer_thread_;
+
     //!Name of the participant.
     fastrtps::string_255 name_ = "RTPSParticipant";
 
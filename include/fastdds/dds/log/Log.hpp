@@ -18,6 +18,8 @@
 
 #include <fastrtps/utils/DBQueue.h>
 #include <fastrtps/fastrtps_dll.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastrtps/utils/thread.hpp>
 #include <thread>
 #include <sstream>
 #include <atomic>
@@ -122,6 +124,10 @@ public:
     //! Stops the logging thread. It will re-launch on the next call to a successful log macro.
     RTPS_DllAPI static void KillThread();
 
+    //! Sets the settings of the logging thread. They are applied the next time the thread is launched.
+    RTPS_DllAPI static void SetThreadSettings(
+            const rtps::ThreadSettings&);
+
     // Note: In VS2013, if you're linking this class statically, you will have to call KillThread before leaving
     // main, due to an unsolved MSVC bug.
 
@@ -158,7 +164,8 @@ private:
     {
         fastrtps::DBQueue<Entry> logs;
         std::vector<std::unique_ptr<LogConsumer> > consumers;
-        std::unique_ptr<std::thread> logging_thread;
+        std::unique_ptr<eprosima::thread> logging_thread;
+        rtps::ThreadSettings thread_settings;
 
         // Condition variable segment.
         std::condition_variable cv;
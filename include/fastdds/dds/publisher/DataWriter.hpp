@@ -121,6 +121,10 @@ public:
      * The special value HANDLE_NIL can be used for the parameter handle.This indicates that the identity of the
      * instance should be automatically deduced from the instance_data (by means of the key).
      *
+     * On release builds, a handle of an instance currently registered on this DataWriter is used as is, without
+     * computing the key of the data again. The application is responsible for passing the handle of the instance
+     * the data belongs to. Debug builds always check it.
+     *
      * @param data Pointer to the data
      * @param handle InstanceHandle_t.
      * @return RETCODE_PRECONDITION_NOT_MET if the handle introduced does not match with the one associated to the data,
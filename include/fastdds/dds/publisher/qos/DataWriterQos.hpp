@@ -109,7 +109,8 @@ public:
                (this->reliable_writer_qos_ == b.reliable_writer_qos()) &&
                (this->endpoint_ == b.endpoint()) &&
                (this->writer_resource_limits_ == b.writer_resource_limits()) &&
-               (this->throughput_controller_ == b.throughput_controller());
+               (this->throughput_controller_ == b.throughput_controller()) &&
+               (this->batching_ == b.batching());
     }
 
     RTPS_DllAPI WriterQos get_writerqos(
@@ -732,6 +733,34 @@ public:
         throughput_controller_ = throughput_controller;
     }
 
+    /**
+     * Getter for BatchingAttributes
+     * @return BatchingAttributes reference
+     */
+    RTPS_DllAPI fastrtps::rtps::BatchingAttributes& batching()
+    {
+        return batching_;
+    }
+
+    /**
+     * Getter for BatchingAttributes
+     * @return BatchingAttributes reference
+     */
+    RTPS_DllAPI const fastrtps::rtps::BatchingAttributes& batching() const
+    {
+        return batching_;
+    }
+
+    /**
+     * Setter for BatchingAttributes
+     * @param batching new value for the BatchingAttributes
+     */
+    RTPS_DllAPI void batching(
+            const fastrtps::rtps::BatchingAttributes& batching)
+    {
+        batching_ = batching;
+    }
+
 private:
 
     //!Durability Qos, implemented in the library.
@@ -799,6 +828,9 @@ private:
 
     //!Throughput controller
     fastrtps::rtps::ThroughputControllerDescriptor throughput_controller_;
+
+    //!Coalescing of samples on synchronous writers
+    fastrtps::rtps::BatchingAttributes batching_;
 };
 
 RTPS_DllAPI extern const DataWriterQos DATAWRITER_QOS_DEFAULT;
@@ -26,6 +26,7 @@
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
 #include <fastdds/dds/core/Entity.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastrtps/types/TypesBase.h>
 
 
@@ -64,7 +65,9 @@ class DataReaderListener;
 class TypeSupport;
 class DataReaderQos;
 class TopicDescription;
+class ReadCondition;
 struct LivelinessChangedStatus;
+struct SubscriptionMatchedStatus;
 struct SampleInfo;
 
 /**
@@ -225,6 +228,14 @@ public:
     RTPS_DllAPI ReturnCode_t get_requested_incompatible_qos_status(
             RequestedIncompatibleQosStatus& status);
 
+    /**
+     * @brief Get the subscription matched status. The status is considered read, so the changes are reset.
+     * @param[out] status Subscription matched status
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t get_subscription_matched_status(
+            SubscriptionMatchedStatus& status);
+
     /**
      * @brief Setter for the DataReaderQos
      * @param qos new value for the DataReaderQos
@@ -306,6 +317,29 @@ public:
      */
     RTPS_DllAPI const Subscriber* get_subscriber() const;
 
+    /**
+     * @brief Creates a ReadCondition, whose trigger value is true while the DataReader has samples matching the
+     * given masks. Only the sample state is currently taken into account.
+     * @param sample_states Sample states of the samples that trigger the condition
+     * @param view_states View states of the samples that trigger the condition
+     * @param instance_states Instance states of the samples that trigger the condition
+     * @return Pointer to the created ReadCondition
+     */
+    RTPS_DllAPI ReadCondition* create_readcondition(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    /**
+     * @brief Deletes a ReadCondition created by this DataReader.
+     * The condition should be detached from all the WaitSets before deleting it.
+     * @param a_condition ReadCondition to delete
+     * @return RETCODE_OK if deleted, RETCODE_PRECONDITION_NOT_MET if the condition was not created by this
+     * DataReader or it is still attached to a WaitSet
+     */
+    RTPS_DllAPI ReturnCode_t delete_readcondition(
+            ReadCondition* a_condition);
+
     /* TODO
        RTPS_DllAPI bool wait_for_historical_data(
             const fastrtps::Duration_t& max_wait) const;
@@ -0,0 +1,99 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadCondition.hpp
+ *
+ */
+
+#ifndef _FASTDDS_READ_CONDITION_HPP_
+#define _FASTDDS_READ_CONDITION_HPP_
+
+#include <fastdds/dds/core/conditions/Condition.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataReader;
+class DataReaderImpl;
+
+/**
+ * @brief A ReadCondition is a Condition created by a DataReader, whose trigger value is true when the DataReader
+ * has samples matching its sample, view and instance state masks.
+ *
+ * Create it with DataReader::create_readcondition and delete it with DataReader::delete_readcondition.
+ * @ingroup FASTDDS_MODULE
+ */
+class ReadCondition : public Condition
+{
+    friend class DataReaderImpl;
+
+public:
+
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Returns the DataReader associated with the ReadCondition
+     * @return Pointer to the DataReader
+     */
+    RTPS_DllAPI DataReader* get_datareader() const;
+
+    /**
+     * @brief Returns the set of sample states taken into account to determine the trigger value
+     * @return The sample state mask
+     */
+    RTPS_DllAPI SampleStateMask get_sample_state_mask() const;
+
+    /**
+     * @brief Returns the set of view states taken into account to determine the trigger value
+     * @return The view state mask
+     */
+    RTPS_DllAPI ViewStateMask get_view_state_mask() const;
+
+    /**
+     * @brief Returns the set of instance states taken into account to determine the trigger value
+     * @return The instance state mask
+     */
+    RTPS_DllAPI InstanceStateMask get_instance_state_mask() const;
+
+protected:
+
+    ReadCondition(
+            DataReaderImpl* impl,
+            DataReader* reader,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    ~ReadCondition();
+
+    DataReaderImpl* impl_;
+
+    DataReader* reader_;
+
+    SampleStateMask sample_states_;
+
+    ViewStateMask view_states_;
+
+    InstanceStateMask instance_states_;
+
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_READ_CONDITION_HPP_
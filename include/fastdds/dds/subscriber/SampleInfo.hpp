@@ -50,6 +50,28 @@ enum InstanceStateKind
     NOT_ALIVE_NO_WRITERS
 };
 
+//! Set of SampleStateKind values, used to select samples
+using SampleStateMask = uint16_t;
+//! Set of ViewStateKind values, used to select samples
+using ViewStateMask = uint16_t;
+//! Set of InstanceStateKind values, used to select samples
+using InstanceStateMask = uint16_t;
+
+constexpr SampleStateMask READ_SAMPLE_STATE = 0x0001 << READ;
+constexpr SampleStateMask NOT_READ_SAMPLE_STATE = 0x0001 << NOT_READ;
+constexpr SampleStateMask ANY_SAMPLE_STATE = 0xffff;
+
+constexpr ViewStateMask NEW_VIEW_STATE = 0x0001 << NEW;
+constexpr ViewStateMask NOT_NEW_VIEW_STATE = 0x0001 << NOT_NEW;
+constexpr ViewStateMask ANY_VIEW_STATE = 0xffff;
+
+constexpr InstanceStateMask ALIVE_INSTANCE_STATE = 0x0001 << ALIVE;
+constexpr InstanceStateMask NOT_ALIVE_DISPOSED_INSTANCE_STATE = 0x0001 << NOT_ALIVE_DISPOSED;
+constexpr InstanceStateMask NOT_ALIVE_NO_WRITERS_INSTANCE_STATE = 0x0001 << NOT_ALIVE_NO_WRITERS;
+constexpr InstanceStateMask NOT_ALIVE_INSTANCE_STATE =
+        NOT_ALIVE_DISPOSED_INSTANCE_STATE | NOT_ALIVE_NO_WRITERS_INSTANCE_STATE;
+constexpr InstanceStateMask ANY_INSTANCE_STATE = 0xffff;
+
 /*!
  * @brief SampleInfo is the information that accompanies each sample that is ‘read’ or ‘taken.’
  */
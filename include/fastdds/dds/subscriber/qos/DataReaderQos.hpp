@@ -109,6 +109,51 @@ public:
     fastrtps::ResourceLimitedContainerConfig matched_publisher_allocation;
 };
 
+//! Qos Policy to configure the threads that call the DataReaderListener when new data is available
+class DeliveryExecutorQos
+{
+public:
+
+    /**
+     * @brief Constructor
+     */
+    RTPS_DllAPI DeliveryExecutorQos()
+    {
+    }
+
+    /**
+     * @brief Destructor
+     */
+    virtual RTPS_DllAPI ~DeliveryExecutorQos() = default;
+
+    bool operator ==(
+            const DeliveryExecutorQos& b) const
+    {
+        return (this->thread_count == b.thread_count) &&
+               (this->queue_capacity == b.queue_capacity) &&
+               (this->thread_settings == b.thread_settings);
+    }
+
+    inline void clear()
+    {
+        DeliveryExecutorQos reset = DeliveryExecutorQos();
+        std::swap(*this, reset);
+    }
+
+    /**
+     * Number of threads dedicated to call on_data_available / on_data_on_readers.
+     * When 0, listeners are called from the thread receiving the data.
+     * With more than one thread, the listener may be called concurrently.
+     */
+    uint32_t thread_count = 0;
+
+    //! Maximum number of pending notifications kept on the lock-free queue. Rounded up to a power of two.
+    uint32_t queue_capacity = 256;
+
+    //! Settings of the delivery threads
+    rtps::ThreadSettings thread_settings;
+};
+
 //! Qos Policy to configure the XTypes Qos associated to the DataReader
 class TypeConsistencyQos : public QosPolicy
 {
@@ -189,7 +234,8 @@ public:
                (expects_inline_qos_ == b.expects_inline_qos()) &&
                (properties_ == b.properties()) &&
                (endpoint_ == b.endpoint()) &&
-               (reader_resource_limits_ == b.reader_resource_limits());
+               (reader_resource_limits_ == b.reader_resource_limits()) &&
+               (delivery_executor_ == b.delivery_executor());
     }
 
     RTPS_DllAPI ReaderQos get_readerqos(
@@ -746,6 +792,34 @@ public:
         reader_resource_limits_ = new_value;
     }
 
+    /**
+     * Getter for DeliveryExecutorQos
+     * @return DeliveryExecutorQos reference
+     */
+    RTPS_DllAPI DeliveryExecutorQos& delivery_executor()
+    {
+        return delivery_executor_;
+    }
+
+    /**
+     * Getter for DeliveryExecutorQos
+     * @return DeliveryExecutorQos const reference
+     */
+    RTPS_DllAPI const DeliveryExecutorQos& delivery_executor() const
+    {
+        return delivery_executor_;
+    }
+
+    /**
+     * Setter for DeliveryExecutorQos
+     * @param new_value new value for the DeliveryExecutorQos
+     */
+    RTPS_DllAPI void delivery_executor(
+            const DeliveryExecutorQos& new_value)
+    {
+        delivery_executor_ = new_value;
+    }
+
 private:
 
     //!Durability Qos, implemented in the library.
@@ -808,6 +882,9 @@ private:
 
     //!ReaderResourceLimitsQos
     ReaderResourceLimitsQos reader_resource_limits_;
+
+    //!DeliveryExecutorQos (Extension).
+    DeliveryExecutorQos delivery_executor_;
 };
 
 RTPS_DllAPI extern const DataReaderQos DATAREADER_QOS_DEFAULT;
@@ -26,6 +26,15 @@
 #include <fastrtps/utils/TimedMutex.hpp>
 
 namespace eprosima {
+
+#if HAVE_FASTDDS_STATISTICS
+namespace fastdds {
+namespace statistics {
+class EntityStatisticsCounters;
+} // namespace statistics
+} // namespace fastdds
+#endif
+
 namespace fastrtps{
 namespace rtps {
 
@@ -84,6 +93,14 @@ class Endpoint
     bool supports_rtps_protection() { return supports_rtps_protection_; }
 #endif
 
+#if HAVE_FASTDDS_STATISTICS
+    /**
+     * Get the performance counters of this endpoint
+     * @return Pointer to the counters, or nullptr if they are not being collected
+     */
+    fastdds::statistics::EntityStatisticsCounters* statistics() const { return statistics_; }
+#endif
+
     protected:
 
     //!Pointer to the RTPSParticipant containing this endpoint.
@@ -98,6 +115,11 @@ class Endpoint
     //!Endpoint Mutex
     mutable RecursiveTimedMutex mp_mutex;
 
+#if HAVE_FASTDDS_STATISTICS
+    //!Performance counters, owned by the statistics registry of the participant
+    fastdds::statistics::EntityStatisticsCounters* statistics_ = nullptr;
+#endif
+
     private:
 
     Endpoint& operator=(const Endpoint&) = delete;
@@ -22,6 +22,7 @@
 #include <fastdds/rtps/common/Types.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
 namespace eprosima {
@@ -62,12 +63,19 @@ class EndpointAttributes
         //!Properties
         PropertyPolicy properties;
 
+        //!Use data-sharing with the matched endpoints on the same host, default value false
+        bool data_sharing;
+
+        //!Settings of the thread a reader uses to listen for data-sharing notifications
+        fastdds::rtps::ThreadSettings data_sharing_listener_thread;
+
         EndpointAttributes()
             : endpointKind(WRITER)
             , topicKind(NO_KEY)
             , reliabilityKind(BEST_EFFORT)
             , durabilityKind(VOLATILE)
             , persistence_guid()
+            , data_sharing(false)
             , m_userDefinedID(-1)
             , m_entityID(-1)
         {
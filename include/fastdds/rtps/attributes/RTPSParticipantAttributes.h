@@ -29,6 +29,7 @@
 #include <fastrtps/utils/fixed_size_string.hpp>
 #include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
 #include <fastdds/rtps/attributes/ServerAttributes.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
 #include <memory>
 #include <sstream>
@@ -324,6 +325,13 @@ public:
     //!Set to true to avoid multicast traffic on builtin endpoints
     bool avoid_builtin_multicast = true;
 
+    /**
+     * Set to true to allocate the discovery proxies and the caches of the builtin histories when they are first
+     * needed, instead of preallocating them when the participant is created.
+     * Reduces the startup time of the participant at the cost of allocations during discovery.
+     */
+    bool lazy_builtin_allocation = false;
+
     BuiltinAttributes() = default;
 
     virtual ~BuiltinAttributes() = default;
@@ -343,7 +351,8 @@ public:
                (this->writerHistoryMemoryPolicy == b.writerHistoryMemoryPolicy) &&
                (this->writerPayloadSize == b.writerPayloadSize) &&
                (this->mutation_tries == b.mutation_tries) &&
-               (this->avoid_builtin_multicast == b.avoid_builtin_multicast);
+               (this->avoid_builtin_multicast == b.avoid_builtin_multicast) &&
+               (this->lazy_builtin_allocation == b.lazy_builtin_allocation);
     }
 
 };
@@ -383,6 +392,8 @@ public:
                (this->participantID == b.participantID) &&
                (this->throughputController == b.throughputController) &&
                (this->useBuiltinTransports == b.useBuiltinTransports) &&
+               (this->timed_events_thread == b.timed_events_thread) &&
+               (this->async_writer_thread == b.async_writer_thread) &&
                (this->properties == b.properties &&
                (this->prefix == b.prefix));
     }
@@ -445,6 +456,12 @@ public:
     //! Property policies
     PropertyPolicy properties;
 
+    //! Settings of the thread running the timed events of the participant
+    fastdds::rtps::ThreadSettings timed_events_thread;
+
+    //! Settings of the thread sending the data of the asynchronous writers of the participant
+    fastdds::rtps::ThreadSettings async_writer_thread;
+
     //!Set the name of the participant.
     inline void setName(
             const char* nam)
@@ -74,6 +74,7 @@ public:
         , liveliness_lease_duration(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
         , expectsInlineQos(false)
         , disable_positive_acks(false)
+        , fragment_reassembly_max_bytes(0)
     {
         endpoint.endpointKind = READER;
         endpoint.durabilityKind = VOLATILE;
@@ -102,6 +103,10 @@ public:
 
     //! Define the allocation behaviour for matched-writer-dependent collections.
     ResourceLimitedContainerConfig matched_writers_allocation;
+
+    //! Maximum number of payload bytes held by partially received fragmented samples (only for stateful readers).
+    //! Least recently updated samples are discarded when exceeded. 0 means no limit.
+    uint32_t fragment_reassembly_max_bytes;
 };
 
 } /* namespace rtps */
@@ -0,0 +1,84 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadSettings.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_THREADSETTINGS_HPP_
+#define _FASTDDS_RTPS_THREADSETTINGS_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * @brief Settings applied to an internal thread when it is started.
+ *
+ * Every setting left to its default value is not applied, so the thread keeps the one inherited from the thread
+ * creating it. Settings that cannot be applied are reported with a warning and ignored.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct ThreadSettings
+{
+    bool operator ==(
+            const ThreadSettings& b) const
+    {
+        return (this->scheduling_policy == b.scheduling_policy) &&
+               (this->priority == b.priority) &&
+               (this->affinity == b.affinity) &&
+               (this->stack_size == b.stack_size);
+    }
+
+    bool operator !=(
+            const ThreadSettings& b) const
+    {
+        return !(*this == b);
+    }
+
+    /**
+     * Scheduling policy of the thread (SCHED_OTHER, SCHED_FIFO, SCHED_RR...). Ignored on Windows.
+     * Default -1, which keeps the default policy.
+     */
+    int32_t scheduling_policy = -1;
+
+    /**
+     * Priority of the thread. On POSIX systems it is interpreted according to the scheduling policy.
+     * On Windows it is passed to SetThreadPriority.
+     * Default std::numeric_limits<int32_t>::min(), which keeps the default priority.
+     */
+    int32_t priority = (std::numeric_limits<int32_t>::min)();
+
+    /**
+     * Mask of the CPUs the thread is allowed to run on. Bit n stands for CPU n.
+     * With the default memory policy, buffers allocated by the thread end up on the NUMA node of these CPUs.
+     * Default 0, which keeps the default affinity.
+     */
+    uint64_t affinity = 0;
+
+    /**
+     * Stack size of the thread, in bytes. Ignored on Windows.
+     * Default -1, which keeps the default stack size.
+     */
+    int32_t stack_size = -1;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_THREADSETTINGS_HPP_
@@ -80,6 +80,84 @@ struct WriterTimes
 
 };
 
+/**
+ * Struct AdaptiveReliabilityAttributes, defining how a reliable writer adapts its repair traffic to the load.
+ *
+ * When enabled, the heartbeat period gets shorter as the number of unacknowledged changes grows, and the response
+ * to NACKs is delayed while NACKs from other readers keep arriving, so lost changes are repaired once for all of
+ * them (using multicast when the readers share a multicast locator).
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct AdaptiveReliabilityAttributes
+{
+    //! Whether adaptive reliability is enabled, default value false.
+    bool enabled;
+    //! Heartbeat period used when the unacknowledged backlog reaches backlog_threshold, default value 100ms.
+    Duration_t min_heartbeat_period;
+    //! Number of unacknowledged changes at which min_heartbeat_period is used, default value 64.
+    uint32_t backlog_threshold;
+    //! Maximum time the response to a NACK is delayed to aggregate NACKs from other readers, default value 50ms.
+    Duration_t max_nack_aggregation;
+
+    AdaptiveReliabilityAttributes()
+        : enabled(false)
+        , min_heartbeat_period(0, 100 * 1000 * 1000)
+        , backlog_threshold(64)
+        , max_nack_aggregation(0, 50 * 1000 * 1000)
+    {
+    }
+
+    bool operator ==(
+            const AdaptiveReliabilityAttributes& b) const
+    {
+        return (this->enabled == b.enabled) &&
+               (this->min_heartbeat_period == b.min_heartbeat_period) &&
+               (this->backlog_threshold == b.backlog_threshold) &&
+               (this->max_nack_aggregation == b.max_nack_aggregation);
+    }
+
+};
+
+/**
+ * Struct BatchingAttributes, defining how a writer coalesces samples before sending them.
+ *
+ * When enabled, written samples are kept until one of the limits is reached and then sent together, so many DATA
+ * submessages share the same RTPS message, heartbeat and send operation.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct BatchingAttributes
+{
+    //! Whether batching is enabled, default value false.
+    bool enabled;
+    //! Number of samples that triggers the sending of the batch (0 means no limit), default value 64.
+    uint32_t max_samples;
+    /**
+     * Payload bytes that trigger the sending of the batch, default value 8192.
+     * Limited to RTPSMessageGroup::get_max_fragment_payload_size() (about 64KB), which is also used when it is 0.
+     */
+    uint32_t max_bytes;
+    //! Maximum time a sample is kept on the batch (infinite means no limit), default value 1ms.
+    Duration_t max_flush_delay;
+
+    BatchingAttributes()
+        : enabled(false)
+        , max_samples(64)
+        , max_bytes(8192)
+        , max_flush_delay(0, 1000 * 1000)
+    {
+    }
+
+    bool operator ==(
+            const BatchingAttributes& b) const
+    {
+        return (this->enabled == b.enabled) &&
+               (this->max_samples == b.max_samples) &&
+               (this->max_bytes == b.max_bytes) &&
+               (this->max_flush_delay == b.max_flush_delay);
+    }
+
+};
+
 /**
  * Class WriterAttributes, defining the attributes of a RTPSWriter.
  * @ingroup RTPS_ATTRIBUTES_MODULE
@@ -138,6 +216,12 @@ public:
 
     //! Keep duration to keep a sample before considering it has been acked
     Duration_t keep_duration;
+
+    //! Adaptive heartbeat and NACK response behaviour (only used for RELIABLE).
+    AdaptiveReliabilityAttributes adaptive_reliability;
+
+    //! Coalescing of samples before sending them.
+    BatchingAttributes batching;
 };
 
 } /* namespace rtps */
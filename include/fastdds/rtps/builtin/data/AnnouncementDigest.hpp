@@ -0,0 +1,97 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AnnouncementDigest.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_BUILTIN_DATA_ANNOUNCEMENTDIGEST_HPP_
+#define _FASTDDS_RTPS_BUILTIN_DATA_ANNOUNCEMENTDIGEST_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Digest of the last SPDP announcement parsed for a participant.
+ * Used to detect periodic announcements identical to the previous one, which do not need to be parsed again.
+ * @ingroup BUILTIN_MODULE
+ */
+class AnnouncementDigest
+{
+public:
+
+    //! Construct an empty digest, which does not match any announcement.
+    AnnouncementDigest() = default;
+
+    /**
+     * Compute the digest of an announcement.
+     * @param payload Serialized announcement.
+     */
+    explicit AnnouncementDigest(
+            const SerializedPayload_t& payload)
+        : hash_(hash(payload))
+        , length_(payload.length)
+    {
+    }
+
+    /**
+     * Check whether two digests come from the same announcement.
+     * @param other Digest to compare with.
+     * @return true if neither digest is empty and they have the same length and hash.
+     */
+    bool matches(
+            const AnnouncementDigest& other) const
+    {
+        return (length_ != 0) && (length_ == other.length_) && (hash_ == other.hash_);
+    }
+
+    //! Empty the digest, so it does not match any announcement.
+    void clear()
+    {
+        hash_ = 0;
+        length_ = 0;
+    }
+
+private:
+
+    static uint64_t hash(
+            const SerializedPayload_t& payload)
+    {
+        // FNV-1a
+        uint64_t ret_val = 14695981039346656037ULL;
+        for (uint32_t i = 0; i < payload.length; ++i)
+        {
+            ret_val ^= payload.data[i];
+            ret_val *= 1099511628211ULL;
+        }
+        return ret_val;
+    }
+
+    uint64_t hash_ = 0;
+    uint32_t length_ = 0;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_BUILTIN_DATA_ANNOUNCEMENTDIGEST_HPP_
@@ -26,6 +26,7 @@
 #include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/builtin/data/AnnouncementDigest.hpp>
 #include <fastdds/rtps/common/Token.h>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 
@@ -141,6 +142,8 @@ public:
     ProxyHashTable<ReaderProxyData>* m_readers = nullptr;
     //!
     ProxyHashTable<WriterProxyData>* m_writers = nullptr;
+    //!Digest of the last SPDP announcement parsed for this participant
+    AnnouncementDigest announcement_digest;
 
     /**
      * Update the data.
@@ -49,6 +49,7 @@ class TimedEvent;
 class ReaderProxyData;
 class WriterProxyData;
 class ParticipantProxyData;
+class ParticipantProxyHashTable;
 class ReaderListener;
 class PDPListener;
 class PDPServerListener;
@@ -322,6 +323,8 @@ protected:
     size_t participant_proxies_number_;
     //!Registered RTPSParticipants (including the local one, that is the first one.)
     ResourceLimitedVector<ParticipantProxyData*> participant_proxies_;
+    //!Registered RTPSParticipants indexed by GUID prefix
+    ParticipantProxyHashTable* participant_proxies_index_;
     //!Pool of participant proxy data objects ready for reuse
     ResourceLimitedVector<ParticipantProxyData*> participant_proxies_pool_;
     //!Number of reader proxy data objects created
@@ -364,6 +367,17 @@ protected:
             const GUID_t& participant_guid,
             bool with_lease_duration);
 
+    /**
+     * Gets the proxy object of a registered participant.
+     * Should be called with the PDP mutex taken.
+     *
+     * @param guid_prefix GUID prefix of the participant to look for.
+     *
+     * @return pointer to the proxy object, nullptr when not found.
+     */
+    ParticipantProxyData* find_participant_proxy_data(
+            const GuidPrefix_t& guid_prefix) const;
+
     /**
      * Gets the key of a participant proxy data.
      *
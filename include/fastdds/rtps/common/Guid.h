@@ -268,4 +268,20 @@ inline std::istream& operator >>(
 } // namespace fastrtps
 } // namespace eprosima
 
+namespace std {
+template <>
+struct hash<eprosima::fastrtps::rtps::GUID_t>
+{
+    std::size_t operator()(
+            const eprosima::fastrtps::rtps::GUID_t& k) const
+    {
+        std::size_t ret_val = hash<eprosima::fastrtps::rtps::GuidPrefix_t>()(k.guidPrefix);
+        return ret_val ^ (hash<eprosima::fastrtps::rtps::EntityId_t>()(k.entityId) + 0x9e3779b9 +
+               (ret_val << 6) + (ret_val >> 2));
+    }
+
+};
+
+} // namespace std
+
 #endif /* _FASTDDS_RTPS_RTPS_GUID_H_ */
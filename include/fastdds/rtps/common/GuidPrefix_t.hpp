@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <sstream>
 
 namespace eprosima {
@@ -139,4 +140,25 @@ inline std::istream& operator >>(
 } // namespace fastrtps
 } // namespace eprosima
 
+namespace std {
+template <>
+struct hash<eprosima::fastrtps::rtps::GuidPrefix_t>
+{
+    std::size_t operator()(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& k) const
+    {
+        // FNV-1a over the 12 octets of the prefix
+        uint64_t ret_val = 14695981039346656037ULL;
+        for (uint8_t i = 0; i < eprosima::fastrtps::rtps::GuidPrefix_t::size; ++i)
+        {
+            ret_val ^= k.value[i];
+            ret_val *= 1099511628211ULL;
+        }
+        return static_cast<std::size_t>(ret_val);
+    }
+
+};
+
+} // namespace std
+
 #endif /* _FASTDDS_RTPS_COMMON_GUIDPREFIX_T_HPP_ */
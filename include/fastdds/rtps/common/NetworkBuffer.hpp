@@ -0,0 +1,91 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file NetworkBuffer.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+#define _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+
+#include <fastdds/rtps/common/Types.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * A slice of memory to be sent through the network.
+ * A message is described by a list of buffers that are sent consecutively (gather list), so parts of it, like
+ * serialized payloads, can be referenced instead of copied into the message.
+ * @ingroup COMMON_MODULE
+ */
+struct NetworkBuffer
+{
+    //! Pointer to the start of the slice
+    const octet* buffer;
+
+    //! Number of bytes of the slice
+    uint32_t size;
+
+    NetworkBuffer()
+        : buffer(nullptr)
+        , size(0)
+    {
+    }
+
+    NetworkBuffer(
+            const octet* buf,
+            uint32_t len)
+        : buffer(buf)
+        , size(len)
+    {
+    }
+
+};
+
+//! Maximum number of buffers on a gather list
+constexpr size_t max_network_buffers = 64;
+
+/**
+ * Copy a gather list into a contiguous destination.
+ * @param buffers  Gather list to copy.
+ * @param count    Number of buffers on the gather list.
+ * @param dest     Destination, which should have room for the sum of the sizes of the buffers.
+ *                 Buffers already pointing to their position on dest are not copied.
+ */
+inline void copy_network_buffers(
+        const NetworkBuffer* buffers,
+        size_t count,
+        octet* dest)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (buffers[i].buffer != dest)
+        {
+            memcpy(dest, buffers[i].buffer, buffers[i].size);
+        }
+        dest += buffers[i].size;
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_ */
@@ -43,6 +43,22 @@ struct CacheChange_t;
  */
 class CacheChangePool {
     public:
+
+        //!Occupancy of one of the payload size classes used on DYNAMIC_SLAB_MEMORY_MODE.
+        struct SizeClassStatistics
+        {
+            //!Payload size of the CacheChanges on this class.
+            uint32_t payload_size = 0;
+            //!Number of CacheChanges currently reserved.
+            uint32_t in_use = 0;
+            //!Number of released CacheChanges kept for reuse.
+            uint32_t free = 0;
+            //!Maximum number of CacheChanges reserved at the same time.
+            uint32_t peak_in_use = 0;
+            //!Number of CacheChanges given back to the system because the class was over its high-water mark.
+            uint64_t trimmed = 0;
+        };
+
         virtual ~CacheChangePool();
         /**
          * Constructor.
@@ -50,6 +66,8 @@ class CacheChangePool {
          * @param payload_size The initial payload size associated with the pool.
          * @param max_pool_size Maximum payload size. If set to 0 the pool will keep reserving until something breaks.
          * @param memoryPolicy Memory management policy.
+         * On DYNAMIC_SLAB_MEMORY_MODE, pool_size is used as the high-water mark of free CacheChanges kept on each
+         * payload size class.
          */
         CacheChangePool(int32_t pool_size, uint32_t payload_size, int32_t max_pool_size, MemoryManagementPolicy_t memoryPolicy);
 
@@ -77,12 +95,32 @@ class CacheChangePool {
         //!Get the size of the cache vector; all of them (reserved and not reserved).
         size_t get_allCachesSize(){return m_allCaches.size();}
         //!Get the number of frre caches.
-        size_t get_freeCachesSize(){return m_freeCaches.size();}
+        size_t get_freeCachesSize(){return memoryMode == DYNAMIC_SLAB_MEMORY_MODE ? m_slab_free_count : m_freeCaches.size();}
         //!Get the initial payload size associated with the Pool.
         inline uint32_t getInitialPayloadSize(){return m_initial_payload_size;};
+        //!Get the occupancy of the payload size classes. Only used on DYNAMIC_SLAB_MEMORY_MODE.
+        std::vector<SizeClassStatistics> get_size_class_statistics() const;
+        //!Give back to the system all the free caches of the payload size classes. Only used on DYNAMIC_SLAB_MEMORY_MODE.
+        void trim();
     private:
+
+        struct SlabChange;
+        struct SizeClass;
+
+        //! Returns the size class whose payload size is the smallest one able to hold data_size bytes.
+        static uint32_t size_class_for_reserve(uint32_t data_size);
+        //! Returns the biggest size class whose payload size fits in a payload of max_size bytes.
+        static uint32_t size_class_for_release(uint32_t max_size);
+
+        bool reserve_from_slab(CacheChange_t** chan, uint32_t dataSize);
+        void release_to_slab(CacheChange_t* ch);
+        //! Removes a slab CacheChange from m_allCaches and deletes it.
+        void delete_slab_change(SlabChange* ch);
+
         //! Returns a CacheChange to the free caches pool
         void return_cache_to_pool(CacheChange_t* ch);
+        //! Sets a CacheChange to the state it has when reserved
+        void reset_cache(CacheChange_t* ch);
 
         uint32_t m_initial_payload_size;
         uint32_t m_payload_size;
@@ -93,6 +131,10 @@ class CacheChangePool {
         bool allocateGroup(uint32_t pool_size);
         CacheChange_t* allocateSingle(uint32_t dataSize);
         MemoryManagementPolicy_t memoryMode;
+        //! Free lists and statistics of each payload size class. Only used on DYNAMIC_SLAB_MEMORY_MODE.
+        SizeClass* m_size_classes = nullptr;
+        size_t m_slab_free_count = 0;
+        uint32_t m_slab_high_water_mark = 0;
 };
 }
 } /* namespace rtps */
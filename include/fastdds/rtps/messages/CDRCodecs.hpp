@@ -0,0 +1,178 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CDRCodecs.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_MESSAGES_CDRCODECS_HPP_
+#define _FASTDDS_RTPS_MESSAGES_CDRCODECS_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/Types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif // if defined(_MSC_VER)
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Encoding and decoding of arrays of primitive values on CDR buffers.
+ * Values are copied as a block when the buffer has the local endianness, and byte-swapped on a single pass
+ * otherwise. The swap loops are branch free so the compiler can vectorize them.
+ */
+namespace CDRCodecs {
+
+namespace detail {
+
+inline uint16_t byte_swap(
+        uint16_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ushort(value);
+#elif defined(__GNUC__)
+    return __builtin_bswap16(value);
+#else
+    return static_cast<uint16_t>((value << 8) | (value >> 8));
+#endif // if defined(_MSC_VER)
+}
+
+inline uint32_t byte_swap(
+        uint32_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#elif defined(__GNUC__)
+    return __builtin_bswap32(value);
+#else
+    return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) |
+           ((value & 0x00FF0000u) >> 8) | ((value & 0xFF000000u) >> 24);
+#endif // if defined(_MSC_VER)
+}
+
+inline uint64_t byte_swap(
+        uint64_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#elif defined(__GNUC__)
+    return __builtin_bswap64(value);
+#else
+    return (static_cast<uint64_t>(byte_swap(static_cast<uint32_t>(value))) << 32) |
+           byte_swap(static_cast<uint32_t>(value >> 32));
+#endif // if defined(_MSC_VER)
+}
+
+template<size_t size>
+struct unsigned_of;
+
+template<>
+struct unsigned_of<2>
+{
+    using type = uint16_t;
+};
+
+template<>
+struct unsigned_of<4>
+{
+    using type = uint32_t;
+};
+
+template<>
+struct unsigned_of<8>
+{
+    using type = uint64_t;
+};
+
+} // namespace detail
+
+/**
+ * Read an array of primitive values from a buffer.
+ * @param src Buffer to read from. No alignment is required.
+ * @param dst Array where values are stored.
+ * @param count Number of values to read.
+ * @param swap Whether the buffer has the opposite endianness of the local machine.
+ */
+template<typename T>
+inline void decode_array(
+        const octet* src,
+        T* dst,
+        size_t count,
+        bool swap)
+{
+    static_assert(std::is_arithmetic<T>::value, "Only primitive types are supported");
+
+    if (!swap || sizeof(T) == 1)
+    {
+        memcpy(dst, src, count * sizeof(T));
+        return;
+    }
+
+    using U = typename detail::unsigned_of<sizeof(T)>::type;
+    for (size_t i = 0; i < count; ++i)
+    {
+        U value;
+        memcpy(&value, src + i * sizeof(T), sizeof(T));
+        value = detail::byte_swap(value);
+        memcpy(&dst[i], &value, sizeof(T));
+    }
+}
+
+/**
+ * Write an array of primitive values to a buffer.
+ * @param dst Buffer to write to. No alignment is required.
+ * @param src Array with the values to write.
+ * @param count Number of values to write.
+ * @param swap Whether the buffer should have the opposite endianness of the local machine.
+ */
+template<typename T>
+inline void encode_array(
+        octet* dst,
+        const T* src,
+        size_t count,
+        bool swap)
+{
+    static_assert(std::is_arithmetic<T>::value, "Only primitive types are supported");
+
+    if (!swap || sizeof(T) == 1)
+    {
+        memcpy(dst, src, count * sizeof(T));
+        return;
+    }
+
+    using U = typename detail::unsigned_of<sizeof(T)>::type;
+    for (size_t i = 0; i < count; ++i)
+    {
+        U value;
+        memcpy(&value, &src[i], sizeof(T));
+        value = detail::byte_swap(value);
+        memcpy(dst + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+} // namespace CDRCodecs
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_MESSAGES_CDRCODECS_HPP_
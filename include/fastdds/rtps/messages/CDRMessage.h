@@ -28,6 +28,7 @@
 #include <fastdds/rtps/common/SampleIdentity.h>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/messages/CDRCodecs.hpp>
 #include <fastrtps/utils/fixed_size_string.hpp>
 
 #include <fastdds/rtps/security/common/ParticipantGenericMessage.h>
@@ -83,6 +84,11 @@ inline bool readInt64(
         CDRMessage_t* msg,
         int64_t* lolo);
 
+inline bool readUInt32Array(
+        CDRMessage_t* msg,
+        uint32_t* values,
+        uint32_t count);
+
 inline bool readSequenceNumber(
         CDRMessage_t* msg,
         SequenceNumber_t* sn);
@@ -225,6 +231,11 @@ inline bool addInt64(
         CDRMessage_t* msg,
         int64_t lo);
 
+inline bool addUInt32Array(
+        CDRMessage_t* msg,
+        const uint32_t* values,
+        uint32_t count);
+
 inline bool addEntityId(
         CDRMessage_t* msg,
         const EntityId_t* id);
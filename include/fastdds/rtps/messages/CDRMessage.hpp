@@ -145,19 +145,8 @@ inline bool CDRMessage::readInt32(
     {
         return false;
     }
-    octet* dest = (octet*)lo;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            dest[i] = msg->buffer[msg->pos + i];
-        }
-        msg->pos += 4;
-    }
-    else
-    {
-        readDataReversed(msg, dest, 4);
-    }
+    CDRCodecs::decode_array(&msg->buffer[msg->pos], lo, 1, msg->msg_endian != DEFAULT_ENDIAN);
+    msg->pos += 4;
     return true;
 }
 
@@ -169,19 +158,8 @@ inline bool CDRMessage::readUInt32(
     {
         return false;
     }
-    octet* dest = (octet*)ulo;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            dest[i] = msg->buffer[msg->pos + i];
-        }
-        msg->pos += 4;
-    }
-    else
-    {
-        readDataReversed(msg, dest, 4);
-    }
+    CDRCodecs::decode_array(&msg->buffer[msg->pos], ulo, 1, msg->msg_endian != DEFAULT_ENDIAN);
+    msg->pos += 4;
     return true;
 }
 
@@ -193,22 +171,22 @@ inline bool CDRMessage::readInt64(
     {
         return false;
     }
+    CDRCodecs::decode_array(&msg->buffer[msg->pos], lolo, 1, msg->msg_endian != DEFAULT_ENDIAN);
+    msg->pos += 8;
+    return true;
+}
 
-    octet* dest = (octet*)lolo;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 8; ++i)
-        {
-            dest[i] = msg->buffer[msg->pos + i];
-        }
-
-        msg->pos += 8;
-    }
-    else
+inline bool CDRMessage::readUInt32Array(
+        CDRMessage_t* msg,
+        uint32_t* values,
+        uint32_t count)
+{
+    if (msg->pos > msg->length || count > (msg->length - msg->pos) / 4)
     {
-        readDataReversed(msg, dest, 8);
+        return false;
     }
-
+    CDRCodecs::decode_array(&msg->buffer[msg->pos], values, count, msg->msg_endian != DEFAULT_ENDIAN);
+    msg->pos += count * 4;
     return true;
 }
 
@@ -237,10 +215,7 @@ inline SequenceNumberSet_t CDRMessage::readSequenceNumberSet(
     valid &= CDRMessage::readUInt32(msg, &numBits);
     uint32_t n_longs = (numBits + 31ul) / 32ul;
     uint32_t bitmap[8];
-    for (uint32_t i = 0; i < n_longs; ++i)
-    {
-        valid &= CDRMessage::readUInt32(msg, &bitmap[i]);
-    }
+    valid &= n_longs <= 8 && CDRMessage::readUInt32Array(msg, bitmap, n_longs);
     if (valid)
     {
         sns.bitmap_set(numBits, bitmap);
@@ -261,10 +236,7 @@ inline bool CDRMessage::readFragmentNumberSet(
     valid &= CDRMessage::readUInt32(msg, &numBits);
     uint32_t n_longs = (numBits + 31ul) / 32ul;
     uint32_t bitmap[8];
-    for (uint32_t i = 0; i < n_longs; ++i)
-    {
-        valid &= CDRMessage::readUInt32(msg, &bitmap[i]);
-    }
+    valid &= n_longs <= 8 && CDRMessage::readUInt32Array(msg, bitmap, n_longs);
     if (valid)
     {
         fns->bitmap_set(numBits, bitmap);
@@ -308,17 +280,7 @@ inline bool CDRMessage::readInt16(
     {
         return false;
     }
-    octet* o = (octet*)i16;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        *o = msg->buffer[msg->pos];
-        *(o + 1) = msg->buffer[msg->pos + 1];
-    }
-    else
-    {
-        *o = msg->buffer[msg->pos + 1];
-        *(o + 1) = msg->buffer[msg->pos];
-    }
+    CDRCodecs::decode_array(&msg->buffer[msg->pos], i16, 1, msg->msg_endian != DEFAULT_ENDIAN);
     msg->pos += 2;
     return true;
 }
@@ -331,17 +293,7 @@ inline bool CDRMessage::readUInt16(
     {
         return false;
     }
-    octet* o = (octet*)i16;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        *o = msg->buffer[msg->pos];
-        *(o + 1) = msg->buffer[msg->pos + 1];
-    }
-    else
-    {
-        *o = msg->buffer[msg->pos + 1];
-        *(o + 1) = msg->buffer[msg->pos];
-    }
+    CDRCodecs::decode_array(&msg->buffer[msg->pos], i16, 1, msg->msg_endian != DEFAULT_ENDIAN);
     msg->pos += 2;
     return true;
 }
@@ -484,17 +436,7 @@ inline bool CDRMessage::addUInt16(
     {
         return false;
     }
-    octet* o = (octet*)&us;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        msg->buffer[msg->pos] = *(o);
-        msg->buffer[msg->pos + 1] = *(o + 1);
-    }
-    else
-    {
-        msg->buffer[msg->pos] = *(o + 1);
-        msg->buffer[msg->pos + 1] = *(o);
-    }
+    CDRCodecs::encode_array(&msg->buffer[msg->pos], &us, 1, msg->msg_endian != DEFAULT_ENDIAN);
     msg->pos += 2;
     msg->length += 2;
     return true;
@@ -504,25 +446,11 @@ inline bool CDRMessage::addInt32(
         CDRMessage_t* msg,
         int32_t lo)
 {
-    octet* o = (octet*)&lo;
     if (msg->pos + 4 > msg->max_size)
     {
         return false;
     }
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + i);
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + 3 - i);
-        }
-    }
+    CDRCodecs::encode_array(&msg->buffer[msg->pos], &lo, 1, msg->msg_endian != DEFAULT_ENDIAN);
     msg->pos += 4;
     msg->length += 4;
     return true;
@@ -532,25 +460,11 @@ inline bool CDRMessage::addUInt32(
         CDRMessage_t* msg,
         uint32_t ulo)
 {
-    octet* o = (octet*)&ulo;
     if (msg->pos + 4 > msg->max_size)
     {
         return false;
     }
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + i);
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + 3 - i);
-        }
-    }
+    CDRCodecs::encode_array(&msg->buffer[msg->pos], &ulo, 1, msg->msg_endian != DEFAULT_ENDIAN);
     msg->pos += 4;
     msg->length += 4;
     return true;
@@ -560,30 +474,31 @@ inline bool CDRMessage::addInt64(
         CDRMessage_t* msg,
         int64_t lolo)
 {
-    octet* o = (octet*)&lolo;
     if (msg->pos + 8 > msg->max_size)
     {
         return false;
     }
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + i);
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + 7 - i);
-        }
-    }
+    CDRCodecs::encode_array(&msg->buffer[msg->pos], &lolo, 1, msg->msg_endian != DEFAULT_ENDIAN);
     msg->pos += 8;
     msg->length += 8;
     return true;
 }
 
+inline bool CDRMessage::addUInt32Array(
+        CDRMessage_t* msg,
+        const uint32_t* values,
+        uint32_t count)
+{
+    if (msg->pos > msg->max_size || count > (msg->max_size - msg->pos) / 4)
+    {
+        return false;
+    }
+    CDRCodecs::encode_array(&msg->buffer[msg->pos], values, count, msg->msg_endian != DEFAULT_ENDIAN);
+    msg->pos += count * 4;
+    msg->length += count * 4;
+    return true;
+}
+
 inline bool CDRMessage::addOctetVector(
         CDRMessage_t* msg,
         const std::vector<octet>* ocvec,
@@ -664,11 +579,7 @@ inline bool CDRMessage::addSequenceNumberSet(
     sns->bitmap_get(numBits, bitmap, n_longs);
 
     addUInt32(msg, numBits);
-
-    for (uint32_t i = 0; i < n_longs; i++)
-    {
-        addUInt32(msg, bitmap[i]);
-    }
+    addUInt32Array(msg, bitmap.data(), n_longs);
 
     return true;
 }
@@ -698,11 +609,7 @@ inline bool CDRMessage::addFragmentNumberSet(
     fns->bitmap_get(numBits, bitmap, n_longs);
 
     addUInt32(msg, numBits);
-
-    for (uint32_t i = 0; i < n_longs; i++)
-    {
-        addUInt32(msg, bitmap[i]);
-    }
+    addUInt32Array(msg, bitmap.data(), n_longs);
 
     return true;
 }
@@ -73,6 +73,10 @@ private:
     std::mutex mtx_;
     std::vector<RTPSWriter*> associated_writers_;
     std::unordered_map<EntityId_t, std::vector<RTPSReader*> > associated_readers_;
+    //!Entity ID of the last readers looked up. Consecutive submessages usually go to the same readers.
+    EntityId_t last_reader_id_;
+    //!Readers associated to last_reader_id_, nullptr when they have to be looked up again.
+    const std::vector<RTPSReader*>* last_readers_;
 
     RTPSParticipantImpl* participant_;
     //!Protocol version of the message
@@ -113,6 +117,15 @@ private:
             CDRMessage_t* msg,
             SubmessageHeader_t* smh);
 
+    /**
+     * Get the readers (in associated_readers_) with the given entity ID.
+     * The result of the last lookup is reused, so a batch of submessages to the same readers is resolved once.
+     * @param readerID Entity ID of the readers.
+     * @return Pointer to the readers, or nullptr if there are none.
+     */
+    const std::vector<RTPSReader*>* find_readers(
+            const EntityId_t& readerID);
+
     /**
      * Find if there is a reader (in associated_readers_) that will accept a msg directed
      * to the given entity ID.
@@ -105,15 +105,22 @@ class RTPSMessageCreator
         static bool addMessageData(CDRMessage_t* msg, GuidPrefix_t& guidprefix, const CacheChange_t* change,
                 TopicKind_t topicKind, const EntityId_t& readerId, bool expectsInlineQos, InlineQosWriter* inlineQos);
 
+        /**
+         * Add a DATA submessage.
+         * When payload_position is not null, the serialized payload is not copied. Room for it is reserved on msg
+         * and its position returned, so the caller can reference the payload instead. It is left untouched when
+         * the submessage carries no serialized payload.
+         */
         static bool addSubmessageData(CDRMessage_t* msg, const CacheChange_t* change,
                 TopicKind_t topicKind, const EntityId_t& readerId, bool expectsInlineQos, InlineQosWriter* inlineQos, 
-                bool* is_big_submessage);
+                bool* is_big_submessage, uint32_t* payload_position = nullptr);
 
         static bool addMessageDataFrag(CDRMessage_t* msg, GuidPrefix_t& guidprefix, const CacheChange_t* change, uint32_t fragment_number,
                 TopicKind_t topicKind, const EntityId_t& readerId, bool expectsInlineQos, InlineQosWriter* inlineQos);
+        //! Add a DATA_FRAG submessage. See addSubmessageData for the meaning of payload_position.
         static bool addSubmessageDataFrag(CDRMessage_t* msg, const CacheChange_t* change, uint32_t fragment_number,
                 uint32_t sample_size, TopicKind_t topicKind, const EntityId_t& readerId, bool expectsInlineQos,
-                InlineQosWriter* inlineQos);
+                InlineQosWriter* inlineQos, uint32_t* payload_position = nullptr);
 
         static bool addMessageGap(CDRMessage_t* msg, const GuidPrefix_t& guidprefix, const GuidPrefix_t& remoteGuidPrefix,
                 const SequenceNumber_t& seqNumFirst, const SequenceNumberSet_t& seqNumList,const EntityId_t& readerId,const EntityId_t& writerId);
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
 #include <fastdds/rtps/common/FragmentNumber.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 
 #include <vector>
 #include <chrono>
@@ -191,6 +192,8 @@ private:
 
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
+    //! Smaller payloads are copied into the message, as it is cheaper than adding them to the gather list
+    static constexpr uint32_t min_payload_reference_size_ = 256;
 
     void reset_to_header();
 
@@ -216,6 +219,13 @@ private:
             const GuidPrefix_t& destination_guid_prefix,
             bool is_big_submessage);
 
+    bool append_submessage();
+
+    bool can_reference_payload(
+            uint32_t payload_length) const;
+
+    void finish_buffers();
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -236,6 +246,15 @@ private:
 
     CDRMessage_t* submessage_msg_;
 
+    //! Serialized payload of submessage_msg_ that has not been copied into it
+    NetworkBuffer submessage_payload_;
+
+    //! Position on submessage_msg_ reserved for submessage_payload_
+    uint32_t submessage_payload_position_;
+
+    //! Position on full_msg_ up to which the gather list has been built
+    uint32_t buffers_position_;
+
     uint32_t currentBytesSent_;
 
     GuidPrefix_t current_dst_;
@@ -24,6 +24,7 @@
 
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 
 #include <vector>
 
@@ -75,10 +76,13 @@ class RTPSMessageSenderInterface
          * Send a message through this interface.
          *
          * @param message Pointer to the buffer with the message already serialized.
+         * @param buffers Gather list describing the message. The buffers not pointing to their position on
+         * @c message reference data, like serialized payloads, that has not been copied into it.
          * @param max_blocking_time_point Future timepoint where blocking send should end.
          */
         virtual bool send(
                 CDRMessage_t* message,
+                const std::vector<NetworkBuffer>& buffers,
                 std::chrono::steady_clock::time_point& max_blocking_time_point) const = 0;
 };
 
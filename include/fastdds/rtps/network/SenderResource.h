@@ -15,6 +15,8 @@
 #ifndef _FASTDDS_RTPS_SENDER_RESOURCE_H
 #define _FASTDDS_RTPS_SENDER_RESOURCE_H
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
+
 #include <functional>
 #include <vector>
 #include <chrono>
@@ -65,6 +67,48 @@ public:
         return returned_value;
     }
 
+    /**
+     * Sends a message described by a gather list to a destination locator, through the channel managed by this
+     * resource.
+     * Only resources with gather support (see supports_gather()) can send a list with more than one buffer.
+     * @param buffers Gather list of the message to be sent. At most max_network_buffers entries.
+     * @param total_bytes Sum of the sizes of the buffers.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     */
+    bool send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        LocatorsIterator* destination_locators_begin,
+        LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        bool returned_value = false;
+
+        if (send_buffers_lambda_)
+        {
+            returned_value = send_buffers_lambda_(buffers, total_bytes, destination_locators_begin,
+                    destination_locators_end, max_blocking_time_point);
+        }
+        else if (buffers.size() == 1)
+        {
+            returned_value = send(buffers[0].buffer, buffers[0].size, destination_locators_begin,
+                    destination_locators_end, max_blocking_time_point);
+        }
+
+        return returned_value;
+    }
+
+    /**
+     * Whether this resource can send a gather list without flattening it first.
+     */
+    bool supports_gather() const
+    {
+        return static_cast<bool>(send_buffers_lambda_);
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -73,6 +117,7 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_lambda_.swap(rValueResource.send_lambda_);
+        send_buffers_lambda_.swap(rValueResource.send_buffers_lambda_);
     }
 
     virtual ~SenderResource() = default;
@@ -92,6 +137,13 @@ protected:
             LocatorsIterator* destination_locators_begin,
             LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point&)> send_lambda_;
+    //! Optional, for transports able to send a gather list
+    std::function<bool(
+            const std::vector<NetworkBuffer>&,
+            uint32_t,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point&)> send_buffers_lambda_;
 
 private:
 
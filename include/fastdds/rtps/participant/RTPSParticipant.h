@@ -21,8 +21,10 @@
 
 #include <cstdlib>
 #include <memory>
+#include <vector>
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/statistics/EntityStatistics.hpp>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastrtps/qos/ReaderQos.h>
@@ -238,6 +240,14 @@ public:
      */
     void enable();
 
+    /**
+     * @brief Retrieves the current value of the performance counters of this participant and all its endpoints.
+     * @param statistics Vector where the snapshots are stored.
+     * @return false if the library was built without FASTDDS_STATISTICS.
+     */
+    bool get_statistics(
+            std::vector<fastdds::statistics::EntityStatistics>& statistics) const;
+
 private:
 
     //!Pointer to the implementation.
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 
 #include <mutex>
@@ -34,6 +35,9 @@ namespace rtps {
 
 class WriterProxy;
 class RTPSMessageSenderInterface;
+class FragmentReassemblyManager;
+class DataSharingListener;
+class DataSharingRing;
 
 /**
  * Class StatefulReader, specialization of RTPSReader than stores the state of the matched writers.
@@ -239,12 +243,14 @@ class StatefulReader : public RTPSReader
         /**
         *Use the participant of this reader to send a message to certain locator.
         *@param message Message to be sent.
+        *@param buffers Gather list describing the message.
         *@param locators_begin Destination locators iterator begin.
         *@param locators_end Destination locators iterator end.
         *@param max_blocking_time_point Future time point where any blocking should end.
         */
         bool send_sync_nts(
                 CDRMessage_t* message,
+                const std::vector<NetworkBuffer>& buffers,
                 const Locators& locators_begin,
                 const Locators& locators_end,
                 std::chrono::steady_clock::time_point& max_blocking_time_point);
@@ -264,12 +270,33 @@ class StatefulReader : public RTPSReader
 
         void NotifyChanges(WriterProxy* wp);
 
+        /*!
+         * Assert the liveliness of a writer, when liveliness is being checked.
+         * @remarks Non thread-safe.
+         */
+        void assert_writer_liveliness(
+                const GUID_t& writer_guid);
+
+        /*!
+         * Take a sample from the data-sharing ring of a matched writer.
+         * @param ring Ring of the writer.
+         * @param sequence_number Sequence number of the sample.
+         * @return true if the sample is on the reader history, false otherwise.
+         */
+        bool process_datasharing_sample(
+                DataSharingRing& ring,
+                const SequenceNumber_t& sequence_number);
+
         //! Acknack Count
         uint32_t acknack_count_;
         //! NACKFRAG Count
         uint32_t nackfrag_count_;
         //!ReaderTimes of the StatefulReader.
         ReaderTimes times_;
+        //! Samples being received in fragments.
+        FragmentReassemblyManager* fragments_;
+        //! Takes samples from the writers on the same host using data-sharing. nullptr when disabled.
+        DataSharingListener* datasharing_listener_;
         //! Vector containing pointers to all the active WriterProxies.
         ResourceLimitedVector<WriterProxy*> matched_writers_;
         //! Vector containing pointers to all the inactive, ready for reuse, WriterProxies.
@@ -23,9 +23,11 @@
 #include <atomic>
 #include <list>
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/resources/AsyncInterestTree.h>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
+#include <fastrtps/utils/thread.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -45,6 +47,15 @@ public:
 
     AsyncWriterThread() = default;
 
+    /*!
+     * @param thread_settings Settings applied to the thread when it is started.
+     */
+    explicit AsyncWriterThread(
+            const fastdds::rtps::ThreadSettings& thread_settings)
+        : thread_settings_(thread_settings)
+    {
+    }
+
     ~AsyncWriterThread();
 
     /*!
@@ -81,7 +92,8 @@ private:
     //! @brief runs main method
     void run();
 
-    std::thread* thread_ = nullptr;
+    eprosima::thread* thread_ = nullptr;
+    fastdds::rtps::ThreadSettings thread_settings_;
     RecursiveTimedMutex condition_variable_mutex_;
 
     //! List of asynchronous writers.
@@ -22,9 +22,12 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
+#include <fastrtps/utils/thread.hpp>
 
+#include <string>
 #include <thread>
 #include <atomic>
 #include <vector>
@@ -49,8 +52,12 @@ public:
 
     /*!
      * @brief Method to initialize the internal thread.
+     * @param settings Settings applied to the thread.
+     * @param name Name given to the thread.
      */
-    void init_thread();
+    void init_thread(
+            const fastdds::rtps::ThreadSettings& settings = fastdds::rtps::ThreadSettings(),
+            const std::string& name = "dds.ev");
 
     /*!
      * @brief This method informs that a TimedEventImpl has been created.
@@ -124,7 +131,7 @@ private:
     std::chrono::steady_clock::time_point current_time_;
 
     //! Execution thread.
-    std::thread thread_;
+    eprosima::thread thread_;
 
     /*!
      * @brief Registers a new TimedEventImpl object in the internal queue to be processed.
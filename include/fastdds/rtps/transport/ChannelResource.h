@@ -15,9 +15,11 @@
 #ifndef _FASTDDS_CHANNEL_RESOURCE_INFO_
 #define _FASTDDS_CHANNEL_RESOURCE_INFO_
 
+#include <cstring>
 #include <memory>
 #include <map>
 #include <fastrtps/utils/Semaphore.h>
+#include <fastrtps/utils/thread.hpp>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.h>
 
@@ -35,7 +37,7 @@ public:
 
     virtual void clear();
 
-    inline void thread(std::thread&& pThread)
+    inline void thread(eprosima::thread&& pThread)
     {
         if(thread_.joinable())
         {
@@ -60,12 +62,25 @@ public:
         return message_buffer_;
     }
 
+    /**
+     * Allocate the reception buffer again from the calling thread.
+     * With the default memory policy, pages are placed on the NUMA node of the thread that first touches them, so
+     * reception threads call this once started to get a buffer local to the CPUs they run on.
+     */
+    inline void relocate_message_buffer()
+    {
+        uint32_t size = message_buffer_.max_size;
+        fastrtps::rtps::CDRMessage_t previous_buffer(std::move(message_buffer_));
+        message_buffer_ = fastrtps::rtps::CDRMessage_t(size);
+        memset(message_buffer_.buffer, 0, size);
+    }
+
 protected:
     //!Received message
     fastrtps::rtps::CDRMessage_t message_buffer_;
 
     std::atomic<bool> alive_;
-    std::thread thread_;
+    eprosima::thread thread_;
 };
 
 } // namespace rtps
@@ -71,6 +71,8 @@ protected:
     std::vector<uint16_t> pending_logical_output_ports_; // Must be accessed after lock pending_logical_mutex_
     std::vector<uint16_t> logical_output_ports_;
     std::mutex read_mutex_;
+    //! Serializes the writes on the socket, as messages can be sent from several threads concurrently
+    std::mutex send_mutex_;
     std::recursive_mutex pending_logical_mutex_;
     std::atomic<eConnectionStatus> connection_status_;
 
@@ -18,6 +18,7 @@
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
+#include <fastrtps/utils/thread.hpp>
 #include <fastdds/rtps/transport/tcp/RTCPHeader.h>
 #include <fastdds/rtps/transport/TCPChannelResourceBasic.h>
 #include <fastdds/rtps/transport/TCPAcceptorBasic.h>
@@ -76,8 +77,8 @@ protected:
 #if TLS_FOUND
     asio::ssl::context ssl_context_;
 #endif
-    std::shared_ptr<std::thread> io_service_thread_;
-    std::shared_ptr<std::thread> io_service_timers_thread_;
+    std::shared_ptr<eprosima::thread> io_service_thread_;
+    std::shared_ptr<eprosima::thread> io_service_timers_thread_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
     std::condition_variable rtcp_message_manager_cv_;
@@ -21,6 +21,8 @@
 #include <vector>
 #include <string>
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
 namespace eprosima{
 namespace fastdds{
 namespace rtps{
@@ -41,6 +43,7 @@ struct TransportDescriptorInterface
     TransportDescriptorInterface(const TransportDescriptorInterface& t)
         : maxMessageSize(t.maxMessageSize)
         , maxInitialPeersRange(t.maxInitialPeersRange)
+        , reception_threads(t.reception_threads)
     {}
 
     virtual ~TransportDescriptorInterface(){}
@@ -63,6 +66,9 @@ struct TransportDescriptorInterface
     uint32_t maxMessageSize;
 
     uint32_t maxInitialPeersRange;
+
+    //! Settings of the threads receiving data from this transport
+    ThreadSettings reception_threads;
 };
 
 } // namespace rtps
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_UDP_CHANNEL_RESOURCE_INFO_
 #define _FASTDDS_UDP_CHANNEL_RESOURCE_INFO_
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/transport/ChannelResource.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <asio.hpp>
@@ -82,7 +83,8 @@ public:
         uint32_t maxMsgSize,
         const fastrtps::rtps::Locator_t& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver);
+        TransportReceiverInterface* receiver,
+        const ThreadSettings& thread_settings = ThreadSettings());
 
     virtual ~UDPChannelResource() override;
 
@@ -18,6 +18,7 @@
 #include <asio.hpp>
 #include <thread>
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/UDPChannelResource.h>
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
@@ -109,6 +110,28 @@ public:
            bool only_multicast_purpose,
            const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+   /**
+   * Blocking Send of a gather list through the specified channel. Each destination receives the buffers as a single
+   * datagram, without copying them into a contiguous buffer first.
+   * @param buffers Gather list of the message to send.
+   * @param total_bytes Sum of the sizes of the buffers.
+   * @param socket channel we're sending from.
+   * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+   * so should not be reuse.
+   * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+   * so should not be reuse.
+   * @param only_multicast_purpose
+   * @param max_blocking_time_point maximum blocking time.
+   */
+   virtual bool send(
+           const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+           uint32_t total_bytes,
+           eProsimaUDPSocket& socket,
+           fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+           fastrtps::rtps::LocatorsIterator* destination_locators_end,
+           bool only_multicast_purpose,
+           const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -202,6 +225,31 @@ protected:
         const fastrtps::rtps::Locator_t& remote_locator,
         bool only_multicast_purpose,
         const std::chrono::microseconds& timeout);
+
+    /**
+     * Send a gather list to several destinations
+     */
+    bool send(
+        const fastrtps::rtps::NetworkBuffer* buffers,
+        size_t buffer_count,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    /**
+     * Send a gather list to a destination
+     */
+    bool send(
+        const fastrtps::rtps::NetworkBuffer* buffers,
+        size_t buffer_count,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const fastrtps::rtps::Locator_t& remote_locator,
+        bool only_multicast_purpose,
+        const std::chrono::microseconds& timeout);
 };
 
 } // namespace rtps
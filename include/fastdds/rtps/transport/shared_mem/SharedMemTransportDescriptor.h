@@ -90,6 +90,52 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
         healthy_check_timeout_ms_ = healthy_check_timeout_ms;
     }
 
+    /**
+     * Maximum time, in microseconds, a listener busy-polls its port for new data before parking on the port's
+     * condition variable. The actual time is adapted to the traffic. 0 (default) disables busy-polling.
+     */
+    RTPS_DllAPI uint32_t busy_poll_us() const
+    {
+        return busy_poll_us_;
+    }
+
+    RTPS_DllAPI void busy_poll_us(
+            uint32_t busy_poll_us)
+    {
+        busy_poll_us_ = busy_poll_us;
+    }
+
+    /**
+     * Size of the fixed-size buffers carved from the segment. When non-zero, the segment is split at creation
+     * into buffers of this size, which are handed out without going through the segment's generic allocator.
+     * It should be at least max_message_size. 0 (default) uses the generic allocator.
+     */
+    RTPS_DllAPI uint32_t buffer_slab_size() const
+    {
+        return buffer_slab_size_;
+    }
+
+    RTPS_DllAPI void buffer_slab_size(
+            uint32_t buffer_slab_size)
+    {
+        buffer_slab_size_ = buffer_slab_size;
+    }
+
+    /**
+     * Whether the segment should be backed by huge pages. On Linux the segment mapping is advised for
+     * transparent huge pages, which requires shmem huge pages to be enabled on the system. Ignored elsewhere.
+     */
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
     RTPS_DllAPI std::string rtps_dump_file() const
     {
         return rtps_dump_file_;
@@ -106,6 +152,9 @@ private:
     uint32_t segment_size_;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
+    uint32_t busy_poll_us_;
+    uint32_t buffer_slab_size_;
+    bool huge_pages_;
     std::string rtps_dump_file_;
 
 }SharedMemTransportDescriptor;
@@ -46,6 +46,16 @@ public:
            bool only_multicast_purpose,
            const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
 
+    //! Gather lists are flattened, so the drop filters can inspect the whole message
+    virtual bool send(
+           const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+           uint32_t total_bytes,
+           eProsimaUDPSocket& socket,
+           fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+           fastrtps::rtps::LocatorsIterator* destination_locators_end,
+           bool only_multicast_purpose,
+           const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
+
     RTPS_DllAPI static bool test_UDPv4Transport_ShutdownAllNetwork;
     // Handle to a persistent log of dropped packets. Defaults to length 0 (no logging) to prevent wasted resources.
     RTPS_DllAPI static std::vector<std::vector<fastrtps::rtps::octet> > test_UDPv4Transport_DropLog;
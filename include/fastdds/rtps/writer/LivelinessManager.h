@@ -22,7 +22,10 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/resources/TimedEvent.h>
 
+#include <array>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -37,7 +40,9 @@ using LivelinessCallback = std::function<void(
 
 /**
  * @brief A class managing the liveliness of a set of writers. Writers are represented by their LivelinessData
- * @details Uses a shared timed event and informs outside classes on liveliness changes
+ * @details Uses a shared timed event and informs outside classes on liveliness changes.
+ * Writers are indexed by GUID, and alive writers are kept on a min-heap ordered by the time they lose liveliness,
+ * so asserting the liveliness of a writer and expiring it take logarithmic time on the number of writers.
  * @ingroup WRITER_MODULE
  */
 class LivelinessManager
@@ -126,28 +131,54 @@ public:
 private:
 
     //! @brief A method responsible for invoking the callback when liveliness is asserted
-    //! @param writer The liveliness data of the writer asserting liveliness
+    //! @param index Position on writers_ of the writer asserting liveliness
     //!
-    void assert_writer_liveliness(LivelinessData& writer);
+    void assert_writer_liveliness(size_t index);
+
+    //! @brief A method to mark an alive writer as not alive, removing it from the deadline heap
+    //! @param index Position on writers_ of the writer
+    //!
+    void set_writer_not_alive(size_t index);
 
     /**
-     * @brief A method to calculate the time when the next writer is going to lose liveliness
-     * @details This method is public for testing purposes but it should not be used from outside this class
+     * @brief A method to check whether any writer is alive, in which case the timer owner is the top of the heap
      * @return True if at least one writer is alive
      */
     bool calculate_next();
 
+    //! @brief A method to restart the timer so it expires when the timer owner loses its liveliness
+    void restart_timer();
+
     //! @brief A method to find a writer from a guid, liveliness kind and lease duration
     //! @param guid The guid of the writer
     //! @param kind The liveliness kind
     //! @param lease_duration The lease duration
-    //! @param wit_out Returns an iterator to the writer liveliness data
+    //! @param index_out Returns the position of the writer liveliness data on writers_
     //! @return Returns true if writer was found, false otherwise
     bool find_writer(
             const GUID_t &guid,
             const LivelinessQosPolicyKind &kind,
             const Duration_t &lease_duration,
-            ResourceLimitedVector<LivelinessData>::iterator* wit_out);
+            size_t* index_out);
+
+    //! @brief Inserts a writer on the deadline heap
+    void heap_push(size_t index);
+
+    //! @brief Removes a writer from the deadline heap
+    void heap_remove(size_t index);
+
+    //! @brief Restores the heap property after the time of the writer at a heap position changed
+    void heap_update(size_t heap_pos);
+
+    //! @brief Swaps two positions of the deadline heap
+    void heap_swap(
+            size_t a,
+            size_t b);
+
+    //! @brief Compares the time two positions of the deadline heap lose liveliness
+    bool heap_less(
+            size_t a,
+            size_t b) const;
 
 
     //! @brief A method called if the timer expires
@@ -163,12 +194,22 @@ private:
     //! A vector of liveliness data
     ResourceLimitedVector<LivelinessData> writers_;
 
+    //! Position on deadline_heap_ of each writer, in the same order as writers_
+    std::vector<size_t> heap_positions_;
+
+    //! Min-heap with the positions on writers_ of the alive writers, ordered by the time they lose liveliness.
+    //! The top of the heap is the timer owner, i.e. the writer which is next due to lose its liveliness
+    std::vector<size_t> deadline_heap_;
+
+    //! Positions on writers_ indexed by writer GUID
+    std::unordered_multimap<GUID_t, size_t> writers_index_;
+
+    //! Number of alive writers of each liveliness kind
+    std::array<size_t, 3> alive_count_;
+
     //! A mutex to protect the liveliness data
     std::mutex mutex_;
 
-    //! The timer owner, i.e. the writer which is next due to lose its liveliness
-    LivelinessData* timer_owner_;
-
     //! A timed callback expiring when a writer (the timer owner) loses its liveliness
     TimedEvent timer_;
 };
@@ -40,6 +40,7 @@ namespace rtps {
 class WriterListener;
 class WriterHistory;
 class FlowController;
+class TimedEvent;
 struct CacheChange_t;
 
 /**
@@ -147,6 +148,12 @@ public:
      */
     RTPS_DllAPI virtual void send_any_unsent_changes() = 0;
 
+    /**
+     * Send the samples kept on the current batch, if any.
+     * Only relevant when batching is enabled.
+     */
+    RTPS_DllAPI void flush_batch();
+
     /**
      * Get Min Seq Num in History.
      * @return Minimum sequence number in history
@@ -356,10 +363,12 @@ public:
      * Send a message through this interface.
      *
      * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers Gather list describing the message.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
             CDRMessage_t* message,
+            const std::vector<NetworkBuffer>& buffers,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
 protected:
@@ -374,6 +383,14 @@ protected:
     bool is_async_;
     //!Separate sending activated
     bool m_separateSendingEnabled;
+    //!Batching configuration
+    BatchingAttributes batching_;
+    //!Number of samples on the current batch
+    uint32_t batched_samples_;
+    //!Payload bytes on the current batch
+    uint32_t batched_bytes_;
+    //!Event sending the current batch when max_flush_delay expires. Deleted by the child classes.
+    TimedEvent* batch_flush_event_;
 
     LocatorSelector locator_selector_;
 
@@ -392,6 +409,19 @@ protected:
      */
     void init_header();
 
+    /**
+     * Account a change on the current batch, and send the batch when one of its limits is reached.
+     * Should be called with the writer mutex locked, after adding the change to the unsent changes.
+     * @param change Pointer to the change just added.
+     */
+    void add_to_batch_nts(
+            const CacheChange_t* change);
+
+    /**
+     * Send the current batch. Should be called with the writer mutex locked.
+     */
+    void flush_batch_nts();
+
     /**
      * Add a change to the unsent list.
      * @param change Pointer to the change to add.
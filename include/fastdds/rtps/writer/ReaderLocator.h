@@ -172,10 +172,12 @@ public:
      * Send a message through this interface.
      *
      * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers Gather list describing the message.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
             CDRMessage_t* message,
+            const std::vector<NetworkBuffer>& buffers,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
 private:
@@ -0,0 +1,154 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderLocatorCluster.h
+ */
+#ifndef _FASTDDS_RTPS_READERLOCATORCLUSTER_H_
+#define _FASTDDS_RTPS_READERLOCATORCLUSTER_H_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
+
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+class ReaderLocator;
+
+/**
+ * Set of remote readers that receive data through the same destination locators.
+ *
+ * When separate sending is enabled, a StatelessWriter sends each sample once per cluster instead of once per
+ * reader. Readers sharing a host or a multicast group end up on the same cluster, so the sample is serialized and
+ * sent once for all of them.
+ * @ingroup WRITER_MODULE
+ */
+class ReaderLocatorCluster : public RTPSMessageSenderInterface
+{
+public:
+
+    /**
+     * Construct a ReaderLocatorCluster.
+     *
+     * @param participant  Participant used to send the messages.
+     * @param destinations Locators the messages will be sent to.
+     */
+    ReaderLocatorCluster(
+            RTPSParticipantImpl* participant,
+            const ResourceLimitedVector<Locator_t>& destinations);
+
+    virtual ~ReaderLocatorCluster() = default;
+
+    /**
+     * Get the locators a reader receives data through.
+     * Unicast locators are used when the reader has any, multicast ones otherwise.
+     *
+     * @param reader ReaderLocator of a remote reader.
+     * @return a const reference to the locators of the reader.
+     */
+    static const ResourceLimitedVector<Locator_t>& destinations_of(
+            ReaderLocator& reader);
+
+    /**
+     * Group remote readers by their destination locators.
+     * Local readers and ReaderLocators not used by any reader are skipped.
+     *
+     * @param participant Participant used by the clusters to send the messages.
+     * @param readers     Matched readers.
+     * @param clusters    Vector where the clusters are rebuilt.
+     */
+    static void build_clusters(
+            RTPSParticipantImpl* participant,
+            ResourceLimitedVector<ReaderLocator>& readers,
+            std::vector<ReaderLocatorCluster>& clusters);
+
+    /**
+     * Check whether the cluster sends to the given locators, regardless of their order.
+     *
+     * @param destinations Locators to compare.
+     * @return true when the destinations are the ones of this cluster.
+     */
+    bool has_destinations(
+            const ResourceLimitedVector<Locator_t>& destinations) const;
+
+    /**
+     * Add a reader to the cluster.
+     *
+     * @param remote_guid GUID of the remote reader.
+     */
+    void add_reader(
+            const GUID_t& remote_guid);
+
+    size_t size() const
+    {
+        return guids_.size();
+    }
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return guid_prefixes_.size() == 1 ? guid_prefixes_.front() : c_GuidPrefix_Unknown;
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return guid_prefixes_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return guids_;
+    }
+
+    /**
+     * Send a message through this interface.
+     *
+     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers Gather list describing the message.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send(
+            CDRMessage_t* message,
+            const std::vector<NetworkBuffer>& buffers,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
+
+private:
+
+    RTPSParticipantImpl* participant_;
+
+    std::vector<Locator_t> destinations_;
+
+    std::vector<GuidPrefix_t> guid_prefixes_;
+
+    std::vector<GUID_t> guids_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif /* _FASTDDS_RTPS_READERLOCATORCLUSTER_H_ */
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <set>
 #include <atomic>
+#include <memory>
 
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/writer/ReaderLocator.h>
@@ -44,6 +45,7 @@ namespace rtps {
 class StatefulWriter;
 class TimedEvent;
 class RTPSReader;
+class DataSharingNotification;
 
 /**
  * ReaderProxy class that helps to keep the state of a specific Reader with respect to the RTPSWriter.
@@ -228,9 +230,12 @@ public:
 
     /**
      * Turns all REQUESTED changes into UNSENT.
+     * @param [out] requested_changes Optional vector where the sequence numbers of the changes turned into UNSENT
+     * are appended.
      * @return true if at least one change changed its status, false otherwise.
      */
-    bool perform_acknack_response();
+    bool perform_acknack_response(
+            std::vector<SequenceNumber_t>* requested_changes = nullptr);
 
     /**
      * Call this to inform a change was removed from history.
@@ -313,6 +318,34 @@ public:
         return locator_info_.local_reader();
     }
 
+    /**
+     * Check if samples are delivered to the reader through the data-sharing ring of the writer.
+     * @return true if the reader is using data-sharing.
+     */
+    inline bool is_datasharing_reader() const
+    {
+        return static_cast<bool>(datasharing_notification_);
+    }
+
+    /**
+     * Get the notification used to wake up the reader when it is using data-sharing.
+     * @return The notification of the reader, or nullptr if it is not using data-sharing.
+     */
+    inline const std::shared_ptr<DataSharingNotification>& datasharing_notification() const
+    {
+        return datasharing_notification_;
+    }
+
+    /**
+     * Set the notification used to wake up the reader when it is using data-sharing.
+     * @param notification Notification of the reader, or nullptr to stop using data-sharing.
+     */
+    inline void datasharing_notification(
+            std::shared_ptr<DataSharingNotification> notification)
+    {
+        datasharing_notification_ = notification;
+    }
+
     /**
      * Called when an ACKNACK is received to set a new value for the count of the last received ACKNACK.
      * @param acknack_count The count of the received ACKNACK.
@@ -411,6 +444,8 @@ private:
     bool is_reliable_;
     //!Taken from QoS
     bool disable_positive_acks_;
+    //!Notification of the reader, when it is using data-sharing.
+    std::shared_ptr<DataSharingNotification> datasharing_notification_;
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
     //!Set of the changes and its state.
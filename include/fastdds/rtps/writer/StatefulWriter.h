@@ -23,8 +23,11 @@
 
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
+#include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -32,6 +35,8 @@ namespace rtps {
 
 class ReaderProxy;
 class TimedEvent;
+class DataSharingRing;
+class ReaderLocatorCluster;
 
 /**
  * Class StatefulWriter, specialization of RTPSWriter that maintains information of each matched Reader.
@@ -44,6 +49,27 @@ class StatefulWriter : public RTPSWriter
 
 public:
 
+    /**
+     * Counters of the reliability traffic of a StatefulWriter.
+     */
+    struct RepairStatistics
+    {
+        //! Number of HEARTBEAT submessages sent.
+        uint64_t heartbeats_sent = 0;
+        //! Number of ACKNACK and NACKFRAG submessages requesting changes.
+        uint64_t nacks_received = 0;
+        //! Number of those NACKs that were joined to an already pending response.
+        uint64_t nacks_aggregated = 0;
+        //! Number of NACK responses performed.
+        uint64_t nack_responses = 0;
+        //! Number of (reader, change) pairs repaired by the NACK responses.
+        uint64_t requested_changes = 0;
+        //! Number of different changes repaired by the NACK responses. Each one is sent once for all its readers.
+        uint64_t repaired_changes = 0;
+        //! Current heartbeat period, in milliseconds.
+        double heartbeat_period_ms = 0;
+    };
+
     //!Destructor
     virtual ~StatefulWriter();
 
@@ -93,6 +119,21 @@ private:
     std::condition_variable_any may_remove_change_cond_;
     unsigned int may_remove_change_;
 
+    //! Adaptive reliability configuration.
+    AdaptiveReliabilityAttributes adaptive_reliability_;
+    //! Heartbeat period currently configured on periodic_hb_event_, in milliseconds.
+    double heartbeat_period_ms_;
+    //! Whether nack_response_event_ has been armed and the response has not been performed yet.
+    bool nack_response_pending_;
+    //! When the first NACK of the pending response was received.
+    std::chrono::steady_clock::time_point nack_window_start_;
+    //! NACKs received since nack_response_event_ was armed or last triggered.
+    uint32_t nacks_in_window_;
+    //! Sequence numbers repaired on a NACK response. Kept to avoid allocations.
+    std::vector<SequenceNumber_t> repaired_sequence_numbers_;
+    //! Reliability traffic counters.
+    RepairStatistics repair_statistics_;
+
 public:
 
     /**
@@ -243,6 +284,12 @@ public:
 
     SequenceNumber_t next_sequence_number() const;
 
+    /**
+     * Get the counters of the reliability traffic of this writer.
+     * @return A copy of the counters.
+     */
+    RepairStatistics get_repair_statistics() const;
+
     /**
      * @brief Sends a periodic heartbeat
      * @param final Final flag
@@ -261,7 +308,11 @@ public:
             ReaderProxy& remoteReaderProxy,
             bool liveliness = false);
 
-    void perform_nack_response();
+    /**
+     * Turns the changes requested by the readers into unsent changes.
+     * @return true when the response has been delayed to aggregate more NACKs.
+     */
+    bool perform_nack_response();
 
     void perform_nack_supression(
             const GUID_t& reader_guid);
@@ -322,6 +373,18 @@ private:
 
     void check_acked_status();
 
+    /**
+     * Arms the NACK response event, or joins the NACK to the already pending response.
+     * @remarks This function is non thread-safe.
+     */
+    void schedule_nack_response_nts();
+
+    /**
+     * Adapts the heartbeat period to the number of changes not acknowledged by all readers.
+     * @remarks This function is non thread-safe.
+     */
+    void update_heartbeat_period_nts();
+
     /**
      * @brief A method called when the ack timer expires
      * @details Only used if disable positive ACKs QoS is enabled
@@ -352,6 +415,27 @@ private:
             SequenceNumber_t seq,
             RTPSMessageGroup& group);
 
+    /**
+     * Stores a change on the data-sharing ring.
+     * @return true when the readers using data-sharing can take the change from the ring.
+     * @remarks This function is non thread-safe.
+     */
+    bool datasharing_write_nts(
+            CacheChange_t* change);
+
+    /**
+     * Wakes up all the readers using data-sharing.
+     * @remarks This function is non thread-safe.
+     */
+    void datasharing_notify_nts();
+
+    /**
+     * Computes the destinations of the remote readers not using data-sharing.
+     * Called whenever the matched readers change, so writing a change on the ring does not need to select them again.
+     * @remarks This function is non thread-safe.
+     */
+    void update_network_readers_nts();
+
     //! True to disable piggyback heartbeats
     bool disable_heartbeat_piggyback_;
     //! True to disable positive ACKs
@@ -371,6 +455,13 @@ private:
 
     bool there_are_remote_readers_ = false;
     bool there_are_local_readers_ = false;
+    bool there_are_datasharing_readers_ = false;
+
+    //! Ring where changes are published for readers on the same host. nullptr when data-sharing is disabled.
+    DataSharingRing* datasharing_ring_ = nullptr;
+
+    //! Remote readers not using data-sharing. Only computed when there are readers using data-sharing.
+    std::unique_ptr<ReaderLocatorCluster> network_readers_;
 
     StatefulWriter& operator =(
             const StatefulWriter&) = delete;
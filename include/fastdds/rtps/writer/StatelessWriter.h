@@ -22,6 +22,7 @@
 
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/writer/ReaderLocator.h>
+#include <fastdds/rtps/writer/ReaderLocatorCluster.h>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 
@@ -134,10 +135,12 @@ public:
      * Send a message through this interface.
      *
      * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers Gather list describing the message.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
             CDRMessage_t* message,
+            const std::vector<NetworkBuffer>& buffers,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
 private:
@@ -160,6 +163,8 @@ private:
     bool is_inline_qos_expected_ = false;
     LocatorList_t fixed_locators_;
     ResourceLimitedVector<ReaderLocator> matched_readers_;
+    //! Remote readers grouped by destination locators, used when separate sending is enabled
+    std::vector<ReaderLocatorCluster> reader_clusters_;
 
     ResourceLimitedVector<GUID_t> late_joiner_guids_;
     SequenceNumber_t first_seq_for_all_readers_;
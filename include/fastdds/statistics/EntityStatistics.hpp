@@ -0,0 +1,139 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EntityStatistics.hpp
+ */
+
+#ifndef _FASTDDS_STATISTICS_ENTITYSTATISTICS_HPP_
+#define _FASTDDS_STATISTICS_ENTITYSTATISTICS_HPP_
+
+#include <fastdds/rtps/common/Guid.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Histogram of latencies, with buckets on powers of two microseconds.
+ * Bucket 0 counts the latencies below 1 us, bucket i counts the latencies in [2^(i-1), 2^i) us, and the last
+ * bucket counts all the latencies above the previous one.
+ */
+struct LatencyHistogram
+{
+    //! Number of buckets on the histogram.
+    static constexpr size_t BUCKET_COUNT = 24;
+
+    //! Number of latencies on each bucket.
+    std::array<uint64_t, BUCKET_COUNT> buckets{};
+
+    //! Number of latencies added to the histogram.
+    uint64_t count = 0;
+
+    //! Sum of all the latencies, in nanoseconds.
+    uint64_t total_ns = 0;
+
+    //! Maximum latency, in nanoseconds.
+    uint64_t max_ns = 0;
+};
+
+/**
+ * Kind of entity the statistics belong to.
+ */
+enum class StatisticsEntityKind
+{
+    PARTICIPANT,
+    WRITER,
+    READER
+};
+
+/**
+ * Snapshot of the performance counters of an entity.
+ * Counters not applicable to the kind of entity are always zero.
+ */
+struct EntityStatistics
+{
+    //! GUID of the entity.
+    fastrtps::rtps::GUID_t guid;
+
+    //! Kind of the entity.
+    StatisticsEntityKind kind = StatisticsEntityKind::PARTICIPANT;
+
+    //! Participant: number of RTPS messages sent.
+    uint64_t messages_sent = 0;
+
+    //! Participant: number of bytes sent.
+    uint64_t bytes_sent = 0;
+
+    //! Participant: number of RTPS messages received.
+    uint64_t messages_received = 0;
+
+    //! Participant: number of bytes received.
+    uint64_t bytes_received = 0;
+
+    //! Participant: number of RTPS messages discarded because they were not valid.
+    uint64_t messages_discarded = 0;
+
+    //! Writer: number of DATA submessages sent.
+    uint64_t data_sent = 0;
+
+    //! Writer: number of DATA_FRAG submessages sent.
+    uint64_t data_frags_sent = 0;
+
+    //! Writer: number of samples that readers have asked to be sent again.
+    uint64_t data_resent = 0;
+
+    //! Writer: number of HEARTBEAT submessages sent.
+    uint64_t heartbeats_sent = 0;
+
+    //! Writer: number of GAP submessages sent.
+    uint64_t gaps_sent = 0;
+
+    //! Writer: number of ACKNACK submessages received.
+    uint64_t acknacks_received = 0;
+
+    //! Writer: number of NACK_FRAG submessages received.
+    uint64_t nackfrags_received = 0;
+
+    //! Reader: number of samples added to the history.
+    uint64_t data_received = 0;
+
+    //! Reader: number of payload bytes added to the history.
+    uint64_t payload_bytes_received = 0;
+
+    //! Reader: number of samples not added to the history.
+    uint64_t data_rejected = 0;
+
+    //! Reader: number of HEARTBEAT submessages received.
+    uint64_t heartbeats_received = 0;
+
+    //! Reader: number of ACKNACK submessages sent.
+    uint64_t acknacks_sent = 0;
+
+    //! Reader: number of NACK_FRAG submessages sent.
+    uint64_t nackfrags_sent = 0;
+
+    //! Reader: time from the source timestamp of the samples to their reception.
+    LatencyHistogram latency;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_STATISTICS_ENTITYSTATISTICS_HPP_
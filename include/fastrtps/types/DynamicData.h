@@ -19,6 +19,8 @@
 #include <fastrtps/types/DynamicDataPtr.h>
 #include <fastrtps/types/DynamicTypePtr.h>
 
+#include <memory>
+
 //#define DYNAMIC_TYPES_CHECKING
 
 namespace eprosima {
@@ -27,6 +29,7 @@ namespace types {
 
 class DynamicType;
 class MemberDescriptor;
+struct DynamicTypeSerializationPlan;
 
 class DynamicData
 {
@@ -111,6 +114,25 @@ protected:
 
     void serializeKey(eprosima::fastcdr::Cdr& cdr) const;
 
+#ifndef DYNAMIC_TYPES_CHECKING
+    // Returns the compiled plan of the type if it can be used with this data, nullptr otherwise.
+    std::shared_ptr<const DynamicTypeSerializationPlan> get_compiled_plan() const;
+
+    // Serializes and deserializes the members of a structure following its compiled plan.
+    void serialize_compiled(
+            const DynamicTypeSerializationPlan& plan,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    void deserialize_compiled(
+            const DynamicTypeSerializationPlan& plan,
+            eprosima::fastcdr::Cdr& cdr);
+
+    static size_t getCompiledCdrSerializedSize(
+            const DynamicData* data,
+            const DynamicTypeSerializationPlan& plan,
+            size_t current_alignment);
+#endif
+
     DynamicType_ptr type_;
     std::map<MemberId, MemberDescriptor*> descriptors_;
 
@@ -18,6 +18,9 @@
 #include <fastrtps/types/TypesBase.h>
 #include <fastrtps/types/DynamicTypePtr.h>
 
+#include <memory>
+#include <mutex>
+
 namespace eprosima {
 
 namespace fastdds {
@@ -33,6 +36,7 @@ class AnnotationDescriptor;
 class TypeDescriptor;
 class DynamicTypeMember;
 class DynamicTypeBuilder;
+struct DynamicTypeSerializationPlan;
 
 class DynamicType
 {
@@ -106,12 +110,22 @@ protected:
             DynamicTypeMember& member,
             const std::string& name);
 
+    // Returns the serialization plan of the type, compiling it the first time it is requested.
+    // The returned pointer keeps the plan alive even if the type resets it meanwhile.
+    std::shared_ptr<const DynamicTypeSerializationPlan> get_serialization_plan() const;
+
+    // Discards the compiled serialization plan. Called whenever the members or their annotations change.
+    void reset_serialization_plan();
+
     TypeDescriptor* descriptor_;
     std::map<MemberId, DynamicTypeMember*> member_by_id_;         // Aggregated members
     std::map<std::string, DynamicTypeMember*> member_by_name_;    // Uses the pointers from "member_by_id_".
     std::string name_;
     TypeKind kind_;
     bool is_key_defined_;
+    // Only accessed through std::atomic_load and std::atomic_store.
+    mutable std::shared_ptr<const DynamicTypeSerializationPlan> serialization_plan_;
+    mutable std::mutex serialization_plan_mutex_;
 
 public:
     RTPS_DllAPI bool equals(const DynamicType* other) const;
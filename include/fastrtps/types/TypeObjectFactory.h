@@ -19,7 +19,9 @@
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/types/DynamicTypePtr.h>
+#include <array>
 #include <mutex>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -28,20 +30,101 @@ namespace types {
 class TypeObjectFactory
 {
 private:
-    mutable std::recursive_mutex m_MutexIdentifiers;
-    mutable std::recursive_mutex m_MutexObjects;
+
+    //! Number of shards of each registry. Must be a power of two.
+    static constexpr size_t SHARD_COUNT = 16;
+
+    //! Type names, and the aliases, that hash to the same shard.
+    struct NameShard
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, const TypeIdentifier*> identifiers; // Basic, builtin and EK_MINIMAL
+        std::unordered_map<std::string, const TypeIdentifier*> complete_identifiers; // Only EK_COMPLETE
+        std::unordered_map<std::string, std::string> aliases;
+    };
+
+    //! Stored TypeIdentifiers whose value hashes to the same shard.
+    struct IdentifierShard
+    {
+        struct Entry
+        {
+            const TypeIdentifier* identifier;
+            //! Name the identifier is stored with. Points to the key on its NameShard, which is never erased.
+            const std::string* name;
+            bool complete;
+        };
+
+        std::mutex mutex;
+        std::unordered_multimap<size_t, Entry> entries;
+    };
+
+    //! TypeObjects whose TypeIdentifier hashes to the same shard.
+    struct ObjectShard
+    {
+        std::mutex mutex;
+        std::unordered_map<const TypeIdentifier*, const TypeObject*> objects; // EK_MINIMAL
+        std::unordered_map<const TypeIdentifier*, const TypeObject*> complete_objects; // EK_COMPLETE
+    };
+
+    mutable std::array<NameShard, SHARD_COUNT> name_shards_;
+    mutable std::array<IdentifierShard, SHARD_COUNT> identifier_shards_;
+    mutable std::array<ObjectShard, SHARD_COUNT> object_shards_;
+    mutable std::mutex m_MutexCreated;
     mutable std::recursive_mutex m_MutexInformations;
 
+    NameShard& name_shard(
+            const std::string& type_name) const;
+
+    ObjectShard& object_shard(
+            const TypeIdentifier* identifier) const;
+
+    /**
+     * @brief Stores a name for a TypeIdentifier, keeping the reverse index up to date.
+     * @param type_name
+     * @param identifier
+     * @param complete Whether the name is stored on the complete identifiers.
+     * @param overwrite Whether a previous identifier stored with the same name is replaced.
+     * @return true if the identifier was stored.
+     */
+    bool store_identifier(
+            const std::string& type_name,
+            const TypeIdentifier* identifier,
+            bool complete,
+            bool overwrite);
+
+    void index_identifier(
+            const TypeIdentifier* identifier,
+            const std::string* type_name,
+            bool complete) const;
+
+    void unindex_identifier(
+            const TypeIdentifier* identifier,
+            const std::string* type_name,
+            bool complete) const;
+
+    /**
+     * @brief Looks for a stored TypeIdentifier equal to the given one, using the reverse index.
+     * @param identifier
+     * @param type_name If not nullptr, filled with the name of the stored identifier.
+     * @return The stored identifier, or nullptr if there is none.
+     */
+    const TypeIdentifier* find_stored_type_identifier(
+            const TypeIdentifier* identifier,
+            std::string* type_name) const;
+
+    const TypeIdentifier* find_type_identifier(
+            const std::string& type_name,
+            bool complete) const;
+
+    void store_type_object(
+            const TypeIdentifier* identifier,
+            const TypeObject* object);
+
 protected:
     TypeObjectFactory();
-    mutable std::map<const std::string, const TypeIdentifier*> identifiers_; // Basic, builtin and EK_MINIMAL
-    std::map<const std::string, const TypeIdentifier*> complete_identifiers_; // Only EK_COMPLETE
-    std::map<const TypeIdentifier*, const TypeObject*> objects_; // EK_MINIMAL
-    std::map<const TypeIdentifier*, const TypeObject*> complete_objects_; // EK_COMPLETE
     mutable std::vector<TypeIdentifier*> identifiers_created_;
     mutable std::map<const TypeIdentifier*, TypeInformation*> informations_;
     mutable std::vector<TypeInformation*> informations_created_;
-    std::map<std::string, std::string> aliases_; // Aliases
 
     DynamicType_ptr build_dynamic_type(
             TypeDescriptor& descriptor,
@@ -207,13 +290,9 @@ public:
             const TypeIdentifier* identifier,
             const TypeObject* object);
 
-    RTPS_DllAPI inline void add_alias(
+    RTPS_DllAPI void add_alias(
             const std::string& alias_name,
-            const std::string& target_type)
-    {
-        std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-        aliases_.emplace(std::pair<std::string, std::string>(alias_name, target_type));
-    }
+            const std::string& target_type);
 
     /**
      * @brief Returns a TypeIdentifierWithSizeSeq object filled with the dependencies of the
@@ -0,0 +1,193 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ResourceLimitedHashMap.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHMAP_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHMAP_HPP_
+
+#include "ResourceLimitedHashTable.hpp"
+
+#include <tuple>
+
+namespace eprosima {
+namespace fastrtps {
+
+namespace detail {
+
+template<typename _Key, typename _Ty>
+struct pair_key_of
+{
+    const _Key& operator ()(
+            const std::pair<_Key, _Ty>& value) const
+    {
+        return value.first;
+    }
+
+};
+
+} // namespace detail
+
+/**
+ * Resource limited hash map.
+ *
+ * This template class holds an unordered collection of key-value pairs with unique keys.
+ * It makes use of a \ref ResourceLimitedContainerConfig to setup the allocation behaviour regarding the number of
+ * elements in the collection, and performs no allocations while the number of elements does not exceed the
+ * initial value of the configuration.
+ *
+ * Elements are stored contiguously and indexed with open addressing, see detail::ResourceLimitedHashTable.
+ * Insertions may invalidate all iterators, and removals invalidate the iterators to the removed and the last
+ * elements. The key of an element must not be modified through an iterator.
+ *
+ * @tparam _Key           Key type.
+ * @tparam _Ty            Mapped type.
+ * @tparam _Hash          Hash functor for the keys, defaults to std::hash<_Key>.
+ * @tparam _KeyEqual      Equality functor for the keys, defaults to std::equal_to<_Key>.
+ * @tparam _LimitsConfig  Type defining the resource limits configuration,
+ *                        defaults to ResourceLimitedContainerConfig
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Key,
+    typename _Ty,
+    typename _Hash = std::hash<_Key>,
+    typename _KeyEqual = std::equal_to<_Key>,
+    typename _LimitsConfig = ResourceLimitedContainerConfig>
+class ResourceLimitedHashMap
+    : public detail::ResourceLimitedHashTable<
+        _Key,
+        std::pair<_Key, _Ty>,
+        detail::pair_key_of<_Key, _Ty>,
+        _Hash,
+        _KeyEqual,
+        _LimitsConfig>
+{
+    using base_class = detail::ResourceLimitedHashTable<
+        _Key,
+        std::pair<_Key, _Ty>,
+        detail::pair_key_of<_Key, _Ty>,
+        _Hash,
+        _KeyEqual,
+        _LimitsConfig>;
+
+public:
+
+    using mapped_type = _Ty;
+    using typename base_class::configuration_type;
+    using typename base_class::key_type;
+    using typename base_class::value_type;
+    using typename base_class::hasher;
+    using typename base_class::key_equal;
+    using typename base_class::size_type;
+    using typename base_class::iterator;
+    using typename base_class::const_iterator;
+
+    /**
+     * Construct a ResourceLimitedHashMap.
+     *
+     * The cfg parameter indicates the initial number of elements to be reserved, the maximum number of elements
+     * allowed, and the capacity increment value.
+     *
+     * @param cfg   Resource limits configuration to use.
+     * @param hash  Hash functor.
+     * @param equal Key equality functor.
+     */
+    explicit ResourceLimitedHashMap(
+            configuration_type cfg = configuration_type(),
+            const hasher& hash = hasher(),
+            const key_equal& equal = key_equal())
+        : base_class(cfg, hash, equal)
+    {
+    }
+
+    /**
+     * Insert an element.
+     *
+     * @param value Key-value pair to insert.
+     *
+     * @return Pair with the iterator to the element with the given key and a boolean indicating whether the element
+     *         was inserted. The iterator is end() if the resource limit is reached.
+     */
+    std::pair<iterator, bool> insert(
+            const value_type& value)
+    {
+        return base_class::emplace_unique(value.first, value);
+    }
+
+    /**
+     * Insert an element.
+     *
+     * @param value Key-value pair to move into the map.
+     *
+     * @return Pair with the iterator to the element with the given key and a boolean indicating whether the element
+     *         was inserted. The iterator is end() if the resource limit is reached.
+     */
+    std::pair<iterator, bool> insert(
+            value_type&& value)
+    {
+        key_type key = value.first;
+        return base_class::emplace_unique(key, std::move(value));
+    }
+
+    /**
+     * Insert an element constructed in place if the key does not exist.
+     *
+     * @param key   Key of the element.
+     * @param args  Arguments forwarded to construct the mapped value.
+     *
+     * @return Pair with the iterator to the element with the given key and a boolean indicating whether the element
+     *         was inserted. The iterator is end() if the resource limit is reached.
+     */
+    template<typename ... Args>
+    std::pair<iterator, bool> try_emplace(
+            const key_type& key,
+            Args&& ... args)
+    {
+        return base_class::emplace_unique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                       std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Insert an element, or assign the mapped value if the key already exists.
+     *
+     * @param key   Key of the element.
+     * @param obj   Mapped value to insert or assign.
+     *
+     * @return Pair with the iterator to the element with the given key and a boolean indicating whether the element
+     *         was inserted. The iterator is end() if the resource limit is reached.
+     */
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(
+            const key_type& key,
+            M&& obj)
+    {
+        std::pair<iterator, bool> ret_val = try_emplace(key, std::forward<M>(obj));
+        if (!ret_val.second && ret_val.first != this->end())
+        {
+            ret_val.first->second = std::forward<M>(obj);
+        }
+        return ret_val;
+    }
+
+};
+
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHMAP_HPP_ */
@@ -0,0 +1,175 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ResourceLimitedHashSet.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHSET_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHSET_HPP_
+
+#include "ResourceLimitedHashTable.hpp"
+
+namespace eprosima {
+namespace fastrtps {
+
+namespace detail {
+
+template<typename _Key>
+struct identity_key_of
+{
+    const _Key& operator ()(
+            const _Key& value) const
+    {
+        return value;
+    }
+
+};
+
+} // namespace detail
+
+/**
+ * Resource limited hash set.
+ *
+ * This template class holds an unordered collection of unique keys.
+ * It makes use of a \ref ResourceLimitedContainerConfig to setup the allocation behaviour regarding the number of
+ * elements in the collection, and performs no allocations while the number of elements does not exceed the
+ * initial value of the configuration.
+ *
+ * Elements are stored contiguously and indexed with open addressing, see detail::ResourceLimitedHashTable.
+ * Insertions may invalidate all iterators, and removals invalidate the iterators to the removed and the last
+ * elements.
+ *
+ * @tparam _Key           Key type.
+ * @tparam _Hash          Hash functor for the keys, defaults to std::hash<_Key>.
+ * @tparam _KeyEqual      Equality functor for the keys, defaults to std::equal_to<_Key>.
+ * @tparam _LimitsConfig  Type defining the resource limits configuration,
+ *                        defaults to ResourceLimitedContainerConfig
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Key,
+    typename _Hash = std::hash<_Key>,
+    typename _KeyEqual = std::equal_to<_Key>,
+    typename _LimitsConfig = ResourceLimitedContainerConfig>
+class ResourceLimitedHashSet
+    : protected detail::ResourceLimitedHashTable<
+        _Key,
+        _Key,
+        detail::identity_key_of<_Key>,
+        _Hash,
+        _KeyEqual,
+        _LimitsConfig>
+{
+    using base_class = detail::ResourceLimitedHashTable<
+        _Key,
+        _Key,
+        detail::identity_key_of<_Key>,
+        _Hash,
+        _KeyEqual,
+        _LimitsConfig>;
+
+public:
+
+    using typename base_class::configuration_type;
+    using typename base_class::key_type;
+    using typename base_class::value_type;
+    using typename base_class::hasher;
+    using typename base_class::key_equal;
+    using typename base_class::size_type;
+    // Keys cannot be modified through iterators
+    using iterator = typename base_class::const_iterator;
+    using const_iterator = typename base_class::const_iterator;
+
+    /**
+     * Construct a ResourceLimitedHashSet.
+     *
+     * The cfg parameter indicates the initial number of elements to be reserved, the maximum number of elements
+     * allowed, and the capacity increment value.
+     *
+     * @param cfg   Resource limits configuration to use.
+     * @param hash  Hash functor.
+     * @param equal Key equality functor.
+     */
+    explicit ResourceLimitedHashSet(
+            configuration_type cfg = configuration_type(),
+            const hasher& hash = hasher(),
+            const key_equal& equal = key_equal())
+        : base_class(cfg, hash, equal)
+    {
+    }
+
+    /**
+     * Insert an element.
+     *
+     * @param key Key to insert.
+     *
+     * @return Pair with the iterator to the element with the given key and a boolean indicating whether the element
+     *         was inserted. The iterator is end() if the resource limit is reached.
+     */
+    std::pair<iterator, bool> insert(
+            const key_type& key)
+    {
+        auto ret_val = base_class::emplace_unique(key, key);
+        return { ret_val.first, ret_val.second };
+    }
+
+    iterator find(
+            const key_type& key) const
+    {
+        return base_class::find(key);
+    }
+
+    iterator erase(
+            const_iterator pos)
+    {
+        return base_class::erase(pos);
+    }
+
+    using base_class::erase;
+    using base_class::count;
+    using base_class::clear;
+    using base_class::empty;
+    using base_class::size;
+    using base_class::capacity;
+    using base_class::max_size;
+
+    iterator begin() const noexcept
+    {
+        return base_class::cbegin();
+    }
+
+    iterator end() const noexcept
+    {
+        return base_class::cend();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return base_class::cbegin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return base_class::cend();
+    }
+
+};
+
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHSET_HPP_ */
@@ -0,0 +1,446 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ResourceLimitedHashTable.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHTABLE_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHTABLE_HPP_
+
+#include "ResourceLimitedContainerConfig.hpp"
+#include "ResourceLimitedVector.hpp"
+
+#include <assert.h>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace detail {
+
+/**
+ * Open addressing hash table backed by a ResourceLimitedVector.
+ *
+ * Elements are kept contiguous on a \ref ResourceLimitedVector, which makes iteration as fast as on a vector, and
+ * they are indexed by a table of slots using linear probing. Each slot holds the position of an element and 32 bits
+ * of its hash, so most probes are resolved without touching the elements. Erased slots are filled by shifting back
+ * the following ones, so there are no tombstones and lookups never degrade.
+ *
+ * The table of slots always has a power of two size, at least twice the capacity of the elements vector. Both are
+ * allocated when the capacity of the vector grows, following the \ref ResourceLimitedContainerConfig, so no
+ * allocations are performed while the number of elements stays below the initial value of the configuration.
+ *
+ * Removing an element moves the last one into its position, so the order of the elements is not kept and
+ * iterators to the last element are invalidated.
+ *
+ * @tparam _Key          Key type.
+ * @tparam _Ty           Element type.
+ * @tparam _KeyOfValue   Functor returning a reference to the key of an element.
+ * @tparam _Hash         Hash functor for the keys.
+ * @tparam _KeyEqual     Equality functor for the keys.
+ * @tparam _LimitsConfig Type defining the resource limits configuration.
+ */
+template <
+    typename _Key,
+    typename _Ty,
+    typename _KeyOfValue,
+    typename _Hash,
+    typename _KeyEqual,
+    typename _LimitsConfig>
+class ResourceLimitedHashTable
+{
+public:
+
+    using configuration_type = _LimitsConfig;
+    using collection_type = ResourceLimitedVector<_Ty, std::false_type, _LimitsConfig>;
+    using key_type = _Key;
+    using value_type = _Ty;
+    using hasher = _Hash;
+    using key_equal = _KeyEqual;
+    using size_type = typename collection_type::size_type;
+    using iterator = typename collection_type::iterator;
+    using const_iterator = typename collection_type::const_iterator;
+
+    /**
+     * Construct a ResourceLimitedHashTable.
+     *
+     * @param cfg   Resource limits configuration to use.
+     * @param hash  Hash functor.
+     * @param equal Key equality functor.
+     */
+    explicit ResourceLimitedHashTable(
+            configuration_type cfg = configuration_type(),
+            const hasher& hash = hasher(),
+            const key_equal& equal = key_equal())
+        : hash_(hash)
+        , equal_(equal)
+        , collection_(cfg)
+    {
+        rehash();
+    }
+
+    ResourceLimitedHashTable(
+            const ResourceLimitedHashTable& other) = default;
+
+    ResourceLimitedHashTable& operator = (
+            const ResourceLimitedHashTable& other)
+    {
+        hash_ = other.hash_;
+        equal_ = other.equal_;
+        collection_ = other.collection_;
+
+        // The capacity of the elements vector may differ from the one on other, so the slots are rebuilt
+        slots_.clear();
+        rehash();
+        return *this;
+    }
+
+    /**
+     * Find an element.
+     * @param key Key of the element to find.
+     * @return Iterator to the element, or end() if there is no element with the given key.
+     */
+    iterator find(
+            const key_type& key)
+    {
+        size_t slot = find_slot(key, hash_key(key));
+        return slot == npos ? collection_.end() : collection_.begin() + slots_[slot].index;
+    }
+
+    /**
+     * Find an element.
+     * @param key Key of the element to find.
+     * @return Iterator to the element, or end() if there is no element with the given key.
+     */
+    const_iterator find(
+            const key_type& key) const
+    {
+        size_t slot = find_slot(key, hash_key(key));
+        return slot == npos ? collection_.end() : collection_.begin() + slots_[slot].index;
+    }
+
+    /**
+     * Count the elements with a key.
+     * @param key Key of the elements to count.
+     * @return 1 if there is an element with the given key, 0 otherwise.
+     */
+    size_type count(
+            const key_type& key) const
+    {
+        return find_slot(key, hash_key(key)) == npos ? 0u : 1u;
+    }
+
+    /**
+     * Remove an element.
+     * @param pos Iterator to the element to remove.
+     * @return Iterator to the element that took the place of the removed one, which may be end().
+     */
+    iterator erase(
+            const_iterator pos)
+    {
+        size_type index = static_cast<size_type>(pos - collection_.cbegin());
+        const key_type& key = key_of_(*pos);
+        size_t slot = find_slot(key, hash_key(key));
+        assert(slot != npos);
+        do_erase(slot);
+        return collection_.begin() + index;
+    }
+
+    /**
+     * Remove an element.
+     * @param key Key of the element to remove.
+     * @return Number of elements removed.
+     */
+    size_type erase(
+            const key_type& key)
+    {
+        size_t slot = find_slot(key, hash_key(key));
+        if (slot == npos)
+        {
+            return 0u;
+        }
+
+        do_erase(slot);
+        return 1u;
+    }
+
+    /**
+     * Remove all the elements.
+     * The memory is kept for future insertions.
+     */
+    void clear()
+    {
+        collection_.clear();
+        for (Slot& slot : slots_)
+        {
+            slot.index = empty_index;
+        }
+    }
+
+    iterator begin() noexcept
+    {
+        return collection_.begin();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return collection_.begin();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return collection_.cbegin();
+    }
+
+    iterator end() noexcept
+    {
+        return collection_.end();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return collection_.end();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return collection_.cend();
+    }
+
+    bool empty() const noexcept
+    {
+        return collection_.empty();
+    }
+
+    size_type size() const noexcept
+    {
+        return collection_.size();
+    }
+
+    size_type capacity() const noexcept
+    {
+        return collection_.capacity();
+    }
+
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>(collection_.max_size(), empty_index);
+    }
+
+protected:
+
+    /**
+     * Insert an element if its key is not on the table.
+     * @param key   Key of the element.
+     * @param args  Arguments forwarded to construct the element.
+     * @return Pair with the iterator to the element with the given key and a boolean indicating whether the element
+     *         was inserted. The iterator is end() if the resource limit is reached.
+     */
+    template<typename ... Args>
+    std::pair<iterator, bool> emplace_unique(
+            const key_type& key,
+            Args&& ... args)
+    {
+        uint32_t hash = hash_key(key);
+        size_t slot = find_slot(key, hash);
+        if (slot != npos)
+        {
+            return { collection_.begin() + slots_[slot].index, false };
+        }
+
+        size_type index = collection_.size();
+        size_type capacity = collection_.capacity();
+        if (index >= max_size() || collection_.emplace_back(std::forward<Args>(args)...) == nullptr)
+        {
+            return { collection_.end(), false };
+        }
+
+        if (capacity != collection_.capacity())
+        {
+            // Capacity of the elements vector has grown, the table of slots may need to grow too
+            rehash();
+        }
+        else
+        {
+            slots_[free_slot(hash)] = { hash, static_cast<uint32_t>(index) };
+        }
+
+        return { collection_.begin() + index, true };
+    }
+
+private:
+
+    struct Slot
+    {
+        uint32_t hash;
+        uint32_t index;
+    };
+
+    static constexpr uint32_t empty_index = std::numeric_limits<uint32_t>::max();
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    uint32_t hash_key(
+            const key_type& key) const
+    {
+        // Fibonacci hashing, spreads the bits of weak hashes (e.g. identity) to the whole result
+        uint64_t hash = static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<uint32_t>(hash >> 32);
+    }
+
+    size_t find_slot(
+            const key_type& key,
+            uint32_t hash) const
+    {
+        if (slots_.empty())
+        {
+            return npos;
+        }
+
+        size_t mask = slots_.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            const Slot& slot = slots_[i];
+            if (slot.index == empty_index)
+            {
+                return npos;
+            }
+            if (slot.hash == hash && equal_(key_of_(collection_[slot.index]), key))
+            {
+                return i;
+            }
+        }
+    }
+
+    size_t free_slot(
+            uint32_t hash) const
+    {
+        size_t mask = slots_.size() - 1;
+        size_t i = hash & mask;
+        while (slots_[i].index != empty_index)
+        {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    void do_erase(
+            size_t slot)
+    {
+        size_t mask = slots_.size() - 1;
+        uint32_t index = slots_[slot].index;
+
+        // Shift back the following slots of the cluster which would be unreachable after the removal
+        size_t hole = slot;
+        for (size_t i = (slot + 1) & mask; slots_[i].index != empty_index; i = (i + 1) & mask)
+        {
+            size_t ideal = slots_[i].hash & mask;
+            if (((i - ideal) & mask) >= ((i - hole) & mask))
+            {
+                slots_[hole] = slots_[i];
+                hole = i;
+            }
+        }
+        slots_[hole].index = empty_index;
+
+        // Move the last element into the removed position
+        uint32_t last = static_cast<uint32_t>(collection_.size() - 1);
+        if (index != last)
+        {
+            slots_[find_index(hash_key(key_of_(collection_[last])), last)].index = index;
+            collection_[index] = std::move(collection_[last]);
+        }
+        collection_.pop_back();
+    }
+
+    size_t find_index(
+            uint32_t hash,
+            uint32_t index) const
+    {
+        size_t mask = slots_.size() - 1;
+        size_t i = hash & mask;
+        while (slots_[i].index != index)
+        {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    void rehash()
+    {
+        size_type capacity = collection_.capacity();
+        if (capacity == 0)
+        {
+            return;
+        }
+
+        // Keep load factor below 0.5
+        size_t size = slots_.empty() ? 8u : slots_.size();
+        while (size < 2 * capacity)
+        {
+            size *= 2;
+        }
+
+        if (size != slots_.size())
+        {
+            slots_.assign(size, Slot{ 0u, empty_index });
+            for (size_type i = 0; i < collection_.size(); ++i)
+            {
+                uint32_t hash = hash_key(key_of_(collection_[i]));
+                slots_[free_slot(hash)] = { hash, static_cast<uint32_t>(i) };
+            }
+        }
+        else
+        {
+            // Same table, only the last inserted element needs a slot
+            size_type i = collection_.size() - 1;
+            uint32_t hash = hash_key(key_of_(collection_[i]));
+            slots_[free_slot(hash)] = { hash, static_cast<uint32_t>(i) };
+        }
+    }
+
+    hasher hash_;
+    key_equal equal_;
+    _KeyOfValue key_of_;
+    collection_type collection_;
+    std::vector<Slot> slots_;
+};
+
+template <
+    typename _Key,
+    typename _Ty,
+    typename _KeyOfValue,
+    typename _Hash,
+    typename _KeyEqual,
+    typename _LimitsConfig>
+constexpr uint32_t ResourceLimitedHashTable<_Key, _Ty, _KeyOfValue, _Hash, _KeyEqual, _LimitsConfig>::empty_index;
+
+template <
+    typename _Key,
+    typename _Ty,
+    typename _KeyOfValue,
+    typename _Hash,
+    typename _KeyEqual,
+    typename _LimitsConfig>
+constexpr size_t ResourceLimitedHashTable<_Key, _Ty, _KeyOfValue, _Hash, _KeyEqual, _LimitsConfig>::npos;
+
+}  // namespace detail
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_RESOURCELIMITEDHASHTABLE_HPP_ */
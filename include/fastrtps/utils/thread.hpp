@@ -0,0 +1,213 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file thread.hpp
+ */
+
+#ifndef _FASTRTPS_UTILS_THREAD_HPP_
+#define _FASTRTPS_UTILS_THREAD_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#include <thread>
+#else
+#include <pthread.h>
+#endif // if defined(_WIN32)
+
+namespace eprosima {
+
+/**
+ * Thread of execution started with an explicit stack size.
+ *
+ * std::thread always uses the default attributes of the process, so the stack size of the threads it starts can
+ * only be changed process-wide. This class creates each thread with its own attributes instead.
+ * On Windows it relies on std::thread, and the stack size is ignored.
+ *
+ * As with std::thread, a joinable thread should be joined or detached before being destroyed.
+ */
+class thread
+{
+public:
+
+    thread() = default;
+
+    /**
+     * Start a thread.
+     * @param stack_size Stack size of the thread, in bytes. The default one is used when it is not positive or
+     * it is not accepted by the system.
+     * @param func Functor run by the thread.
+     * @throw std::system_error if the thread cannot be started.
+     */
+    template<typename Functor>
+    thread(
+            int32_t stack_size,
+            Functor&& func)
+    {
+#if defined(_WIN32)
+        (void)stack_size;
+        thread_ = std::thread(std::forward<Functor>(func));
+#else
+        using Callable = typename std::decay<Functor>::type;
+        std::unique_ptr<Callable> callable(new Callable(std::forward<Functor>(func)));
+
+        pthread_attr_t attr;
+        int result = pthread_attr_init(&attr);
+        if (0 == result)
+        {
+            if (stack_size > 0)
+            {
+                // Keep the default stack size when the requested one is not valid
+                pthread_attr_setstacksize(&attr, static_cast<size_t>(stack_size));
+            }
+            result = pthread_create(&handle_, &attr, &thread::run<Callable>, callable.get());
+            pthread_attr_destroy(&attr);
+        }
+
+        if (0 != result)
+        {
+            throw std::system_error(result, std::generic_category(), "Cannot start thread");
+        }
+
+        // Owned by the thread from now on
+        callable.release();
+        joinable_ = true;
+#endif // if defined(_WIN32)
+    }
+
+    ~thread()
+    {
+        if (joinable())
+        {
+            std::terminate();
+        }
+    }
+
+    thread(
+            const thread&) = delete;
+
+    thread& operator =(
+            const thread&) = delete;
+
+    thread(
+            thread&& other) noexcept
+    {
+        swap(other);
+    }
+
+    thread& operator =(
+            thread&& other) noexcept
+    {
+        if (joinable())
+        {
+            std::terminate();
+        }
+        swap(other);
+        return *this;
+    }
+
+    void swap(
+            thread& other) noexcept
+    {
+#if defined(_WIN32)
+        thread_.swap(other.thread_);
+#else
+        std::swap(handle_, other.handle_);
+        std::swap(joinable_, other.joinable_);
+#endif // if defined(_WIN32)
+    }
+
+    bool joinable() const
+    {
+#if defined(_WIN32)
+        return thread_.joinable();
+#else
+        return joinable_;
+#endif // if defined(_WIN32)
+    }
+
+    void join()
+    {
+#if defined(_WIN32)
+        thread_.join();
+#else
+        if (!joinable_)
+        {
+            throw std::system_error(std::make_error_code(std::errc::invalid_argument), "Thread is not joinable");
+        }
+        int result = pthread_join(handle_, nullptr);
+        if (0 != result)
+        {
+            throw std::system_error(result, std::generic_category(), "Cannot join thread");
+        }
+        joinable_ = false;
+#endif // if defined(_WIN32)
+    }
+
+    void detach()
+    {
+#if defined(_WIN32)
+        thread_.detach();
+#else
+        if (!joinable_)
+        {
+            throw std::system_error(std::make_error_code(std::errc::invalid_argument), "Thread is not joinable");
+        }
+        pthread_detach(handle_);
+        joinable_ = false;
+#endif // if defined(_WIN32)
+    }
+
+    //! @return true if this object represents the thread calling this method.
+    bool is_calling_thread() const
+    {
+#if defined(_WIN32)
+        return thread_.get_id() == std::this_thread::get_id();
+#else
+        return joinable_ && (0 != pthread_equal(handle_, pthread_self()));
+#endif // if defined(_WIN32)
+    }
+
+private:
+
+#if defined(_WIN32)
+    std::thread thread_;
+#else
+    template<typename Callable>
+    static void* run(
+            void* arg)
+    {
+        std::unique_ptr<Callable> callable(static_cast<Callable*>(arg));
+        (*callable)();
+        return nullptr;
+    }
+
+    pthread_t handle_ = pthread_t();
+
+    bool joinable_ = false;
+#endif // if defined(_WIN32)
+};
+
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTRTPS_UTILS_THREAD_HPP_
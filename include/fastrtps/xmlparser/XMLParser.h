@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include <fastrtps/transport/TransportDescriptorInterface.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/attributes/ParticipantAttributes.h>
 #include <fastrtps/attributes/PublisherAttributes.h>
 #include <fastrtps/attributes/SubscriberAttributes.h>
@@ -508,6 +509,11 @@ protected:
         rtps::SendBuffersAllocationAttributes& allocation,
         uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLThreadSettings(
+            tinyxml2::XMLElement* elem,
+            fastdds::rtps::ThreadSettings& settings,
+            uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLDiscoverySettings(
             tinyxml2::XMLElement* elem,
             rtps::DiscoverySettings& settings,
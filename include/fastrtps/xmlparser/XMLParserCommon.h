@@ -78,9 +78,13 @@ extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
 extern const char* SEGMENT_OVERFLOW_POLICY;
 extern const char* HEALTHY_CHECK_TIMEOUT_MS;
+extern const char* BUSY_POLL_US;
+extern const char* BUFFER_SLAB_SIZE;
+extern const char* HUGE_PAGES;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
+extern const char* RECEPTION_THREADS;
 
 // IntraprocessDeliveryType
 extern const char* OFF;
@@ -125,6 +129,8 @@ extern const char* TOTAL_PARTICIPANTS;
 extern const char* TOTAL_READERS;
 extern const char* TOTAL_WRITERS;
 extern const char* SEND_BUFFERS;
+extern const char* TIMED_EVENTS_THREAD;
+extern const char* ASYNC_WRITER_THREAD;
 extern const char* PREALLOCATED_NUMBER;
 extern const char* DYNAMIC_LC;
 extern const char* MAX_PROPERTIES;
@@ -157,6 +163,7 @@ extern const char* PREALLOCATED;
 extern const char* PREALLOCATED_WITH_REALLOC;
 extern const char* DYNAMIC;
 extern const char* DYNAMIC_REUSABLE;
+extern const char* DYNAMIC_SLAB;
 extern const char* LOCATOR;
 extern const char* UDPv4_LOCATOR;
 extern const char* UDPv6_LOCATOR;
@@ -379,6 +386,13 @@ extern const char* BASE_TYPE;
 extern const char* USE_DEFAULT;
 extern const char* CONSUMER;
 extern const char* CLASS;
+extern const char* THREAD_SETTINGS;
+
+// Thread settings
+extern const char* SCHEDULING_POLICY;
+extern const char* PRIORITY;
+extern const char* AFFINITY;
+extern const char* STACK_SIZE;
 
 // Allocation config
 extern const char* INITIAL;
@@ -28,6 +28,8 @@
 #include <locale>
 #include <codecvt>
 
+#include "DynamicTypeSerializationPlan.hpp"
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -5505,6 +5507,13 @@ bool DynamicData::deserialize(
                 }
             }
 #else
+            std::shared_ptr<const DynamicTypeSerializationPlan> plan = get_compiled_plan();
+            if (plan != nullptr)
+            {
+                deserialize_compiled(*plan, cdr);
+                break;
+            }
+
             //uint32_t size(static_cast<uint32_t>(values_.size())), memberId(MEMBER_ID_INVALID);
             for (uint32_t i = 0; i < values_.size(); ++i)
             {
@@ -5898,6 +5907,13 @@ size_t DynamicData::getCdrSerializedSize(
             }
 
 #else
+            std::shared_ptr<const DynamicTypeSerializationPlan> plan = data->get_compiled_plan();
+            if (plan != nullptr)
+            {
+                current_alignment += getCompiledCdrSerializedSize(data, *plan, current_alignment);
+                break;
+            }
+
             //for (auto it = data->values_.begin(); it != data->values_.end(); ++it)
             //{
             //    current_alignment += getCdrSerializedSize((DynamicData*)it->second, current_alignment);
@@ -6396,6 +6412,13 @@ void DynamicData::serialize(
                 }
             }
 #else
+            std::shared_ptr<const DynamicTypeSerializationPlan> plan = get_compiled_plan();
+            if (plan != nullptr)
+            {
+                serialize_compiled(*plan, cdr);
+                break;
+            }
+
             for (uint32_t idx = 0; idx < static_cast<uint32_t>(values_.size()); ++idx)
             {
                 auto d_it = descriptors_.find(idx);
@@ -6460,6 +6483,158 @@ void DynamicData::serialize(
     }
 }
 
+#ifndef DYNAMIC_TYPES_CHECKING
+std::shared_ptr<const DynamicTypeSerializationPlan> DynamicData::get_compiled_plan() const
+{
+    if (type_ == nullptr || type_->get_kind() != TK_STRUCTURE)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<const DynamicTypeSerializationPlan> plan = type_->get_serialization_plan();
+    // Every member must have its value created, as the plan walks them in order.
+    if (!plan->compiled || plan->ops.size() != values_.size())
+    {
+        return nullptr;
+    }
+    return plan;
+}
+
+void DynamicData::serialize_compiled(
+        const DynamicTypeSerializationPlan& plan,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    auto it = values_.begin();
+    for (const DynamicTypeSerializationPlan::Op& op : plan.ops)
+    {
+        const DynamicData* member = (const DynamicData*)(it++)->second;
+        switch (op.code)
+        {
+            case DynamicTypeSerializationPlan::OP_SKIP:
+                break;
+            case DynamicTypeSerializationPlan::OP_PRIMITIVE:
+            {
+                const void* value = member->values_.begin()->second;
+                switch (op.kind)
+                {
+                    case TK_INT32: cdr << *((const int32_t*)value); break;
+                    case TK_UINT32: case TK_ENUM: cdr << *((const uint32_t*)value); break;
+                    case TK_INT16: cdr << *((const int16_t*)value); break;
+                    case TK_UINT16: cdr << *((const uint16_t*)value); break;
+                    case TK_INT64: cdr << *((const int64_t*)value); break;
+                    case TK_UINT64: cdr << *((const uint64_t*)value); break;
+                    case TK_FLOAT32: cdr << *((const float*)value); break;
+                    case TK_FLOAT64: cdr << *((const double*)value); break;
+                    case TK_FLOAT128: cdr << *((const long double*)value); break;
+                    case TK_CHAR8: cdr << *((const char*)value); break;
+                    case TK_CHAR16: cdr << *((const wchar_t*)value); break;
+                    case TK_BOOLEAN: cdr << *((const bool*)value); break;
+                    case TK_BYTE: cdr << *((const octet*)value); break;
+                    default: break;
+                }
+                break;
+            }
+            case DynamicTypeSerializationPlan::OP_STRING8:
+                cdr << *((const std::string*)member->values_.begin()->second);
+                break;
+            case DynamicTypeSerializationPlan::OP_STRING16:
+                cdr << *((const std::wstring*)member->values_.begin()->second);
+                break;
+            case DynamicTypeSerializationPlan::OP_NESTED:
+                member->serialize(cdr);
+                break;
+        }
+    }
+}
+
+void DynamicData::deserialize_compiled(
+        const DynamicTypeSerializationPlan& plan,
+        eprosima::fastcdr::Cdr& cdr)
+{
+    auto it = values_.begin();
+    for (const DynamicTypeSerializationPlan::Op& op : plan.ops)
+    {
+        DynamicData* member = (DynamicData*)(it++)->second;
+        switch (op.code)
+        {
+            case DynamicTypeSerializationPlan::OP_SKIP:
+                break;
+            case DynamicTypeSerializationPlan::OP_PRIMITIVE:
+            {
+                void* value = member->values_.begin()->second;
+                switch (op.kind)
+                {
+                    case TK_INT32: cdr >> *((int32_t*)value); break;
+                    case TK_UINT32: case TK_ENUM: cdr >> *((uint32_t*)value); break;
+                    case TK_INT16: cdr >> *((int16_t*)value); break;
+                    case TK_UINT16: cdr >> *((uint16_t*)value); break;
+                    case TK_INT64: cdr >> *((int64_t*)value); break;
+                    case TK_UINT64: cdr >> *((uint64_t*)value); break;
+                    case TK_FLOAT32: cdr >> *((float*)value); break;
+                    case TK_FLOAT64: cdr >> *((double*)value); break;
+                    case TK_FLOAT128: cdr >> *((long double*)value); break;
+                    case TK_CHAR8: cdr >> *((char*)value); break;
+                    case TK_CHAR16: cdr >> *((wchar_t*)value); break;
+                    case TK_BOOLEAN: cdr >> *((bool*)value); break;
+                    case TK_BYTE: cdr >> *((octet*)value); break;
+                    default: break;
+                }
+                break;
+            }
+            case DynamicTypeSerializationPlan::OP_STRING8:
+                cdr >> *((std::string*)member->values_.begin()->second);
+                break;
+            case DynamicTypeSerializationPlan::OP_STRING16:
+                cdr >> *((std::wstring*)member->values_.begin()->second);
+                break;
+            case DynamicTypeSerializationPlan::OP_NESTED:
+                member->deserialize(cdr);
+                break;
+        }
+    }
+}
+
+size_t DynamicData::getCompiledCdrSerializedSize(
+        const DynamicData* data,
+        const DynamicTypeSerializationPlan& plan,
+        size_t current_alignment)
+{
+    if (plan.fixed_size)
+    {
+        return plan.primitive_size(current_alignment);
+    }
+
+    size_t initial_alignment = current_alignment;
+    auto it = data->values_.begin();
+    for (const DynamicTypeSerializationPlan::Op& op : plan.ops)
+    {
+        const DynamicData* member = (const DynamicData*)(it++)->second;
+        switch (op.code)
+        {
+            case DynamicTypeSerializationPlan::OP_SKIP:
+                break;
+            case DynamicTypeSerializationPlan::OP_PRIMITIVE:
+                current_alignment += op.size + eprosima::fastcdr::Cdr::alignment(current_alignment, op.alignment);
+                break;
+            case DynamicTypeSerializationPlan::OP_STRING8:
+                // string content (length + characters + 1)
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4) +
+                        ((const std::string*)member->values_.begin()->second)->length() + 1;
+                break;
+            case DynamicTypeSerializationPlan::OP_STRING16:
+                // string content (length + (characters * 4) )
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4) +
+                        (((const std::wstring*)member->values_.begin()->second)->length() * 4);
+                break;
+            case DynamicTypeSerializationPlan::OP_NESTED:
+                current_alignment += getCdrSerializedSize(member, current_alignment);
+                break;
+        }
+    }
+    return current_alignment - initial_alignment;
+}
+#endif
+
 void DynamicData::serialize_discriminator(
         eprosima::fastcdr::Cdr& cdr) const
 {
@@ -22,6 +22,8 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <fastcdr/Cdr.h>
 
+#include <cstring>
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -29,12 +31,14 @@ namespace types {
 DynamicPubSubType::DynamicPubSubType()
     : dynamic_type_(nullptr)
     , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
 }
 
 DynamicPubSubType::DynamicPubSubType(DynamicType_ptr pType)
     : dynamic_type_(pType)
     , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
     UpdateDynamicTypeInfo();
 }
@@ -129,33 +133,29 @@ bool DynamicPubSubType::getKey(
         return false;
     }
     DynamicData* pDynamicData = (DynamicData*)data;
-    size_t keyBufferSize = static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_));
 
     if (m_keyBuffer == nullptr)
     {
-        m_keyBuffer = (unsigned char*)malloc(keyBufferSize > 16 ? keyBufferSize : 16);
-        memset(m_keyBuffer, 0, keyBufferSize > 16 ? keyBufferSize : 16);
+        m_keyBuffer = (unsigned char*)malloc(m_keyBufferSize > 16 ? m_keyBufferSize : 16);
+        memset(m_keyBuffer, 0, m_keyBufferSize > 16 ? m_keyBufferSize : 16);
     }
 
-    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, keyBufferSize);
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, m_keyBufferSize);
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
     pDynamicData->serializeKey(ser);
-    if (force_md5 || keyBufferSize > 16)
+    size_t key_length = ser.getSerializedDataLength();
+    if (force_md5 || m_keyBufferSize > 16)
     {
         m_md5.init();
-        m_md5.update(m_keyBuffer, (unsigned int)ser.getSerializedDataLength());
+        m_md5.update(m_keyBuffer, (unsigned int)key_length);
         m_md5.finalize();
-        for (uint8_t i = 0; i < 16; ++i)
-        {
-            handle->value[i] = m_md5.digest[i];
-        }
+        memcpy(handle->value, m_md5.digest, 16);
     }
     else
     {
-        for (uint8_t i = 0; i < 16; ++i)
-        {
-            handle->value[i] = m_keyBuffer[i];
-        }
+        // Keys shorter than the maximum are zero padded, ignoring what a previous key left on the buffer.
+        memset(m_keyBuffer + key_length, 0, 16 - key_length);
+        memcpy(handle->value, m_keyBuffer, 16);
     }
     return true;
 }
@@ -209,6 +209,14 @@ void DynamicPubSubType::UpdateDynamicTypeInfo()
         }
 
         m_typeSize = static_cast<uint32_t>(DynamicData::getMaxCdrSerializedSize(dynamic_type_) + 4);
+
+        // The key buffer is sized for the previous type, if any.
+        m_keyBufferSize = m_isGetKeyDefined ? DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_) : 0;
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+            m_keyBuffer = nullptr;
+        }
         setName(dynamic_type_->get_name().c_str());
     }
 }
@@ -22,6 +22,8 @@
 
 #include <dds/core/LengthUnlimited.hpp>
 
+#include "DynamicTypeSerializationPlan.hpp"
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -31,12 +33,14 @@ DynamicType::DynamicType()
     , name_("")
     , kind_(TK_NONE)
     , is_key_defined_(false)
+    , serialization_plan_(nullptr)
 {
 }
 
 DynamicType::DynamicType(
         const TypeDescriptor* descriptor)
     : is_key_defined_(false)
+    , serialization_plan_(nullptr)
 {
     descriptor_ = new TypeDescriptor(descriptor);
     try
@@ -67,6 +71,7 @@ DynamicType::DynamicType(
     , name_("")
     , kind_(TK_NONE)
     , is_key_defined_(false)
+    , serialization_plan_(nullptr)
 {
     copy_from_builder(other);
 }
@@ -126,6 +131,7 @@ ReturnCode_t DynamicType::apply_annotation_to_member(
         if (it != member_by_id_.end())
         {
             it->second->apply_annotation(descriptor);
+            reset_serialization_plan();
             return ReturnCode_t::RETCODE_OK;
         }
         else
@@ -151,6 +157,7 @@ ReturnCode_t DynamicType::apply_annotation_to_member(
     if (it != member_by_id_.end())
     {
         it->second->apply_annotation(annotation_name, key, value);
+        reset_serialization_plan();
         return ReturnCode_t::RETCODE_OK;
     }
     else
@@ -176,6 +183,7 @@ void DynamicType::clear()
     }
     member_by_id_.clear();
     member_by_name_.clear();
+    reset_serialization_plan();
 }
 
 ReturnCode_t DynamicType::copy_from_builder(
@@ -528,6 +536,124 @@ size_t DynamicType::get_size() const
     return 0;
 }
 
+std::shared_ptr<const DynamicTypeSerializationPlan> DynamicType::get_serialization_plan() const
+{
+    std::shared_ptr<const DynamicTypeSerializationPlan> current_plan = std::atomic_load(&serialization_plan_);
+    if (current_plan)
+    {
+        return current_plan;
+    }
+
+    std::lock_guard<std::mutex> guard(serialization_plan_mutex_);
+    current_plan = std::atomic_load(&serialization_plan_);
+    if (current_plan)
+    {
+        return current_plan;
+    }
+
+    std::shared_ptr<DynamicTypeSerializationPlan> plan = std::make_shared<DynamicTypeSerializationPlan>();
+
+    // Only plain structures are compiled. Inheritance and bitsets keep the generic path, as their members are not
+    // stored with consecutive identifiers starting at zero.
+    bool compilable = (kind_ == TK_STRUCTURE) && (descriptor_ != nullptr) &&
+            (descriptor_->get_base_type() == nullptr) && !descriptor_->annotation_is_non_serialized();
+    MemberId expected_id = 0;
+    bool fixed_size = true;
+    size_t current_alignment = 0;
+
+    for (auto it = member_by_id_.begin(); compilable && it != member_by_id_.end(); ++it, ++expected_id)
+    {
+        const MemberDescriptor* member = it->second->get_descriptor();
+        DynamicType_ptr member_type = member->get_type();
+        if (it->first != expected_id || member_type == nullptr)
+        {
+            compilable = false;
+            break;
+        }
+
+        DynamicTypeSerializationPlan::Op op;
+        op.id = it->first;
+        op.kind = member_type->get_kind();
+        op.code = DynamicTypeSerializationPlan::OP_PRIMITIVE;
+        op.size = 0;
+        op.alignment = 1;
+
+        if (member->annotation_is_non_serialized() || member_type->get_descriptor()->annotation_is_non_serialized())
+        {
+            op.code = DynamicTypeSerializationPlan::OP_SKIP;
+        }
+        else
+        {
+            switch (op.kind)
+            {
+                case TK_BOOLEAN: case TK_BYTE: case TK_CHAR8:
+                    op.size = 1;
+                    op.alignment = 1;
+                    break;
+                case TK_INT16: case TK_UINT16:
+                    op.size = 2;
+                    op.alignment = 2;
+                    break;
+                case TK_INT32: case TK_UINT32: case TK_FLOAT32: case TK_ENUM:
+                case TK_CHAR16: // WCHARS NEED 32 Bits on Linux & MacOS
+                    op.size = 4;
+                    op.alignment = 4;
+                    break;
+                case TK_INT64: case TK_UINT64: case TK_FLOAT64:
+                    op.size = 8;
+                    op.alignment = 8;
+                    break;
+                case TK_FLOAT128:
+                    op.size = 16;
+                    op.alignment = 8;
+                    break;
+                case TK_STRING8:
+                    op.code = DynamicTypeSerializationPlan::OP_STRING8;
+                    break;
+                case TK_STRING16:
+                    op.code = DynamicTypeSerializationPlan::OP_STRING16;
+                    break;
+                default:
+                    op.code = DynamicTypeSerializationPlan::OP_NESTED;
+                    break;
+            }
+        }
+
+        if (DynamicTypeSerializationPlan::OP_PRIMITIVE == op.code)
+        {
+            current_alignment += op.size + DynamicTypeSerializationPlan::padding(current_alignment, op.alignment);
+        }
+        else if (DynamicTypeSerializationPlan::OP_SKIP != op.code)
+        {
+            fixed_size = false;
+        }
+
+        plan->ops.push_back(op);
+    }
+
+    if (compilable)
+    {
+        plan->compiled = true;
+        plan->fixed_size = fixed_size;
+        plan->fixed_serialized_size = fixed_size ? current_alignment : 0;
+    }
+    else
+    {
+        plan->ops.clear();
+    }
+
+    current_plan = plan;
+    std::atomic_store(&serialization_plan_, current_plan);
+    return current_plan;
+}
+
+void DynamicType::reset_serialization_plan()
+{
+    // Threads serializing with the previous plan keep their own reference, so it is freed after they finish.
+    std::lock_guard<std::mutex> guard(serialization_plan_mutex_);
+    std::atomic_store(&serialization_plan_, std::shared_ptr<const DynamicTypeSerializationPlan>());
+}
+
 } // namespace types
 } // namespace fastrtps
 } // namespace eprosima
@@ -0,0 +1,117 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicTypeSerializationPlan.hpp
+ *
+ */
+
+#ifndef TYPES_DYNAMIC_TYPE_SERIALIZATION_PLAN_HPP
+#define TYPES_DYNAMIC_TYPE_SERIALIZATION_PLAN_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/types/TypesBase.h>
+
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * Flat list of operations describing how the members of a structure are written to the wire.
+ *
+ * It is compiled once per DynamicType (see DynamicType::get_serialization_plan) and shared by every DynamicData
+ * of that type, so serialize, deserialize and getCdrSerializedSize do not need to look up member descriptors
+ * nor dispatch on the member kind through the generic code path for each sample.
+ */
+struct DynamicTypeSerializationPlan
+{
+    enum OpCode : uint8_t
+    {
+        //! Member is not serialized (@non_serialized).
+        OP_SKIP,
+        //! Fixed size primitive, read and written in place.
+        OP_PRIMITIVE,
+        //! Narrow string.
+        OP_STRING8,
+        //! Wide string.
+        OP_STRING16,
+        //! Any other kind. The member DynamicData serializes itself.
+        OP_NESTED
+    };
+
+    struct Op
+    {
+        MemberId id;
+        TypeKind kind;
+        OpCode code;
+        //! Size on the wire of a primitive member.
+        uint8_t size;
+        //! Alignment on the wire of a primitive member.
+        uint8_t alignment;
+    };
+
+    //! Operations in member id order.
+    std::vector<Op> ops;
+
+    //! Whether the type could be compiled. When false the generic code path should be used.
+    bool compiled = false;
+
+    //! Whether all the serialized members are primitives, so the serialized size does not depend on the sample.
+    bool fixed_size = false;
+
+    //! Serialized size for an 8-aligned origin. Only valid when fixed_size is true.
+    size_t fixed_serialized_size = 0;
+
+    /**
+     * Computes the serialized size of the primitive members of the plan.
+     * Only valid when fixed_size is true.
+     * @param current_alignment Current position on the CDR buffer.
+     * @return Number of bytes the members take, including padding.
+     */
+    size_t primitive_size(
+            size_t current_alignment) const
+    {
+        if (0 == (current_alignment & 7u))
+        {
+            return fixed_serialized_size;
+        }
+
+        size_t initial_alignment = current_alignment;
+        for (const Op& op : ops)
+        {
+            if (OP_PRIMITIVE == op.code)
+            {
+                current_alignment += op.size + padding(current_alignment, op.alignment);
+            }
+        }
+        return current_alignment - initial_alignment;
+    }
+
+    static size_t padding(
+            size_t current_alignment,
+            size_t data_size)
+    {
+        return (data_size - (current_alignment % data_size)) & (data_size - 1);
+    }
+
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // TYPES_DYNAMIC_TYPE_SERIALIZATION_PLAN_HPP
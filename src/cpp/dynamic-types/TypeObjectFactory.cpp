@@ -25,6 +25,7 @@
 #include <fastrtps/types/AnnotationDescriptor.h>
 #include <fastrtps/utils/md5.h>
 #include <fastdds/dds/log/Log.hpp>
+#include <cstring>
 #include <sstream>
 
 namespace eprosima {
@@ -65,89 +66,88 @@ ReturnCode_t TypeObjectFactory::delete_instance()
 
 TypeObjectFactory::TypeObjectFactory()
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     // Generate basic TypeIdentifiers
     TypeIdentifier* auxIdent;
     // TK_BOOLEAN:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BOOLEAN);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BOOLEAN, auxIdent));
+    store_identifier(TKNAME_BOOLEAN, auxIdent, false, false);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BYTE, auxIdent));
+    store_identifier(TKNAME_BYTE, auxIdent, false, false);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT8, auxIdent));
+    store_identifier(TKNAME_UINT8, auxIdent, false, false);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT8, auxIdent));
+    store_identifier(TKNAME_INT8, auxIdent, false, false);
     // TK_INT16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT16, auxIdent));
+    store_identifier(TKNAME_INT16, auxIdent, false, false);
     // TK_INT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT32, auxIdent));
+    store_identifier(TKNAME_INT32, auxIdent, false, false);
     // TK_INT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT64, auxIdent));
+    store_identifier(TKNAME_INT64, auxIdent, false, false);
     // TK_UINT16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT16, auxIdent));
+    store_identifier(TKNAME_UINT16, auxIdent, false, false);
     // TK_UINT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT32, auxIdent));
+    store_identifier(TKNAME_UINT32, auxIdent, false, false);
     // TK_UINT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT64, auxIdent));
+    store_identifier(TKNAME_UINT64, auxIdent, false, false);
     // TK_FLOAT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT32, auxIdent));
+    store_identifier(TKNAME_FLOAT32, auxIdent, false, false);
     // TK_FLOAT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT64, auxIdent));
+    store_identifier(TKNAME_FLOAT64, auxIdent, false, false);
     // TK_FLOAT128:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT128);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT128, auxIdent));
+    store_identifier(TKNAME_FLOAT128, auxIdent, false, false);
     // TK_CHAR8:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR8);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR8, auxIdent));
+    store_identifier(TKNAME_CHAR8, auxIdent, false, false);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16, auxIdent));
+    store_identifier(TKNAME_CHAR16, auxIdent, false, false);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16T, auxIdent));
+    store_identifier(TKNAME_CHAR16T, auxIdent, false, false);
 }
 
 TypeObjectFactory::~TypeObjectFactory()
@@ -161,34 +161,40 @@ TypeObjectFactory::~TypeObjectFactory()
         informations_.clear();
         informations_created_.clear();
     }
+    for (IdentifierShard& shard : identifier_shards_)
     {
-        std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-        identifiers_.clear();
-        complete_identifiers_.clear();
-
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.entries.clear();
+    }
+    for (NameShard& shard : name_shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.identifiers.clear();
+        shard.complete_identifiers.clear();
+        shard.aliases.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_MutexCreated);
         for (TypeIdentifier* id : identifiers_created_)
         {
             delete id;
         }
         identifiers_created_.clear();
     }
+    for (ObjectShard& shard : object_shards_)
     {
-        std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
-        auto obj_it = objects_.begin();
-        while (obj_it != objects_.end())
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto& obj : shard.objects)
         {
-            delete (obj_it->second);
-            ++obj_it;
+            delete obj.second;
         }
-        objects_.clear();
+        shard.objects.clear();
 
-        auto objc_it = complete_objects_.begin();
-        while (objc_it != complete_objects_.end())
+        for (auto& obj : shard.complete_objects)
         {
-            delete (objc_it->second);
-            ++objc_it;
+            delete obj.second;
         }
-        complete_objects_.clear();
+        shard.complete_objects.clear();
     }
 }
 
@@ -199,22 +205,29 @@ void TypeObjectFactory::create_builtin_annotations()
 
 void TypeObjectFactory::nullify_all_entries(const TypeIdentifier* identifier)
 {
-    for (auto it = identifiers_.begin(); it != identifiers_.end(); ++it)
+    for (NameShard& shard : name_shards_)
     {
-        if (it->second == identifier)
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.identifiers.begin(); it != shard.identifiers.end(); ++it)
         {
-            it->second = nullptr;
+            if (it->second == identifier)
+            {
+                unindex_identifier(identifier, &it->first, false);
+                it->second = nullptr;
+            }
         }
-    }
 
-    for (auto it = complete_identifiers_.begin(); it != complete_identifiers_.end(); ++it)
-    {
-        if (it->second == identifier)
+        for (auto it = shard.complete_identifiers.begin(); it != shard.complete_identifiers.end(); ++it)
         {
-            it->second = nullptr;
+            if (it->second == identifier)
+            {
+                unindex_identifier(identifier, &it->first, true);
+                it->second = nullptr;
+            }
         }
     }
 
+    std::lock_guard<std::mutex> lock(m_MutexCreated);
     auto it = std::find(identifiers_created_.begin(), identifiers_created_.end(), identifier);
     if (it != identifiers_created_.end())
     {
@@ -222,6 +235,228 @@ void TypeObjectFactory::nullify_all_entries(const TypeIdentifier* identifier)
     }
 }
 
+static size_t shard_of(
+        size_t hash,
+        size_t shard_count)
+{
+    // Mix the high bits in, as pointers have their low bits clear
+    hash ^= (hash >> 17) ^ (hash >> 7);
+    return hash & (shard_count - 1);
+}
+
+static void hash_combine(
+        size_t& hash,
+        size_t value)
+{
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+/**
+ * Hash of the value of a TypeIdentifier, consistent with TypeIdentifier::operator==.
+ * Hashed identifiers already carry the MD5 of their TypeObject, so it is used as is.
+ */
+static size_t hash_type_identifier(
+        const TypeIdentifier* identifier)
+{
+    if (identifier == nullptr)
+    {
+        return 0;
+    }
+
+    size_t hash = identifier->_d();
+    switch (identifier->_d())
+    {
+        case TI_STRING8_SMALL:
+        case TI_STRING16_SMALL:
+            hash_combine(hash, identifier->string_sdefn().bound());
+            break;
+        case TI_STRING8_LARGE:
+        case TI_STRING16_LARGE:
+            hash_combine(hash, identifier->string_ldefn().bound());
+            break;
+        case TI_PLAIN_SEQUENCE_SMALL:
+            hash_combine(hash, identifier->seq_sdefn().bound());
+            hash_combine(hash, hash_type_identifier(identifier->seq_sdefn().element_identifier()));
+            break;
+        case TI_PLAIN_SEQUENCE_LARGE:
+            hash_combine(hash, identifier->seq_ldefn().bound());
+            hash_combine(hash, hash_type_identifier(identifier->seq_ldefn().element_identifier()));
+            break;
+        case TI_PLAIN_ARRAY_SMALL:
+            for (SBound bound : identifier->array_sdefn().array_bound_seq())
+            {
+                hash_combine(hash, bound);
+            }
+            hash_combine(hash, hash_type_identifier(identifier->array_sdefn().element_identifier()));
+            break;
+        case TI_PLAIN_ARRAY_LARGE:
+            for (LBound bound : identifier->array_ldefn().array_bound_seq())
+            {
+                hash_combine(hash, bound);
+            }
+            hash_combine(hash, hash_type_identifier(identifier->array_ldefn().element_identifier()));
+            break;
+        case TI_PLAIN_MAP_SMALL:
+            hash_combine(hash, identifier->map_sdefn().bound());
+            hash_combine(hash, hash_type_identifier(identifier->map_sdefn().key_identifier()));
+            hash_combine(hash, hash_type_identifier(identifier->map_sdefn().element_identifier()));
+            break;
+        case TI_PLAIN_MAP_LARGE:
+            hash_combine(hash, identifier->map_ldefn().bound());
+            hash_combine(hash, hash_type_identifier(identifier->map_ldefn().key_identifier()));
+            hash_combine(hash, hash_type_identifier(identifier->map_ldefn().element_identifier()));
+            break;
+        case EK_MINIMAL:
+        case EK_COMPLETE:
+        {
+            size_t equivalence_hash = 0;
+            memcpy(&equivalence_hash, identifier->equivalence_hash(), sizeof(equivalence_hash));
+            hash_combine(hash, equivalence_hash);
+            break;
+        }
+        default:
+            break;
+    }
+    return hash;
+}
+
+TypeObjectFactory::NameShard& TypeObjectFactory::name_shard(
+        const std::string& type_name) const
+{
+    return name_shards_[shard_of(std::hash<std::string>()(type_name), SHARD_COUNT)];
+}
+
+TypeObjectFactory::ObjectShard& TypeObjectFactory::object_shard(
+        const TypeIdentifier* identifier) const
+{
+    return object_shards_[shard_of(std::hash<const TypeIdentifier*>()(identifier), SHARD_COUNT)];
+}
+
+bool TypeObjectFactory::store_identifier(
+        const std::string& type_name,
+        const TypeIdentifier* identifier,
+        bool complete,
+        bool overwrite)
+{
+    NameShard& shard = name_shard(type_name);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& names = complete ? shard.complete_identifiers : shard.identifiers;
+    auto result = names.emplace(type_name, identifier);
+    if (!result.second)
+    {
+        if (!overwrite || result.first->second == identifier)
+        {
+            return false;
+        }
+        unindex_identifier(result.first->second, &result.first->first, complete);
+        result.first->second = identifier;
+    }
+    index_identifier(identifier, &result.first->first, complete);
+    return true;
+}
+
+void TypeObjectFactory::index_identifier(
+        const TypeIdentifier* identifier,
+        const std::string* type_name,
+        bool complete) const
+{
+    if (identifier == nullptr)
+    {
+        return;
+    }
+
+    size_t hash = hash_type_identifier(identifier);
+    IdentifierShard& shard = identifier_shards_[shard_of(hash, SHARD_COUNT)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.entries.emplace(hash, IdentifierShard::Entry{identifier, type_name, complete});
+}
+
+void TypeObjectFactory::unindex_identifier(
+        const TypeIdentifier* identifier,
+        const std::string* type_name,
+        bool complete) const
+{
+    if (identifier == nullptr)
+    {
+        return;
+    }
+
+    size_t hash = hash_type_identifier(identifier);
+    IdentifierShard& shard = identifier_shards_[shard_of(hash, SHARD_COUNT)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto range = shard.entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.identifier == identifier && it->second.name == type_name &&
+                it->second.complete == complete)
+        {
+            shard.entries.erase(it);
+            return;
+        }
+    }
+}
+
+const TypeIdentifier* TypeObjectFactory::find_stored_type_identifier(
+        const TypeIdentifier* identifier,
+        std::string* type_name) const
+{
+    bool complete = identifier->_d() == EK_COMPLETE;
+    size_t hash = hash_type_identifier(identifier);
+    IdentifierShard& shard = identifier_shards_[shard_of(hash, SHARD_COUNT)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // When several names are stored with equal identifiers, the first name in alphabetical order is chosen,
+    // so the result does not depend on the order of registration.
+    const IdentifierShard::Entry* found = nullptr;
+    auto range = shard.entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const IdentifierShard::Entry& entry = it->second;
+        if (entry.complete == complete && *entry.identifier == *identifier &&
+                (found == nullptr || *entry.name < *found->name))
+        {
+            found = &entry;
+        }
+    }
+
+    if (found == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (type_name != nullptr)
+    {
+        *type_name = *found->name;
+    }
+    return found->identifier;
+}
+
+const TypeIdentifier* TypeObjectFactory::find_type_identifier(
+        const std::string& type_name,
+        bool complete) const
+{
+    NameShard& shard = name_shard(type_name);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto& names = complete ? shard.complete_identifiers : shard.identifiers;
+    auto it = names.find(type_name);
+    return it != names.end() ? it->second : nullptr;
+}
+
+void TypeObjectFactory::store_type_object(
+        const TypeIdentifier* identifier,
+        const TypeObject* object)
+{
+    ObjectShard& shard = object_shard(identifier);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& objects = (object->_d() == EK_COMPLETE) ? shard.complete_objects : shard.objects;
+    if (objects.find(identifier) == objects.end())
+    {
+        TypeObject* obj = new TypeObject();
+        *obj = *object;
+        objects[identifier] = obj;
+    }
+}
+
 const TypeInformation* TypeObjectFactory::get_type_information(
         const std::string &type_name) const
 {
@@ -867,20 +1102,15 @@ const TypeObject* TypeObjectFactory::get_type_object(const std::string& type_nam
 
 const TypeObject* TypeObjectFactory::get_type_object(const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
     if (identifier == nullptr) return nullptr;
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        if (complete_objects_.find(identifier) != complete_objects_.end())
-        {
-            return complete_objects_.at(identifier);
-        }
-    }
-    else
     {
-        if (objects_.find(identifier) != objects_.end())
+        ObjectShard& shard = object_shard(identifier);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const auto& objects = (identifier->_d() == EK_COMPLETE) ? shard.complete_objects : shard.objects;
+        auto it = objects.find(identifier);
+        if (it != objects.end())
         {
-            return objects_.at(identifier);
+            return it->second;
         }
     }
 
@@ -1044,50 +1274,41 @@ const TypeIdentifier* TypeObjectFactory::get_primitive_type_identifier(TypeKind
 /*
 const TypeIdentifier* TypeObjectFactory::TryCreateTypeIdentifier(const std::string& type_name)
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     // TODO Makes sense here? I don't think so.
 }
 */
 
 const TypeIdentifier* TypeObjectFactory::get_type_identifier(const std::string& type_name, bool complete) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-
-    if (complete)
+    std::string target_type;
     {
-        if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
+        NameShard& shard = name_shard(type_name);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const auto& names = complete ? shard.complete_identifiers : shard.identifiers;
+        auto it = names.find(type_name);
+        if (it != names.end())
         {
-            return complete_identifiers_.at(type_name);
+            return it->second;
         }
-        /*else // Try it with minimal
-        {
-            return get_type_identifier(type_name, false);
-        }*/
-    }
-    else
-    {
-        if (identifiers_.find(type_name) != identifiers_.end())
+
+        auto alias = shard.aliases.find(type_name);
+        if (alias == shard.aliases.end())
         {
-            return identifiers_.at(type_name);
+            return nullptr;
         }
+        target_type = alias->second;
     }
 
     // Try with aliases
-    if (aliases_.find(type_name) != aliases_.end())
-    {
-        return get_type_identifier(aliases_.at(type_name), complete);
-    }
-
-    return nullptr;
+    return get_type_identifier(target_type, complete);
 }
 
 const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(const std::string& type_name) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-
-    if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
+    const TypeIdentifier* identifier = find_type_identifier(type_name, true);
+    if (identifier != nullptr)
     {
-        return complete_identifiers_.at(type_name);
+        return identifier;
     }
     else // Try it with minimal
     {
@@ -1097,21 +1318,11 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(con
 
 const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr) return nullptr;
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        for (auto& it : complete_identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.second;
-        }
-    }
-    else
+    const TypeIdentifier* stored = find_stored_type_identifier(identifier, nullptr);
+    if (stored != nullptr)
     {
-        for (auto& it : identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.second;
-        }
+        return stored;
     }
     // If isn't minimal, return directly
     if (identifier->_d() < EK_MINIMAL)
@@ -1123,35 +1334,19 @@ const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(const TypeId
 
 std::string TypeObjectFactory::get_type_name(const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr) return "<NULLPTR>";
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        for (auto& it : complete_identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.first;
-        }
-    }
-    else
+    std::string type_name;
+    if (find_stored_type_identifier(identifier, &type_name) != nullptr)
     {
-        for (auto& it : identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.first;
-        }
+        return type_name;
     }
 
-    // Maybe they are using an external TypeIdentifier?
-    const TypeIdentifier* internalId = get_stored_type_identifier(identifier);
-    if (internalId == identifier)
+    if (identifier->_d() < EK_MINIMAL)
     {
         // If the execution reached this point, a lesser than minimal no stored identifier was provided.
         // Calculate the name and store it.
         return generate_name_and_store_type_identifier(identifier);
     }
-    else if (internalId != nullptr)
-    {
-        return get_type_name(internalId);
-    }
 
     return "UNDEF";
 }
@@ -1255,7 +1450,6 @@ const TypeIdentifier* TypeObjectFactory::try_get_complete(const TypeIdentifier*
         return identifier;
     }
 
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     std::string name = get_type_name(identifier);
     return get_type_identifier_trying_complete(name);
 }
@@ -1301,38 +1495,26 @@ void TypeObjectFactory::add_type_identifier(const std::string& type_name, const
     if (alreadyExists != nullptr && alreadyExists != identifier)
     {
         // Don't copy
-        if (is_type_identifier_complete(alreadyExists))
-        {
-            complete_identifiers_[type_name] = alreadyExists;
-        }
-        else
-        {
-            identifiers_[type_name] = alreadyExists;
-        }
+        store_identifier(type_name, alreadyExists, is_type_identifier_complete(alreadyExists), true);
         return;
     }
 
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-    //identifiers_.insert(std::pair<const std::string, const TypeIdentifier*>(type_name, identifier));
-    if (is_type_identifier_complete(identifier))
+    if (find_type_identifier(type_name, is_type_identifier_complete(identifier)) != nullptr)
     {
-        if (complete_identifiers_.find(type_name) == complete_identifiers_.end())
-        {
-            TypeIdentifier* id = new TypeIdentifier();
-            identifiers_created_.push_back(id);
-            *id = *identifier;
-            complete_identifiers_[type_name] = id;
-        }
+        return;
+    }
+
+    TypeIdentifier* id = new TypeIdentifier();
+    *id = *identifier;
+    if (store_identifier(type_name, id, is_type_identifier_complete(identifier), false))
+    {
+        std::lock_guard<std::mutex> lock(m_MutexCreated);
+        identifiers_created_.push_back(id);
     }
     else
     {
-        if (identifiers_.find(type_name) == identifiers_.end())
-        {
-            TypeIdentifier* id = new TypeIdentifier();
-            identifiers_created_.push_back(id);
-            *id = *identifier;
-            identifiers_[type_name] = id;
-        }
+        // Another thread stored it meanwhile
+        delete id;
     }
 }
 
@@ -1341,58 +1523,29 @@ void TypeObjectFactory::add_type_object(const std::string& type_name, const Type
 {
     add_type_identifier(type_name, identifier);
 
-    std::unique_lock<std::recursive_mutex> scopedObj(m_MutexObjects);
+    if (object == nullptr || (object->_d() != EK_MINIMAL && object->_d() != EK_COMPLETE))
+    {
+        return;
+    }
 
-    if (object != nullptr)
+    // Objects of hashed identifiers are stored along the identifier of their kind. Others only have one identifier.
+    bool complete = identifier->_d() >= EK_MINIMAL && object->_d() == EK_COMPLETE;
+    const TypeIdentifier* typeId = find_type_identifier(type_name, complete);
+    if (typeId != nullptr)
     {
-        if (identifier->_d() >= EK_MINIMAL)
-        {
-            if (object->_d() == EK_MINIMAL)
-            {
-                const TypeIdentifier* typeId = identifiers_[type_name];
-                if (objects_.find(typeId) == objects_.end())
-                {
-                    TypeObject* obj = new TypeObject();
-                    *obj = *object;
-                    objects_[typeId] = obj;
-                }
-            }
-            else if (object->_d() == EK_COMPLETE)
-            {
-                const TypeIdentifier* typeId = complete_identifiers_[type_name];
-                if (complete_objects_.find(typeId) == complete_objects_.end())
-                {
-                    TypeObject* obj = new TypeObject();
-                    *obj = *object;
-                    complete_objects_[typeId] = obj;
-                }
-            }
-        }
-        else
-        {
-            const TypeIdentifier* typeId = identifiers_[type_name];
-            if (object->_d() == EK_MINIMAL)
-            {
-                if (objects_.find(typeId) == objects_.end())
-                {
-                    TypeObject* obj = new TypeObject();
-                    *obj = *object;
-                    objects_[typeId] = obj;
-                }
-            }
-            else if (object->_d() == EK_COMPLETE)
-            {
-                if (complete_objects_.find(typeId) == complete_objects_.end())
-                {
-                    TypeObject* obj = new TypeObject();
-                    *obj = *object;
-                    complete_objects_[typeId] = obj;
-                }
-            }
-        }
+        store_type_object(typeId, object);
     }
 }
 
+void TypeObjectFactory::add_alias(
+        const std::string& alias_name,
+        const std::string& target_type)
+{
+    NameShard& shard = name_shard(alias_name);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.aliases.emplace(alias_name, target_type);
+}
+
 const TypeIdentifier* TypeObjectFactory::get_string_identifier(
         uint32_t bound,
         bool wide)
@@ -328,7 +328,7 @@ bool TypeLookupManager::create_endpoints()
 {
     // Built-in history attributes.
     HistoryAttributes hatt;
-    hatt.initialReservedCaches = 20;
+    hatt.initialReservedCaches = builtin_protocols_->m_att.lazy_builtin_allocation ? 1 : 20;
     hatt.maximumReservedCaches = 1000;
     hatt.payloadMaxSize = TYPELOOKUP_DATA_MAX_SIZE;
 
@@ -0,0 +1,73 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatusCondition.cpp
+ *
+ */
+
+#include <fastdds/dds/core/conditions/StatusCondition.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+StatusCondition::StatusCondition(
+        Entity* parent)
+    : entity_(parent)
+    , enabled_statuses_(StatusMask::all().to_ulong())
+    , status_changes_(StatusMask::none().to_ulong())
+{
+}
+
+StatusCondition::~StatusCondition()
+{
+}
+
+bool StatusCondition::get_trigger_value() const
+{
+    return 0 != (status_changes_.load() & enabled_statuses_.load());
+}
+
+ReturnCode_t StatusCondition::set_enabled_statuses(
+        const StatusMask& mask)
+{
+    enabled_statuses_.store(mask.to_ulong());
+    notify();
+    return ReturnCode_t::RETCODE_OK;
+}
+
+StatusMask StatusCondition::get_enabled_statuses() const
+{
+    return StatusMask(static_cast<uint32_t>(enabled_statuses_.load()));
+}
+
+Entity* StatusCondition::get_entity() const
+{
+    return entity_;
+}
+
+void StatusCondition::set_status_changes(
+        const StatusMask& status_changes)
+{
+    status_changes_.store(status_changes.to_ulong());
+    if (get_trigger_value())
+    {
+        notify();
+    }
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
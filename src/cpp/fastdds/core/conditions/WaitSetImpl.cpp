@@ -0,0 +1,247 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSetImpl.cpp
+ *
+ */
+
+#include <fastdds/core/conditions/WaitSetImpl.hpp>
+
+#include <chrono>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+WaitSetImpl::~WaitSetImpl()
+{
+    std::vector<std::shared_ptr<Attachment> > attached;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        attached.swap(attached_);
+        pending_.clear();
+    }
+
+    for (const auto& attachment : attached)
+    {
+        attachment->condition->notifier_->detach_from(this);
+    }
+}
+
+ReturnCode_t WaitSetImpl::attach_condition(
+        Condition& condition)
+{
+    std::shared_ptr<Attachment> attachment;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (const auto& it : attached_)
+        {
+            if (it->condition == &condition)
+            {
+                return ReturnCode_t::RETCODE_OK;
+            }
+        }
+
+        attachment = std::make_shared<Attachment>(&condition);
+        attached_.push_back(attachment);
+    }
+
+    condition.notifier_->attach_to(this, attachment.get());
+
+    // The condition may already be active
+    wake_up(attachment.get());
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t WaitSetImpl::detach_condition(
+        Condition& condition)
+{
+    if (!condition.notifier_->is_attached_to(this))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    // No more wake ups will be received for this condition once it is detached from the notifier
+    condition.notifier_->detach_from(this);
+    return remove_attachment(&condition) ? ReturnCode_t::RETCODE_OK : ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+}
+
+ReturnCode_t WaitSetImpl::wait(
+        ConditionSeq& active_conditions,
+        const fastrtps::Duration_t& timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (is_waiting_)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    is_waiting_ = true;
+    active_conditions.clear();
+
+    bool infinite = (timeout == fastrtps::c_TimeInfinite);
+    auto max_wait = std::chrono::steady_clock::now() + std::chrono::seconds(timeout.seconds) +
+            std::chrono::nanoseconds(timeout.nanosec);
+
+    auto has_pending = [this]()
+            {
+                return !pending_.empty();
+            };
+
+    ReturnCode_t ret_code = ReturnCode_t::RETCODE_TIMEOUT;
+    std::vector<std::shared_ptr<Attachment> > to_check;
+    std::vector<std::shared_ptr<Attachment> > active;
+    while (true)
+    {
+        to_check.swap(pending_);
+        is_checking_ = true;
+        lock.unlock();
+
+        for (const auto& attachment : to_check)
+        {
+            // Clear the flag before checking, so a trigger happening meanwhile queues it again
+            attachment->queued.store(false);
+            if (attachment->condition->get_trigger_value())
+            {
+                active.push_back(attachment);
+            }
+        }
+
+        lock.lock();
+        is_checking_ = false;
+        checked_cond_.notify_all();
+
+        // Active conditions are checked again on the next wait, as they stay active until the application
+        // handles them
+        for (const auto& attachment : active)
+        {
+            if (attachment->attached)
+            {
+                active_conditions.push_back(attachment->condition);
+                if (!attachment->queued.exchange(true))
+                {
+                    pending_.push_back(attachment);
+                }
+            }
+        }
+
+        to_check.clear();
+        active.clear();
+
+        if (!active_conditions.empty())
+        {
+            ret_code = ReturnCode_t::RETCODE_OK;
+            break;
+        }
+
+        if (infinite)
+        {
+            cond_.wait(lock, has_pending);
+        }
+        else if (!cond_.wait_until(lock, max_wait, has_pending))
+        {
+            break;
+        }
+    }
+
+    is_waiting_ = false;
+    return ret_code;
+}
+
+ReturnCode_t WaitSetImpl::get_conditions(
+        ConditionSeq& attached_conditions) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    attached_conditions.clear();
+    attached_conditions.reserve(attached_.size());
+    for (const auto& attachment : attached_)
+    {
+        attached_conditions.push_back(attachment->condition);
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+void WaitSetImpl::wake_up(
+        Attachment* attachment)
+{
+    if (!attachment->queued.exchange(true))
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (attachment->attached)
+        {
+            pending_.push_back(attachment->shared_from_this());
+            cond_.notify_one();
+        }
+        else
+        {
+            attachment->queued.store(false);
+        }
+    }
+}
+
+void WaitSetImpl::condition_destroyed(
+        Condition* condition)
+{
+    remove_attachment(condition);
+}
+
+bool WaitSetImpl::is_attached(
+        const Condition& condition)
+{
+    return condition.notifier_->is_attached();
+}
+
+std::shared_ptr<WaitSetImpl::Attachment> WaitSetImpl::remove_attachment(
+        Condition* condition)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // The condition may be on the list being checked by the waiting thread
+    checked_cond_.wait(lock, [this]()
+            {
+                return !is_checking_;
+            });
+
+    std::shared_ptr<Attachment> attachment;
+    for (auto it = attached_.begin(); it != attached_.end(); ++it)
+    {
+        if ((*it)->condition == condition)
+        {
+            attachment = *it;
+            attached_.erase(it);
+            break;
+        }
+    }
+
+    if (attachment)
+    {
+        attachment->attached = false;
+        for (auto it = pending_.begin(); it != pending_.end(); ++it)
+        {
+            if (*it == attachment)
+            {
+                pending_.erase(it);
+                break;
+            }
+        }
+    }
+
+    return attachment;
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
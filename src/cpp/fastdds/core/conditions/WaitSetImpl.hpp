@@ -0,0 +1,243 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSetImpl.hpp
+ *
+ */
+
+#ifndef _FASTDDS_CORE_CONDITIONS_WAITSETIMPL_HPP_
+#define _FASTDDS_CORE_CONDITIONS_WAITSETIMPL_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/dds/core/conditions/Condition.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Implementation of a WaitSet.
+ *
+ * Each attached condition has an Attachment on the WaitSet. When a condition is notified, its attachment is queued
+ * on the WaitSet unless it was already queued, which only needs an atomic exchange. A wait only checks the queued
+ * attachments, so its cost depends on the number of notified conditions and not on the number of attached ones.
+ *
+ * Lock order is condition notifier first, WaitSet mutex second. Trigger values are checked without holding the
+ * WaitSet mutex, as they may need to take the mutex of the entity that notifies the condition.
+ */
+class WaitSetImpl
+{
+public:
+
+    //! State of a condition attached to this WaitSet
+    struct Attachment : public std::enable_shared_from_this<Attachment>
+    {
+        explicit Attachment(
+                Condition* cond)
+            : condition(cond)
+            , queued(false)
+            , attached(true)
+        {
+        }
+
+        //! The attached condition
+        Condition* condition;
+
+        //! Whether the attachment is on the queue of conditions to check
+        std::atomic<bool> queued;
+
+        //! Whether the condition is still attached. Protected by the WaitSet mutex.
+        bool attached;
+    };
+
+    ~WaitSetImpl();
+
+    ReturnCode_t attach_condition(
+            Condition& condition);
+
+    ReturnCode_t detach_condition(
+            Condition& condition);
+
+    ReturnCode_t wait(
+            ConditionSeq& active_conditions,
+            const fastrtps::Duration_t& timeout);
+
+    ReturnCode_t get_conditions(
+            ConditionSeq& attached_conditions) const;
+
+    /**
+     * Queue an attachment to be checked by the waiting thread.
+     * @param attachment Attachment of a condition whose trigger value may have changed.
+     */
+    void wake_up(
+            Attachment* attachment);
+
+    /**
+     * Remove a condition that is being destroyed without detaching it from the condition's notifier.
+     * @param condition Condition being destroyed.
+     */
+    void condition_destroyed(
+            Condition* condition);
+
+    /**
+     * Check whether a condition is attached to any WaitSet.
+     * An attached condition should not be destroyed, as its trigger value may be checked at any time.
+     * @param condition Condition to check.
+     * @return true if the condition is attached to at least one WaitSet.
+     */
+    static bool is_attached(
+            const Condition& condition);
+
+private:
+
+    /**
+     * Remove the attachment of a condition.
+     * When a wait is checking trigger values, it waits until the check finishes, so the condition may be destroyed
+     * as soon as this method returns.
+     * @param condition Condition to remove.
+     * @return The removed attachment, or nullptr if the condition was not attached.
+     */
+    std::shared_ptr<Attachment> remove_attachment(
+            Condition* condition);
+
+    mutable std::mutex mutex_;
+
+    std::condition_variable cond_;
+
+    //! Signaled when a wait finishes checking trigger values
+    std::condition_variable checked_cond_;
+
+    //! Attachments of all the attached conditions
+    std::vector<std::shared_ptr<Attachment> > attached_;
+
+    //! Attachments that should be checked by the next wait
+    std::vector<std::shared_ptr<Attachment> > pending_;
+
+    bool is_waiting_ = false;
+
+    //! Whether a wait is checking trigger values without holding the mutex
+    bool is_checking_ = false;
+};
+
+namespace detail {
+
+/**
+ * Keeps the list of WaitSets a condition is attached to, and wakes them up when the condition is notified.
+ * Notifying a condition not attached to any WaitSet only performs an atomic load.
+ */
+class ConditionNotifier
+{
+public:
+
+    void attach_to(
+            WaitSetImpl* wait_set,
+            WaitSetImpl::Attachment* attachment)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        entries_.emplace_back(wait_set, attachment);
+        num_entries_.store(entries_.size());
+    }
+
+    void detach_from(
+            WaitSetImpl* wait_set)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (auto it = entries_.begin(); it != entries_.end(); ++it)
+        {
+            if (it->first == wait_set)
+            {
+                entries_.erase(it);
+                break;
+            }
+        }
+        num_entries_.store(entries_.size());
+    }
+
+    bool is_attached() const
+    {
+        return 0 != num_entries_.load();
+    }
+
+    bool is_attached_to(
+            const WaitSetImpl* wait_set)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (const auto& entry : entries_)
+        {
+            if (entry.first == wait_set)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void notify()
+    {
+        if (0 == num_entries_.load())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (const auto& entry : entries_)
+        {
+            entry.first->wake_up(entry.second);
+        }
+    }
+
+    void will_be_deleted(
+            Condition* condition)
+    {
+        std::vector<std::pair<WaitSetImpl*, WaitSetImpl::Attachment*> > entries;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            entries.swap(entries_);
+            num_entries_.store(0);
+        }
+
+        for (const auto& entry : entries)
+        {
+            entry.first->condition_destroyed(condition);
+        }
+    }
+
+private:
+
+    std::mutex mutex_;
+
+    std::atomic<size_t> num_entries_{0};
+
+    std::vector<std::pair<WaitSetImpl*, WaitSetImpl::Attachment*> > entries_;
+};
+
+} // namespace detail
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_CORE_CONDITIONS_WAITSETIMPL_HPP_
@@ -340,6 +340,12 @@ ReturnCode_t DomainParticipant::get_current_time(
     return impl_->get_current_time(current_time);
 }
 
+ReturnCode_t DomainParticipant::get_statistics(
+        std::vector<statistics::EntityStatistics>& statistics) const
+{
+    return impl_->get_statistics(statistics);
+}
+
 TypeSupport DomainParticipant::find_type(
         const std::string& type_name) const
 {
@@ -62,6 +62,8 @@ static void set_qos_from_attributes(
     qos.transport().use_builtin_transports = attr.useBuiltinTransports;
     qos.transport().send_socket_buffer_size = attr.sendSocketBufferSize;
     qos.transport().listen_socket_buffer_size = attr.listenSocketBufferSize;
+    qos.timed_events_thread() = attr.timed_events_thread;
+    qos.async_writer_thread() = attr.async_writer_thread;
     qos.name() = attr.getName();
 }
 
@@ -99,6 +99,8 @@ static void set_attributes_from_qos(
     attr.useBuiltinTransports = qos.transport().use_builtin_transports;
     attr.sendSocketBufferSize = qos.transport().send_socket_buffer_size;
     attr.listenSocketBufferSize = qos.transport().listen_socket_buffer_size;
+    attr.timed_events_thread = qos.timed_events_thread();
+    attr.async_writer_thread = qos.async_writer_thread();
     attr.userData = qos.user_data().data_vec();
 }
 
@@ -785,6 +787,22 @@ ReturnCode_t DomainParticipantImpl::get_current_time(
     return ReturnCode_t::RETCODE_OK;
 }
 
+ReturnCode_t DomainParticipantImpl::get_statistics(
+        std::vector<statistics::EntityStatistics>& statistics) const
+{
+    if (rtps_participant_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if (!rtps_participant_->get_statistics(statistics))
+    {
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
 const DomainParticipant* DomainParticipantImpl::get_participant() const
 {
     return participant_;
@@ -1705,6 +1723,14 @@ void DomainParticipantImpl::set_qos(
     {
         to.transport() = from.transport();
     }
+    if (first_time && to.timed_events_thread() != from.timed_events_thread())
+    {
+        to.timed_events_thread() = from.timed_events_thread();
+    }
+    if (first_time && to.async_writer_thread() != from.async_writer_thread())
+    {
+        to.async_writer_thread() = from.async_writer_thread();
+    }
     if (first_time && to.name() != from.name())
     {
         to.name() = from.name();
@@ -1747,6 +1773,16 @@ bool DomainParticipantImpl::can_qos_be_updated(
         updatable = false;
         logWarning(RTPS_QOS_CHECK, "TransportConfigQos cannot be changed after the participant is enabled");
     }
+    if (to.timed_events_thread() != from.timed_events_thread())
+    {
+        updatable = false;
+        logWarning(RTPS_QOS_CHECK, "Timed events thread settings cannot be changed after the participant is enabled");
+    }
+    if (to.async_writer_thread() != from.async_writer_thread())
+    {
+        updatable = false;
+        logWarning(RTPS_QOS_CHECK, "Async writer thread settings cannot be changed after the participant is enabled");
+    }
     if (!(to.name() == from.name()))
     {
         updatable = false;
@@ -33,6 +33,7 @@
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastrtps/types/TypesBase.h>
+#include <fastdds/statistics/EntityStatistics.hpp>
 
 using eprosima::fastrtps::types::ReturnCode_t;
 
@@ -307,6 +308,9 @@ public:
     ReturnCode_t get_current_time(
             fastrtps::Time_t& current_time) const;
 
+    ReturnCode_t get_statistics(
+            std::vector<statistics::EntityStatistics>& statistics) const;
+
     const DomainParticipant* get_participant() const;
 
     DomainParticipant* get_participant();
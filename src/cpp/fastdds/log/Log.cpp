@@ -5,6 +5,7 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastdds/dds/log/Colors.hpp>
+#include <utils/threading.hpp>
 #include <iostream>
 
 using namespace std;
@@ -206,6 +207,13 @@ void Log::KillThread()
     }
 }
 
+void Log::SetThreadSettings(
+        const rtps::ThreadSettings& settings)
+{
+    std::unique_lock<std::mutex> guard(resources_.cv_mutex);
+    resources_.thread_settings = settings;
+}
+
 void Log::QueueLog(
         const std::string& message,
         const Log::Context& context,
@@ -216,7 +224,8 @@ void Log::QueueLog(
         if (!resources_.logging && !resources_.logging_thread)
         {
             resources_.logging = true;
-            resources_.logging_thread.reset(new thread(Log::run));
+            resources_.logging_thread.reset(new eprosima::thread(
+                        create_thread(Log::run, resources_.thread_settings, "dds.log")));
         }
     }
 
@@ -91,6 +91,7 @@ ReturnCode_t DataWriterImpl::enable()
     w_att.endpoint.remoteLocatorList = qos_.endpoint().remote_locator_list;
     w_att.mode = qos_.publish_mode().kind == SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
     w_att.endpoint.properties = qos_.properties();
+    w_att.endpoint.data_sharing = qos_.endpoint().data_sharing;
 
     if (qos_.endpoint().entity_id > 0)
     {
@@ -107,6 +108,7 @@ ReturnCode_t DataWriterImpl::enable()
     w_att.liveliness_lease_duration = qos_.liveliness().lease_duration;
     w_att.liveliness_announcement_period = qos_.liveliness().announcement_period;
     w_att.matched_readers_allocation = qos_.writer_resource_limits().matched_subscriber_allocation;
+    w_att.batching = qos_.batching();
 
     // TODO(Ricardo) Remove in future
     // Insert topic_name and partitions
@@ -255,16 +257,26 @@ ReturnCode_t DataWriterImpl::write(
     InstanceHandle_t instance_handle;
     if (type_.get()->m_isGetKeyDefined)
     {
-        bool is_key_protected = false;
+#if defined(NDEBUG)
+        // A handle of a registered instance is trusted, avoiding the serialization and hashing of the key.
+        if (handle.isDefined() && history_.is_key_registered(handle))
+        {
+            instance_handle = handle;
+        }
+        else
+#endif // if defined(NDEBUG)
+        {
+            bool is_key_protected = false;
 #if HAVE_SECURITY
-        is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+            is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
 #endif // if HAVE_SECURITY
-        type_.get()->getKey(data, &instance_handle, is_key_protected);
+            type_.get()->getKey(data, &instance_handle, is_key_protected);
+        }
     }
 
     //Check if the Handle is different from the special value HANDLE_NIL and
     //does not correspond with the instance referred by the data
-    if (handle.isDefined() && handle.value != instance_handle.value)
+    if (handle.isDefined() && handle != instance_handle)
     {
         return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
     }
@@ -1049,6 +1061,10 @@ void DataWriterImpl::set_qos(
     {
         to.throughput_controller() = from.throughput_controller();
     }
+    if (is_default && !(to.batching() == from.batching()))
+    {
+        to.batching() = from.batching();
+    }
 }
 
 ReturnCode_t DataWriterImpl::check_qos(
@@ -1126,6 +1142,11 @@ bool DataWriterImpl::can_qos_be_updated(
         updatable = false;
         logWarning(RTPS_QOS_CHECK, "Destination order Kind cannot be changed after the creation of a DataWriter.");
     }
+    if (!(to.batching() == from.batching()))
+    {
+        updatable = false;
+        logWarning(RTPS_QOS_CHECK, "Batching cannot be changed after the creation of a DataWriter.");
+    }
     return updatable;
 }
 
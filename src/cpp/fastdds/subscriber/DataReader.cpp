@@ -138,6 +138,12 @@ ReturnCode_t DataReader::get_requested_incompatible_qos_status(
     return impl_->get_requested_incompatible_qos_status(status);
 }
 
+ReturnCode_t DataReader::get_subscription_matched_status(
+        SubscriptionMatchedStatus& status)
+{
+    return impl_->get_subscription_matched_status(status);
+}
+
 /* TODO
    bool DataReader::read(
         std::vector<void *>& data_values,
@@ -224,6 +230,20 @@ const Subscriber* DataReader::get_subscriber() const
     return impl_->get_subscriber();
 }
 
+ReadCondition* DataReader::create_readcondition(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->create_readcondition(sample_states, view_states, instance_states);
+}
+
+ReturnCode_t DataReader::delete_readcondition(
+        ReadCondition* a_condition)
+{
+    return impl_->delete_readcondition(a_condition);
+}
+
 /* TODO
    bool DataReader::wait_for_historical_data(
         const Duration_t& max_wait) const
@@ -18,6 +18,7 @@
  */
 
 #include <fastdds/subscriber/DataReaderImpl.hpp>
+#include <fastdds/core/conditions/WaitSetImpl.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
@@ -37,6 +38,8 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <algorithm>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace std::chrono;
@@ -98,6 +101,9 @@ DataReaderImpl::DataReaderImpl(
     , reader_listener_(this)
     , deadline_duration_us_(qos_.deadline().period.to_ns() * 1e-3)
     , lifespan_duration_us_(qos_.lifespan().duration.to_ns() * 1e-3)
+    , num_read_conditions_(0)
+    , triggered_statuses_(0)
+    , data_available_task_(this)
 {
 }
 
@@ -115,6 +121,8 @@ ReturnCode_t DataReaderImpl::enable()
     att.endpoint.unicastLocatorList = qos_.endpoint().unicast_locator_list;
     att.endpoint.remoteLocatorList = qos_.endpoint().remote_locator_list;
     att.endpoint.properties = qos_.properties();
+    att.endpoint.data_sharing = qos_.endpoint().data_sharing;
+    att.endpoint.data_sharing_listener_thread = qos_.endpoint().data_sharing_listener_thread;
 
     if (qos_.endpoint().entity_id > 0)
     {
@@ -152,6 +160,12 @@ ReturnCode_t DataReaderImpl::enable()
         att.endpoint.properties.properties().push_back(std::move(property));
     }
 
+    // Data may be received as soon as the RTPSReader is created
+    if (qos_.delivery_executor().thread_count > 0)
+    {
+        delivery_executor_.reset(new DeliveryExecutor(qos_.delivery_executor()));
+    }
+
     RTPSReader* reader = RTPSDomain::createRTPSReader(
         subscriber_->rtps_participant(),
         att,
@@ -161,6 +175,7 @@ ReturnCode_t DataReaderImpl::enable()
     if (reader == nullptr)
     {
         logError(DATA_READER, "Problem creating associated Reader");
+        delivery_executor_.reset();
         return ReturnCode_t::RETCODE_ERROR;
     }
 
@@ -198,6 +213,12 @@ void DataReaderImpl::disable()
 
 DataReaderImpl::~DataReaderImpl()
 {
+    // Pending notifications are discarded
+    if (delivery_executor_)
+    {
+        delivery_executor_->stop();
+    }
+
     delete lifespan_timer_;
     delete deadline_timer_;
 
@@ -207,6 +228,11 @@ DataReaderImpl::~DataReaderImpl()
         RTPSDomain::removeRTPSReader(reader_);
     }
 
+    for (ReadCondition* condition : read_conditions_)
+    {
+        delete condition;
+    }
+
     delete user_datareader_;
 }
 
@@ -240,6 +266,9 @@ ReturnCode_t DataReaderImpl::read_next_sample(
     if (history_.readNextData(data, &rtps_info, max_blocking_time))
     {
         sample_info_to_dds(rtps_info, info);
+        clear_data_available();
+        // The sample is now in READ state
+        notify_read_conditions();
         return ReturnCode_t::RETCODE_OK;
     }
     return ReturnCode_t::RETCODE_ERROR;
@@ -270,6 +299,7 @@ ReturnCode_t DataReaderImpl::take_next_sample(
     if (history_.takeNextData(data, &rtps_info, max_blocking_time))
     {
         sample_info_to_dds(rtps_info, info);
+        clear_data_available();
         return ReturnCode_t::RETCODE_OK;
     }
     return ReturnCode_t::RETCODE_ERROR;
@@ -387,21 +417,38 @@ void DataReaderImpl::InnerDataReaderListener::onNewCacheChangeAdded(
 {
     if (data_reader_->on_new_cache_change_added(change_in))
     {
-        //First check if we can handle with on_data_on_readers
-        SubscriberListener* subscriber_listener =
-                data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
-        if (subscriber_listener != nullptr)
+        data_reader_->set_status_changes(StatusMask::data_available(), true);
+        data_reader_->notify_read_conditions();
+
+        DeliveryExecutor* executor = data_reader_->delivery_executor_.get();
+        if (executor == nullptr)
         {
-            subscriber_listener->on_data_on_readers(data_reader_->subscriber_->user_subscriber_);
+            data_reader_->notify_data_available();
         }
-        else
+        else if (!executor->push(&data_reader_->data_available_task_))
         {
-            // If not, try with on_data_available
-            DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::data_available());
-            if (listener != nullptr)
-            {
-                listener->on_data_available(data_reader_->user_datareader_);
-            }
+            // The queue is full of notifications that have not been delivered yet, and the listener will read this
+            // sample when handling any of them. Retrying covers the case where all of them were run meanwhile.
+            executor->push(&data_reader_->data_available_task_);
+        }
+    }
+}
+
+void DataReaderImpl::notify_data_available()
+{
+    //First check if we can handle with on_data_on_readers
+    SubscriberListener* subscriber_listener = subscriber_->get_listener_for(StatusMask::data_on_readers());
+    if (subscriber_listener != nullptr)
+    {
+        subscriber_listener->on_data_on_readers(subscriber_->user_subscriber_);
+    }
+    else
+    {
+        // If not, try with on_data_available
+        DataReaderListener* listener = get_listener_for(StatusMask::data_available());
+        if (listener != nullptr)
+        {
+            listener->on_data_available(user_datareader_);
         }
     }
 }
@@ -410,10 +457,16 @@ void DataReaderImpl::InnerDataReaderListener::onReaderMatched(
         RTPSReader* /*reader*/,
         const SubscriptionMatchedStatus& info)
 {
+    data_reader_->update_subscription_matched_status(info);
+    data_reader_->set_status_changes(StatusMask::subscription_matched(), true);
     DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::subscription_matched());
     if (listener != nullptr)
     {
-        listener->on_subscription_matched(data_reader_->user_datareader_, info);
+        SubscriptionMatchedStatus callback_status;
+        if (data_reader_->get_subscription_matched_status(callback_status) == ReturnCode_t::RETCODE_OK)
+        {
+            listener->on_subscription_matched(data_reader_->user_datareader_, callback_status);
+        }
     }
 }
 
@@ -422,6 +475,7 @@ void DataReaderImpl::InnerDataReaderListener::on_liveliness_changed(
         const fastrtps::LivelinessChangedStatus& status)
 {
     data_reader_->update_liveliness_status(status);
+    data_reader_->set_status_changes(StatusMask::liveliness_changed(), true);
     DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::liveliness_changed());
     if (listener != nullptr)
     {
@@ -438,6 +492,7 @@ void DataReaderImpl::InnerDataReaderListener::on_requested_incompatible_qos(
         fastdds::dds::PolicyMask qos)
 {
     data_reader_->update_requested_incompatible_qos(qos);
+    data_reader_->set_status_changes(StatusMask::requested_incompatible_qos(), true);
     DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::requested_incompatible_qos());
     if (listener != nullptr)
     {
@@ -542,6 +597,7 @@ bool DataReaderImpl::deadline_missed()
     deadline_missed_status_.total_count++;
     deadline_missed_status_.total_count_change++;
     deadline_missed_status_.last_instance_handle = timer_owner_;
+    set_status_changes(StatusMask::requested_deadline_missed(), true);
     listener_->on_requested_deadline_missed(user_datareader_, deadline_missed_status_);
     subscriber_->subscriber_listener_.on_requested_deadline_missed(user_datareader_, deadline_missed_status_);
     deadline_missed_status_.total_count_change = 0;
@@ -568,6 +624,7 @@ ReturnCode_t DataReaderImpl::get_requested_deadline_missed_status(
 
     status = deadline_missed_status_;
     deadline_missed_status_.total_count_change = 0;
+    set_status_changes(StatusMask::requested_deadline_missed(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -676,6 +733,7 @@ ReturnCode_t DataReaderImpl::get_liveliness_changed_status(
     status = liveliness_changed_status_;
     liveliness_changed_status_.alive_count_change = 0u;
     liveliness_changed_status_.not_alive_count_change = 0u;
+    set_status_changes(StatusMask::liveliness_changed(), false);
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -692,6 +750,24 @@ ReturnCode_t DataReaderImpl::get_requested_incompatible_qos_status(
 
     status = requested_incompatible_qos_status_;
     requested_incompatible_qos_status_.total_count_change = 0u;
+    set_status_changes(StatusMask::requested_incompatible_qos(), false);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataReaderImpl::get_subscription_matched_status(
+        SubscriptionMatchedStatus& status)
+{
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
+
+    status = subscription_matched_status_;
+    subscription_matched_status_.current_count_change = 0;
+    subscription_matched_status_.total_count_change = 0;
+    set_status_changes(StatusMask::subscription_matched(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -758,6 +834,24 @@ RequestedIncompatibleQosStatus& DataReaderImpl::update_requested_incompatible_qo
     return requested_incompatible_qos_status_;
 }
 
+SubscriptionMatchedStatus& DataReaderImpl::update_subscription_matched_status(
+        const SubscriptionMatchedStatus& status)
+{
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+
+    int32_t count_change = status.current_count_change;
+    subscription_matched_status_.current_count += count_change;
+    subscription_matched_status_.current_count_change += count_change;
+    if (count_change > 0)
+    {
+        subscription_matched_status_.total_count += count_change;
+        subscription_matched_status_.total_count_change += count_change;
+    }
+    subscription_matched_status_.last_publication_handle = status.last_publication_handle;
+
+    return subscription_matched_status_;
+}
+
 LivelinessChangedStatus& DataReaderImpl::update_liveliness_status(
         const fastrtps::LivelinessChangedStatus& status)
 {
@@ -835,6 +929,11 @@ bool DataReaderImpl::can_qos_be_updated(
         updatable = false;
         logWarning(DDS_QOS_CHECK, "Destination order Kind cannot be changed after the creation of a DataReader.");
     }
+    if (!(to.delivery_executor() == from.delivery_executor()))
+    {
+        updatable = false;
+        logWarning(DDS_QOS_CHECK, "Delivery executor cannot be changed after the creation of a DataReader.");
+    }
     return updatable;
 }
 
@@ -942,6 +1041,11 @@ void DataReaderImpl::set_qos(
     {
         to.reader_resource_limits() = from.reader_resource_limits();
     }
+
+    if (first_time && !(to.delivery_executor() == from.delivery_executor()))
+    {
+        to.delivery_executor() = from.delivery_executor();
+    }
 }
 
 fastrtps::TopicAttributes DataReaderImpl::topic_attributes() const
@@ -970,6 +1074,108 @@ fastrtps::TopicAttributes DataReaderImpl::topic_attributes() const
     return topic_att;
 }
 
+ReadCondition* DataReaderImpl::create_readcondition(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    ReadCondition* condition = new ReadCondition(this, user_datareader_, sample_states, view_states,
+                    instance_states);
+
+    std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+    read_conditions_.push_back(condition);
+    num_read_conditions_.store(read_conditions_.size());
+    return condition;
+}
+
+ReturnCode_t DataReaderImpl::delete_readcondition(
+        ReadCondition* a_condition)
+{
+    std::unique_lock<std::mutex> lock(read_conditions_mutex_);
+    auto it = std::find(read_conditions_.begin(), read_conditions_.end(), a_condition);
+    if (it == read_conditions_.end())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    // A WaitSet may be checking the trigger value of an attached condition at any time
+    if (WaitSetImpl::is_attached(*a_condition))
+    {
+        logWarning(DATA_READER, "Trying to delete a ReadCondition attached to a WaitSet");
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    read_conditions_.erase(it);
+    num_read_conditions_.store(read_conditions_.size());
+    lock.unlock();
+
+    delete a_condition;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DataReaderImpl::has_samples(
+        SampleStateMask sample_states,
+        ViewStateMask /*view_states*/,
+        InstanceStateMask /*instance_states*/)
+{
+    if (reader_ == nullptr)
+    {
+        return false;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+
+    uint64_t unread_count = reader_->get_unread_count();
+    if ((sample_states & NOT_READ_SAMPLE_STATE) && unread_count > 0)
+    {
+        return true;
+    }
+
+    return (sample_states & READ_SAMPLE_STATE) && history_.getHistorySize() > unread_count;
+}
+
+void DataReaderImpl::notify_read_conditions()
+{
+    if (0 == num_read_conditions_.load())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+    for (ReadCondition* condition : read_conditions_)
+    {
+        condition->notify();
+    }
+}
+
+void DataReaderImpl::clear_data_available()
+{
+    // Evaluated with the reader locked, as a sample received after the read or take released the reader found the
+    // status still triggered, and did not trigger it again
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    set_status_changes(StatusMask::data_available(), reader_->get_unread_count() > 0);
+}
+
+void DataReaderImpl::set_status_changes(
+        const StatusMask& status,
+        bool triggered)
+{
+    if (user_datareader_ != nullptr)
+    {
+        // Most updates, like the one done for each new sample, do not change anything
+        uint32_t mask = static_cast<uint32_t>(status.to_ulong());
+        uint32_t current = triggered_statuses_.load();
+        if ((triggered ? (current & mask) : (~current & mask)) == mask)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(status_mutex_);
+        user_datareader_->set_status_changes(status, triggered);
+        triggered_statuses_.store(static_cast<uint32_t>(user_datareader_->get_status_changes().to_ulong()));
+    }
+}
+
 DataReaderListener* DataReaderImpl::get_listener_for(
         const StatusMask& status)
 {
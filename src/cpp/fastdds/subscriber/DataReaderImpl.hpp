@@ -26,6 +26,8 @@
 
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
 
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastrtps/subscriber/SubscriberHistory.h>
@@ -36,6 +38,13 @@
 #include <fastrtps/qos/LivelinessChangedStatus.h>
 #include <fastrtps/types/TypesBase.h>
 
+#include <fastdds/subscriber/DeliveryExecutor.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 using eprosima::fastrtps::types::ReturnCode_t;
 
 namespace eprosima {
@@ -172,6 +181,9 @@ public:
     ReturnCode_t get_requested_incompatible_qos_status(
             RequestedIncompatibleQosStatus& status);
 
+    ReturnCode_t get_subscription_matched_status(
+            SubscriptionMatchedStatus& status);
+
     /* TODO
        bool get_sample_lost_status(
             fastrtps::SampleLostStatus& status) const;
@@ -184,6 +196,24 @@ public:
 
     const Subscriber* get_subscriber() const;
 
+    ReadCondition* create_readcondition(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    ReturnCode_t delete_readcondition(
+            ReadCondition* a_condition);
+
+    /**
+     * Check whether there are samples in the history with the given states.
+     * View and instance states are not tracked yet, so only the sample states are taken into account.
+     * @return true if there are samples matching the masks.
+     */
+    bool has_samples(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
     /* TODO
        bool wait_for_historical_data(
             const fastrtps::Duration_t& max_wait) const;
@@ -290,6 +320,9 @@ protected:
     //! Requested incompatible QoS status
     RequestedIncompatibleQosStatus requested_incompatible_qos_status_;
 
+    //! Subscription matched status
+    SubscriptionMatchedStatus subscription_matched_status_;
+
     //! A timed callback to remove expired samples
     fastrtps::rtps::TimedEvent* lifespan_timer_ = nullptr;
 
@@ -298,6 +331,71 @@ protected:
 
     DataReader* user_datareader_ = nullptr;
 
+    //! ReadConditions created on this reader
+    std::vector<ReadCondition*> read_conditions_;
+
+    //! Number of elements on read_conditions_, so new samples do not take the mutex when there are none
+    std::atomic<size_t> num_read_conditions_;
+
+    //! Protects read_conditions_
+    std::mutex read_conditions_mutex_;
+
+    //! Serializes the updates of the triggered statuses of user_datareader_
+    std::mutex status_mutex_;
+
+    //! Copy of the triggered statuses of user_datareader_, so updates that change nothing do not take the mutex
+    std::atomic<uint32_t> triggered_statuses_;
+
+    //! Calls the data available listeners from the delivery executor
+    class DataAvailableTask : public DeliveryExecutor::Task
+    {
+    public:
+
+        DataAvailableTask(
+                DataReaderImpl* s)
+            : data_reader_(s)
+        {
+        }
+
+        void run() override
+        {
+            // Nothing of the reader is accessed after the listener returns, as the listener may delete it
+            data_reader_->notify_data_available();
+        }
+
+        DataReaderImpl* data_reader_;
+    }
+    data_available_task_;
+
+    //! Threads calling the data available listeners, when enabled on the DeliveryExecutorQos
+    std::unique_ptr<DeliveryExecutor> delivery_executor_;
+
+    /**
+     * @brief Wakes up the WaitSets waiting on the ReadConditions of this reader
+     */
+    void notify_read_conditions();
+
+    /**
+     * @brief Updates the triggered state of some statuses of the DataReader, for its StatusCondition
+     * @param status Statuses to update
+     * @param triggered Whether the statuses become triggered or not
+     */
+    void set_status_changes(
+            const StatusMask& status,
+            bool triggered);
+
+    /**
+     * @brief Clears the data_available status after a read or take, keeping it triggered while there are unread
+     * samples
+     */
+    void clear_data_available();
+
+    /**
+     * @brief Calls on_data_on_readers on the subscriber listener or, if there is none, on_data_available
+     * on the reader listener
+     */
+    void notify_data_available();
+
     /**
      * @brief A method called when a new cache change is added
      * @param change The cache change that has been added
@@ -328,6 +426,9 @@ protected:
     RequestedIncompatibleQosStatus& update_requested_incompatible_qos(
             PolicyMask incompatible_policies);
 
+    SubscriptionMatchedStatus& update_subscription_matched_status(
+            const SubscriptionMatchedStatus& status);
+
     LivelinessChangedStatus& update_liveliness_status(
             const fastrtps::LivelinessChangedStatus& status);
 
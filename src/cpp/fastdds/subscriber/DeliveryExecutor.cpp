@@ -0,0 +1,214 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeliveryExecutor.cpp
+ *
+ */
+
+#include <fastdds/subscriber/DeliveryExecutor.hpp>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+DeliveryExecutor::State::State(
+        size_t capacity)
+    : buffer(new Cell[capacity])
+    , mask(capacity - 1)
+    , enqueue_pos(0)
+    , dequeue_pos(0)
+    , idle_workers(0)
+    , running(true)
+{
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        buffer[i].sequence.store(i, std::memory_order_relaxed);
+        buffer[i].task = nullptr;
+    }
+}
+
+DeliveryExecutor::DeliveryExecutor(
+        const DeliveryExecutorQos& qos)
+{
+    size_t capacity = 2;
+    while (capacity < qos.queue_capacity)
+    {
+        capacity <<= 1;
+    }
+    state_ = std::make_shared<State>(capacity);
+
+    uint32_t thread_count = qos.thread_count > 0 ? qos.thread_count : 1;
+    threads_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        std::shared_ptr<State> state = state_;
+        threads_.push_back(create_thread([state]()
+                {
+                    run(state);
+                }, qos.thread_settings, "dds.delivery"));
+    }
+}
+
+DeliveryExecutor::~DeliveryExecutor()
+{
+    stop();
+}
+
+bool DeliveryExecutor::push(
+        Task* task)
+{
+    return state_->push(task);
+}
+
+bool DeliveryExecutor::State::push(
+        Task* task)
+{
+    if (!running.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    Cell* cell;
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        cell = &buffer[pos & mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Queue is full
+            return false;
+        }
+        else
+        {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->task = task;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    // Pairs with the fence on run(), so either the worker sees the task or we see the worker idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_workers.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        cv.notify_one();
+    }
+
+    return true;
+}
+
+bool DeliveryExecutor::State::pop(
+        Task*& task)
+{
+    Cell* cell;
+    size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        cell = &buffer[pos & mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0)
+        {
+            if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Queue is empty
+            return false;
+        }
+        else
+        {
+            pos = dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    task = cell->task;
+    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+}
+
+void DeliveryExecutor::stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(state_->mutex);
+        if (!state_->running.exchange(false))
+        {
+            return;
+        }
+        state_->cv.notify_all();
+    }
+
+    for (eprosima::thread& thread : threads_)
+    {
+        if (thread.is_calling_thread())
+        {
+            // A task is stopping its own executor. The thread keeps its reference to the state, and exits when
+            // the task returns.
+            thread.detach();
+        }
+        else if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    threads_.clear();
+}
+
+void DeliveryExecutor::run(
+        std::shared_ptr<State> state)
+{
+    Task* task = nullptr;
+    while (state->running.load(std::memory_order_relaxed))
+    {
+        if (state->pop(task))
+        {
+            task->run();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->idle_workers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (state->running.load(std::memory_order_relaxed) && !state->pop(task))
+        {
+            state->cv.wait(lock);
+        }
+        state->idle_workers.fetch_sub(1, std::memory_order_relaxed);
+        lock.unlock();
+
+        if (state->running.load(std::memory_order_relaxed))
+        {
+            task->run();
+        }
+    }
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,148 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeliveryExecutor.hpp
+ *
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_DELIVERYEXECUTOR_HPP_
+#define _FASTDDS_SUBSCRIBER_DELIVERYEXECUTOR_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastrtps/utils/thread.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Pool of threads running the tasks pushed by the receive threads.
+ *
+ * Tasks are kept on a bounded lock-free multi-producer multi-consumer ring, so pushing a task never takes a lock
+ * unless some worker is idle and has to be woken up. Workers only block when the ring is empty.
+ *
+ * The ring is shared with the threads, so a thread that stops its own executor from inside a task keeps it valid
+ * until the task returns, even if the executor is destroyed meanwhile.
+ */
+class DeliveryExecutor
+{
+public:
+
+    //! Unit of work run by the executor
+    class Task
+    {
+    public:
+
+        virtual ~Task() = default;
+
+        virtual void run() = 0;
+    };
+
+    /**
+     * Create the executor and start its threads.
+     * @param qos Number of threads, queue capacity and settings of the threads.
+     */
+    explicit DeliveryExecutor(
+            const DeliveryExecutorQos& qos);
+
+    ~DeliveryExecutor();
+
+    DeliveryExecutor(
+            const DeliveryExecutor&) = delete;
+
+    DeliveryExecutor& operator =(
+            const DeliveryExecutor&) = delete;
+
+    /**
+     * Push a task to be run by one of the threads.
+     * @param task Task to run. It should outlive the executor or the call to stop().
+     * @return false when the queue is full or the executor is stopped.
+     */
+    bool push(
+            Task* task);
+
+    /**
+     * Stop the threads and discard the pending tasks.
+     * Can be called from a task run by one of the executor threads. That thread is detached instead of joined, and
+     * exits as soon as the task returns without accessing the executor, which may already have been destroyed.
+     */
+    void stop();
+
+    //! @return the number of slots of the queue
+    size_t capacity() const
+    {
+        return state_->mask + 1;
+    }
+
+private:
+
+    //! Slot of the ring. The sequence tells whether the slot is free or holds a task for a given position.
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        Task* task;
+    };
+
+    //! Ring and synchronization shared between the executor and its threads
+    struct State
+    {
+        explicit State(
+                size_t capacity);
+
+        bool push(
+                Task* task);
+
+        bool pop(
+                Task*& task);
+
+        std::unique_ptr<Cell[]> buffer;
+
+        size_t mask;
+
+        std::atomic<size_t> enqueue_pos;
+
+        std::atomic<size_t> dequeue_pos;
+
+        std::atomic<uint32_t> idle_workers;
+
+        std::atomic<bool> running;
+
+        std::mutex mutex;
+
+        std::condition_variable cv;
+    };
+
+    static void run(
+            std::shared_ptr<State> state);
+
+    std::shared_ptr<State> state_;
+
+    std::vector<eprosima::thread> threads_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_SUBSCRIBER_DELIVERYEXECUTOR_HPP_
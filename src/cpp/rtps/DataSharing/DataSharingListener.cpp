@@ -0,0 +1,169 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingListener.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingListener.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+DataSharingListener::DataSharingListener(
+        std::shared_ptr<DataSharingNotification> notification,
+        SampleCallback callback,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t poll_period_ms)
+    : notification_(notification)
+    , callback_(callback)
+    , thread_settings_(thread_settings)
+    , poll_period_ms_(poll_period_ms)
+    , is_running_(false)
+{
+}
+
+DataSharingListener::~DataSharingListener()
+{
+    stop();
+}
+
+void DataSharingListener::start()
+{
+    if (!is_running_.exchange(true))
+    {
+        thread_ = create_thread([this]()
+                        {
+                            run();
+                        }, thread_settings_, "dds.datasharing");
+    }
+}
+
+void DataSharingListener::stop()
+{
+    if (is_running_.exchange(false))
+    {
+        notification_->notify();
+        if (thread_.joinable())
+        {
+            thread_.join();
+        }
+    }
+}
+
+bool DataSharingListener::add_writer(
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (const WriterEntry& entry : writers_)
+    {
+        if (entry.ring->writer_guid() == writer_guid)
+        {
+            return true;
+        }
+    }
+
+    std::shared_ptr<DataSharingRing> ring(DataSharingRing::open(writer_guid));
+    if (!ring)
+    {
+        return false;
+    }
+
+    WriterEntry entry;
+    entry.next_sequence = ring->last_sequence_number().to64long() + 1;
+    entry.ring = ring;
+    writers_.push_back(entry);
+    logInfo(RTPS_READER, "Using data-sharing with writer " << writer_guid);
+    return true;
+}
+
+bool DataSharingListener::remove_writer(
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto it = writers_.begin(); it != writers_.end(); ++it)
+    {
+        if (it->ring->writer_guid() == writer_guid)
+        {
+            writers_.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void DataSharingListener::process_writers()
+{
+    // Work on a copy, so the callback is not called with the mutex taken.
+    std::vector<WriterEntry> writers;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        writers = writers_;
+    }
+
+    for (WriterEntry& entry : writers)
+    {
+        uint64_t last = entry.ring->last_sequence_number().to64long();
+        if (last < entry.next_sequence)
+        {
+            continue;
+        }
+
+        // Samples older than the ring depth have already been overwritten.
+        uint64_t slot_count = entry.ring->slot_count();
+        uint64_t sequence = entry.next_sequence;
+        if (last - sequence >= slot_count)
+        {
+            sequence = last - slot_count + 1;
+        }
+
+        for (; sequence <= last; ++sequence)
+        {
+            SequenceNumber_t sequence_number(static_cast<int32_t>(sequence >> 32), static_cast<uint32_t>(sequence));
+            callback_(*entry.ring, sequence_number);
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (WriterEntry& current : writers_)
+        {
+            if (current.ring == entry.ring)
+            {
+                current.next_sequence = last + 1;
+                break;
+            }
+        }
+    }
+}
+
+void DataSharingListener::run()
+{
+    while (is_running_)
+    {
+        notification_->wait(poll_period_ms_);
+        if (!is_running_)
+        {
+            break;
+        }
+
+        process_writers();
+    }
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
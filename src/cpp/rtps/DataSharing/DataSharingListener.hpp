@@ -0,0 +1,141 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingListener.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_DATASHARING_DATASHARINGLISTENER_HPP_
+#define _FASTDDS_RTPS_DATASHARING_DATASHARINGLISTENER_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+#include <rtps/DataSharing/DataSharingRing.hpp>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastrtps/utils/thread.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Reader side of data-sharing. Owns the notification segment of a reader and a thread that, every time a matched
+ * writer notifies, takes the new samples from the rings of the writers.
+ *
+ * Rings are also checked periodically, so samples whose notification was missed are not delayed forever.
+ *
+ * @ingroup READER_MODULE
+ */
+class DataSharingListener
+{
+public:
+
+    /**
+     * Function called for each new sample on a ring.
+     * The sample is identified by the ring and its sequence number.
+     */
+    using SampleCallback = std::function<bool (DataSharingRing&, const SequenceNumber_t&)>;
+
+    /**
+     * Constructor.
+     * @param notification Notification segment of the reader.
+     * @param callback Function called for each new sample.
+     * @param thread_settings Settings of the listening thread.
+     * @param poll_period_ms Maximum time between two checks of the rings, in milliseconds.
+     */
+    DataSharingListener(
+            std::shared_ptr<DataSharingNotification> notification,
+            SampleCallback callback,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t poll_period_ms = 100);
+
+    /**
+     * Destructor. Stops the listening thread.
+     */
+    ~DataSharingListener();
+
+    // Non-copyable
+    DataSharingListener(
+            const DataSharingListener&) = delete;
+    DataSharingListener& operator =(
+            const DataSharingListener&) = delete;
+
+    /**
+     * Start the listening thread.
+     */
+    void start();
+
+    /**
+     * Stop the listening thread. The callback will not be called after this returns.
+     */
+    void stop();
+
+    /**
+     * Open the ring of a matched writer on the same host.
+     * Only the samples written from now on will be taken from the ring.
+     * @param writer_guid GUID of the writer.
+     * @return true if the writer has a ring and it was opened.
+     */
+    bool add_writer(
+            const GUID_t& writer_guid);
+
+    /**
+     * Stop taking samples from the ring of a writer.
+     * @param writer_guid GUID of the writer.
+     * @return true if the writer was using data-sharing.
+     */
+    bool remove_writer(
+            const GUID_t& writer_guid);
+
+    /**
+     * Take all the new samples from the rings. Called by the listening thread, exposed for testing purposes.
+     */
+    void process_writers();
+
+private:
+
+    struct WriterEntry
+    {
+        std::shared_ptr<DataSharingRing> ring;
+        //! First sequence number not yet taken from the ring, as a 64 bit number.
+        uint64_t next_sequence;
+    };
+
+    void run();
+
+    std::shared_ptr<DataSharingNotification> notification_;
+    SampleCallback callback_;
+    fastdds::rtps::ThreadSettings thread_settings_;
+    uint32_t poll_period_ms_;
+
+    std::mutex mutex_;
+    std::vector<WriterEntry> writers_;
+
+    std::atomic<bool> is_running_;
+    eprosima::thread thread_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_DATASHARING_DATASHARINGLISTENER_HPP_
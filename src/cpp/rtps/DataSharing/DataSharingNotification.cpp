@@ -0,0 +1,196 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingNotification.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <boost/interprocess/sync/interprocess_semaphore.hpp>
+
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using SharedMemSegment = fastdds::rtps::SharedMemSegment;
+
+/*
+ * No mutex is shared with the writers, so a process dying while notifying cannot block the others.
+ * Writers increase the counter and only post the semaphore when the reader has announced it is going to wait on it.
+ */
+struct DataSharingNotification::NotificationNode
+{
+    NotificationNode()
+        : abi_version(CURRENT_ABI_VERSION)
+        , semaphore(0)
+        , counter(0)
+        , waiting(false)
+    {
+    }
+
+    uint32_t abi_version;
+    boost::interprocess::interprocess_semaphore semaphore;
+    //! Number of notifications.
+    std::atomic<uint64_t> counter;
+    //! Whether the reader is waiting, or about to wait, on the semaphore.
+    std::atomic<bool> waiting;
+};
+
+static std::string notification_node_name()
+{
+    return "notification_node_abi" + std::to_string(DataSharingNotification::CURRENT_ABI_VERSION);
+}
+
+std::string DataSharingNotification::segment_name(
+        const GUID_t& reader_guid)
+{
+    std::ostringstream name;
+    name << "fastrtps_dsn_" << std::hex << std::setfill('0');
+    for (octet value : reader_guid.guidPrefix.value)
+    {
+        name << std::setw(2) << static_cast<uint32_t>(value);
+    }
+    for (octet value : reader_guid.entityId.value)
+    {
+        name << std::setw(2) << static_cast<uint32_t>(value);
+    }
+    return name.str();
+}
+
+std::shared_ptr<DataSharingNotification> DataSharingNotification::create(
+        const GUID_t& reader_guid)
+{
+    std::string name = segment_name(reader_guid);
+    try
+    {
+        uint32_t extra_size = SharedMemSegment::compute_per_allocation_extra_size(
+            alignof(NotificationNode), "fastrtps_dsn");
+
+        SharedMemSegment::remove(name);
+        std::unique_ptr<SharedMemSegment> segment(new SharedMemSegment(
+                    SharedMemSegment::create_only, name, sizeof(NotificationNode) + extra_size));
+
+        NotificationNode* node = segment->get().construct<NotificationNode>(notification_node_name().c_str())();
+
+        return std::shared_ptr<DataSharingNotification>(
+            new DataSharingNotification(std::move(segment), node, true));
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(RTPS_READER, "Cannot create data-sharing segment " << name << ": " << e.what());
+        SharedMemSegment::remove(name);
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<DataSharingNotification> DataSharingNotification::open(
+        const GUID_t& reader_guid)
+{
+    try
+    {
+        std::unique_ptr<SharedMemSegment> segment(new SharedMemSegment(
+                    SharedMemSegment::open_only, segment_name(reader_guid)));
+        NotificationNode* node = segment->get().find<NotificationNode>(notification_node_name().c_str()).first;
+        if (node == nullptr || node->abi_version != CURRENT_ABI_VERSION)
+        {
+            return nullptr;
+        }
+
+        return std::shared_ptr<DataSharingNotification>(
+            new DataSharingNotification(std::move(segment), node, false));
+    }
+    catch (const std::exception&)
+    {
+        // The reader does not use data-sharing
+    }
+
+    return nullptr;
+}
+
+DataSharingNotification::DataSharingNotification(
+        std::unique_ptr<SharedMemSegment> segment,
+        NotificationNode* node,
+        bool is_owner)
+    : segment_(std::move(segment))
+    , node_(node)
+    , last_seen_(0)
+    , is_owner_(is_owner)
+{
+}
+
+DataSharingNotification::~DataSharingNotification()
+{
+    std::string name = segment_->name();
+    segment_.reset();
+    if (is_owner_)
+    {
+        SharedMemSegment::remove(name);
+    }
+}
+
+void DataSharingNotification::notify()
+{
+    node_->counter.fetch_add(1);
+    if (node_->waiting.exchange(false))
+    {
+        try
+        {
+            node_->semaphore.post();
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(RTPS_WRITER, "Cannot notify data-sharing reader: " << e.what());
+        }
+    }
+}
+
+bool DataSharingNotification::wait(
+        uint32_t timeout_ms)
+{
+    // Announce the wait before checking the counter, so a writer increasing it afterwards posts the semaphore.
+    node_->waiting.store(true);
+    if (node_->counter.load() == last_seen_)
+    {
+        try
+        {
+            boost::posix_time::ptime const timeout =
+                    boost::posix_time::microsec_clock::universal_time() +
+                    boost::posix_time::milliseconds(timeout_ms);
+            node_->semaphore.timed_wait(timeout);
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(RTPS_READER, "Error waiting for data-sharing notifications: " << e.what());
+        }
+    }
+    // A post left by a writer that saw this flag after the counter was checked only causes an early wake-up.
+    node_->waiting.store(false);
+
+    uint64_t counter = node_->counter.load();
+    bool notified = counter != last_seen_;
+    last_seen_ = counter;
+    return notified;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,119 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingNotification.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_DATASHARING_DATASHARINGNOTIFICATION_HPP_
+#define _FASTDDS_RTPS_DATASHARING_DATASHARINGNOTIFICATION_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/Guid.h>
+
+#include <rtps/transport/shared_mem/SharedMemSegment.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Shared memory node used by the writers to tell a reader on the same host that there are new samples on their
+ * data-sharing rings.
+ *
+ * The segment is created by the reader and named after its GUID. Writers open it when they match the reader.
+ * Notifications are counted, so a notification sent while the reader is not waiting is not lost.
+ * Notifying never blocks the writer, even if a reader process died while waiting.
+ *
+ * @ingroup READER_MODULE
+ */
+class DataSharingNotification
+{
+public:
+
+    //! Version of the shared memory layout. Changed whenever the layout is not backwards compatible.
+    static constexpr uint32_t CURRENT_ABI_VERSION = 2;
+
+    /**
+     * Create the notification segment of a reader. Any stale segment with the same name is removed first.
+     * @param reader_guid GUID of the reader.
+     * @return The new notification, or nullptr if it could not be created.
+     */
+    static std::shared_ptr<DataSharingNotification> create(
+            const GUID_t& reader_guid);
+
+    /**
+     * Open the notification segment of a reader on the same host.
+     * @param reader_guid GUID of the reader.
+     * @return The notification, or nullptr if the reader does not use data-sharing.
+     */
+    static std::shared_ptr<DataSharingNotification> open(
+            const GUID_t& reader_guid);
+
+    /**
+     * @return Name of the shared memory segment holding the notification node of a reader.
+     */
+    static std::string segment_name(
+            const GUID_t& reader_guid);
+
+    /**
+     * Destructor. The segment is removed when this is the notification created by the reader.
+     */
+    ~DataSharingNotification();
+
+    // Non-copyable
+    DataSharingNotification(
+            const DataSharingNotification&) = delete;
+    DataSharingNotification& operator =(
+            const DataSharingNotification&) = delete;
+
+    /**
+     * Wake up the reader. Never blocks, so it can be called with the writer mutex taken.
+     */
+    void notify();
+
+    /**
+     * Wait for a notification. Only the reader owning the segment should call this.
+     * @param timeout_ms Maximum time to wait, in milliseconds.
+     * @return true if there were notifications since the last call, false on timeout.
+     */
+    bool wait(
+            uint32_t timeout_ms);
+
+private:
+
+    struct NotificationNode;
+
+    DataSharingNotification(
+            std::unique_ptr<fastdds::rtps::SharedMemSegment> segment,
+            NotificationNode* node,
+            bool is_owner);
+
+    std::unique_ptr<fastdds::rtps::SharedMemSegment> segment_;
+    NotificationNode* node_;
+    uint64_t last_seen_;
+    bool is_owner_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_DATASHARING_DATASHARINGNOTIFICATION_HPP_
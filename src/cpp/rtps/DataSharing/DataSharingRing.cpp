@@ -0,0 +1,343 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingRing.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingRing.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <new>
+#include <sstream>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using SharedMemSegment = fastdds::rtps::SharedMemSegment;
+
+//! Alignment of the slots, so two slots never share a cache line.
+static constexpr uint32_t slot_alignment = 64;
+
+//! Biggest segment allowed. Offsets on the segment are 32 bits wide.
+static constexpr uint64_t max_segment_size = 0x7FFFFFFFull;
+
+struct DataSharingRing::RingNode
+{
+    uint32_t abi_version;
+    uint32_t slot_count;
+    uint32_t max_payload_size;
+    uint32_t slot_size;
+    SharedMemSegment::Offset slots;
+    std::atomic<uint64_t> last_sequence;
+};
+
+struct DataSharingRing::SlotHeader
+{
+    //! Sequence lock. Odd while the slot is being written.
+    std::atomic<uint64_t> version;
+    uint64_t sequence;
+    Time_t source_timestamp;
+    InstanceHandle_t instance_handle;
+    SampleIdentity related_sample_identity;
+    uint32_t kind;
+    uint32_t length;
+    uint16_t encapsulation;
+};
+
+static constexpr uint32_t align_up(
+        uint64_t size,
+        uint32_t alignment)
+{
+    return static_cast<uint32_t>((size + alignment - 1) / alignment * alignment);
+}
+
+uint32_t DataSharingRing::payload_offset()
+{
+    return align_up(sizeof(SlotHeader), 8);
+}
+
+std::string DataSharingRing::segment_name(
+        const GUID_t& writer_guid)
+{
+    std::ostringstream name;
+    name << "fastrtps_ds_" << std::hex << std::setfill('0');
+    for (octet value : writer_guid.guidPrefix.value)
+    {
+        name << std::setw(2) << static_cast<uint32_t>(value);
+    }
+    for (octet value : writer_guid.entityId.value)
+    {
+        name << std::setw(2) << static_cast<uint32_t>(value);
+    }
+    return name.str();
+}
+
+#if HAVE_SECURITY
+bool DataSharingRing::is_allowed(
+        const security::ParticipantSecurityAttributes& participant_attributes,
+        const security::EndpointSecurityAttributes& local_attributes,
+        security::EndpointSecurityAttributesMask remote_attributes)
+{
+    const security::EndpointSecurityAttributesMask protected_mask =
+            ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_PROTECTED |
+            ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_PROTECTED;
+
+    return !participant_attributes.is_rtps_protected &&
+           !local_attributes.is_submessage_protected &&
+           !local_attributes.is_payload_protected &&
+           (0 == (remote_attributes & protected_mask));
+}
+
+#endif // if HAVE_SECURITY
+
+std::unique_ptr<DataSharingRing> DataSharingRing::create(
+        const GUID_t& writer_guid,
+        uint32_t slot_count,
+        uint32_t max_payload_size)
+{
+    if (slot_count == 0 || max_payload_size == 0)
+    {
+        return nullptr;
+    }
+
+    uint32_t slot_size = align_up(static_cast<uint64_t>(payload_offset()) + max_payload_size, slot_alignment);
+    uint64_t slots_size = static_cast<uint64_t>(slot_size) * slot_count;
+    if (slots_size + sizeof(RingNode) + 2 * slot_alignment > max_segment_size)
+    {
+        logWarning(RTPS_WRITER, "Data-sharing ring of writer " << writer_guid << " would need " << slots_size <<
+                " bytes. Data-sharing disabled");
+        return nullptr;
+    }
+
+    std::string name = segment_name(writer_guid);
+    try
+    {
+        uint32_t extra_size = SharedMemSegment::compute_per_allocation_extra_size(slot_alignment, "fastrtps_ds");
+        size_t segment_size = static_cast<size_t>(slots_size) + sizeof(RingNode) + 2 * (extra_size + slot_alignment);
+
+        SharedMemSegment::remove(name);
+        std::unique_ptr<SharedMemSegment> segment(new SharedMemSegment(
+                    SharedMemSegment::create_only, name, segment_size));
+
+        RingNode* node = segment->get().construct<RingNode>(
+            ("ring_node_abi" + std::to_string(CURRENT_ABI_VERSION)).c_str())();
+        void* slots = segment->get().allocate_aligned(static_cast<size_t>(slots_size), slot_alignment);
+
+        uint8_t* slot_address = static_cast<uint8_t*>(slots);
+        for (uint32_t i = 0; i < slot_count; ++i, slot_address += slot_size)
+        {
+            SlotHeader* header = new (slot_address) SlotHeader();
+            header->version.store(0, std::memory_order_relaxed);
+            header->sequence = 0;
+            header->length = 0;
+        }
+
+        node->abi_version = CURRENT_ABI_VERSION;
+        node->slot_count = slot_count;
+        node->max_payload_size = max_payload_size;
+        node->slot_size = slot_size;
+        node->slots = segment->get_offset_from_address(slots);
+        node->last_sequence.store(0, std::memory_order_release);
+
+        return std::unique_ptr<DataSharingRing>(new DataSharingRing(writer_guid, std::move(segment), node, true));
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(RTPS_WRITER, "Cannot create data-sharing segment " << name << ": " << e.what());
+        SharedMemSegment::remove(name);
+    }
+
+    return nullptr;
+}
+
+std::unique_ptr<DataSharingRing> DataSharingRing::open(
+        const GUID_t& writer_guid)
+{
+    std::string name = segment_name(writer_guid);
+    try
+    {
+        std::unique_ptr<SharedMemSegment> segment(new SharedMemSegment(SharedMemSegment::open_only, name));
+        RingNode* node = segment->get().find<RingNode>(
+            ("ring_node_abi" + std::to_string(CURRENT_ABI_VERSION)).c_str()).first;
+        if (node == nullptr || node->abi_version != CURRENT_ABI_VERSION)
+        {
+            logInfo(RTPS_READER, "Data-sharing segment " << name << " is not compatible");
+            return nullptr;
+        }
+
+        return std::unique_ptr<DataSharingRing>(new DataSharingRing(writer_guid, std::move(segment), node, false));
+    }
+    catch (const std::exception&)
+    {
+        // The writer has no data-sharing ring
+    }
+
+    return nullptr;
+}
+
+DataSharingRing::DataSharingRing(
+        const GUID_t& writer_guid,
+        std::unique_ptr<SharedMemSegment> segment,
+        RingNode* node,
+        bool is_owner)
+    : writer_guid_(writer_guid)
+    , segment_(std::move(segment))
+    , node_(node)
+    , slots_(static_cast<uint8_t*>(segment_->get_address_from_offset(node->slots)))
+    , is_owner_(is_owner)
+{
+}
+
+DataSharingRing::~DataSharingRing()
+{
+    std::string name = segment_->name();
+    segment_.reset();
+    if (is_owner_)
+    {
+        SharedMemSegment::remove(name);
+    }
+}
+
+uint32_t DataSharingRing::slot_count() const
+{
+    return node_->slot_count;
+}
+
+uint32_t DataSharingRing::max_payload_size() const
+{
+    return node_->max_payload_size;
+}
+
+DataSharingRing::SlotHeader* DataSharingRing::slot(
+        uint64_t sequence) const
+{
+    return reinterpret_cast<SlotHeader*>(slots_ + (sequence % node_->slot_count) * node_->slot_size);
+}
+
+bool DataSharingRing::write(
+        const CacheChange_t& change)
+{
+    uint32_t length = change.serializedPayload.length;
+    if (length > node_->max_payload_size)
+    {
+        logWarning(RTPS_WRITER, "Change " << change.sequenceNumber << " does not fit on the data-sharing ring");
+        return false;
+    }
+
+    uint64_t sequence = change.sequenceNumber.to64long();
+    SlotHeader* header = slot(sequence);
+
+    uint64_t version = header->version.load(std::memory_order_relaxed);
+    header->version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    header->sequence = sequence;
+    header->source_timestamp = change.sourceTimestamp;
+    header->instance_handle = change.instanceHandle;
+    header->related_sample_identity = change.write_params.related_sample_identity();
+    header->kind = static_cast<uint32_t>(change.kind);
+    header->length = length;
+    header->encapsulation = change.serializedPayload.encapsulation;
+    if (length > 0)
+    {
+        memcpy(reinterpret_cast<uint8_t*>(header) + payload_offset(), change.serializedPayload.data, length);
+    }
+
+    header->version.store(version + 2, std::memory_order_release);
+
+    uint64_t last = node_->last_sequence.load(std::memory_order_relaxed);
+    while (last < sequence &&
+            !node_->last_sequence.compare_exchange_weak(last, sequence, std::memory_order_release))
+    {
+    }
+
+    return true;
+}
+
+SequenceNumber_t DataSharingRing::last_sequence_number() const
+{
+    uint64_t last = node_->last_sequence.load(std::memory_order_acquire);
+    return SequenceNumber_t(static_cast<int32_t>(last >> 32), static_cast<uint32_t>(last));
+}
+
+bool DataSharingRing::get_payload_length(
+        const SequenceNumber_t& sequence_number,
+        uint32_t& length) const
+{
+    uint64_t sequence = sequence_number.to64long();
+    const SlotHeader* header = slot(sequence);
+
+    uint64_t version = header->version.load(std::memory_order_acquire);
+    if (version & 1u)
+    {
+        return false;
+    }
+
+    bool found = header->sequence == sequence;
+    length = header->length;
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return found && version == header->version.load(std::memory_order_relaxed) &&
+           length <= node_->max_payload_size;
+}
+
+bool DataSharingRing::read(
+        const SequenceNumber_t& sequence_number,
+        CacheChange_t& change) const
+{
+    uint64_t sequence = sequence_number.to64long();
+    const SlotHeader* header = slot(sequence);
+
+    uint64_t version = header->version.load(std::memory_order_acquire);
+    if ((version & 1u) || header->sequence != sequence)
+    {
+        return false;
+    }
+
+    uint32_t length = header->length;
+    if (length > node_->max_payload_size || length > change.serializedPayload.max_size)
+    {
+        return false;
+    }
+
+    change.kind = static_cast<ChangeKind_t>(header->kind);
+    change.writerGUID = writer_guid_;
+    change.sequenceNumber = sequence_number;
+    change.sourceTimestamp = header->source_timestamp;
+    change.instanceHandle = header->instance_handle;
+    // Same as intraprocess delivery: the related sample identity is seen as the identity of the sample.
+    if (header->related_sample_identity != SampleIdentity::unknown())
+    {
+        change.write_params.sample_identity(header->related_sample_identity);
+    }
+    change.serializedPayload.encapsulation = header->encapsulation;
+    change.serializedPayload.length = length;
+    if (length > 0)
+    {
+        memcpy(change.serializedPayload.data, reinterpret_cast<const uint8_t*>(header) + payload_offset(), length);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return version == header->version.load(std::memory_order_relaxed);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,205 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingRing.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_DATASHARING_DATASHARINGRING_HPP_
+#define _FASTDDS_RTPS_DATASHARING_DATASHARINGRING_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastrtps/config.h>
+
+#if HAVE_SECURITY
+#include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
+#include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
+#endif // if HAVE_SECURITY
+
+#include <rtps/transport/shared_mem/SharedMemSegment.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Ring of samples published by a writer on a shared memory segment, so readers on the same host can take them
+ * without going through the RTPS message path.
+ *
+ * The segment is created by the writer and named after its GUID. It has one slot per sample the writer history can
+ * hold, each one big enough for the maximum payload of the history. The sample with sequence number N is stored on
+ * slot N % slot_count, so a slot is only reused once the history has moved past the previous sample stored on it.
+ *
+ * Each slot is protected by a sequence lock: the writer never waits for the readers, and a reader that finds the
+ * slot being written, or overwritten while it was copying it, discards what it read. Reliable readers will then get
+ * the sample through the regular repair mechanism.
+ *
+ * @ingroup WRITER_MODULE
+ */
+class DataSharingRing
+{
+public:
+
+    //! Version of the shared memory layout. Changed whenever the layout is not backwards compatible.
+    static constexpr uint32_t CURRENT_ABI_VERSION = 1;
+
+    /**
+     * Create the ring of a writer. Any stale segment with the same name is removed first.
+     *
+     * @param writer_guid GUID of the writer owning the ring.
+     * @param slot_count Number of samples on the ring.
+     * @param max_payload_size Maximum serialized payload size of a sample.
+     *
+     * @return The new ring, or nullptr if it could not be created.
+     */
+    static std::unique_ptr<DataSharingRing> create(
+            const GUID_t& writer_guid,
+            uint32_t slot_count,
+            uint32_t max_payload_size);
+
+    /**
+     * Open the ring of a writer from a reader on the same host.
+     *
+     * @param writer_guid GUID of the writer owning the ring.
+     *
+     * @return The ring, or nullptr if the writer has no ring or it is not compatible.
+     */
+    static std::unique_ptr<DataSharingRing> open(
+            const GUID_t& writer_guid);
+
+    /**
+     * @return Name of the shared memory segment holding the ring of a writer.
+     */
+    static std::string segment_name(
+            const GUID_t& writer_guid);
+
+#if HAVE_SECURITY
+    /**
+     * Check whether two endpoints may exchange samples through data-sharing.
+     * Samples on the shared memory segments are not protected, so endpoints whose RTPS messages, submessages or
+     * payloads should be protected by the crypto plugin only use the network.
+     *
+     * @param participant_attributes Security attributes of the local participant.
+     * @param local_attributes Security attributes of the local endpoint.
+     * @param remote_attributes Security attributes announced by the remote endpoint.
+     *
+     * @return true if data-sharing may be used.
+     */
+    static bool is_allowed(
+            const security::ParticipantSecurityAttributes& participant_attributes,
+            const security::EndpointSecurityAttributes& local_attributes,
+            security::EndpointSecurityAttributesMask remote_attributes);
+#endif // if HAVE_SECURITY
+
+    /**
+     * Destructor. The segment is removed when this is the ring created by the writer.
+     */
+    ~DataSharingRing();
+
+    // Non-copyable
+    DataSharingRing(
+            const DataSharingRing&) = delete;
+    DataSharingRing& operator =(
+            const DataSharingRing&) = delete;
+
+    /**
+     * Store a sample on the ring. Only the writer owning the ring should call this.
+     *
+     * @param change Change to store.
+     *
+     * @return false if the payload does not fit on a slot.
+     */
+    bool write(
+            const CacheChange_t& change);
+
+    /**
+     * @return Highest sequence number stored on the ring, or SequenceNumber_t() when the ring is empty.
+     */
+    SequenceNumber_t last_sequence_number() const;
+
+    /**
+     * Get the length of the payload of a sample.
+     *
+     * @param sequence_number Sequence number of the sample.
+     * @param [out] length Where the length of the payload is returned.
+     *
+     * @return false if the sample is no longer (or not yet) on the ring.
+     */
+    bool get_payload_length(
+            const SequenceNumber_t& sequence_number,
+            uint32_t& length) const;
+
+    /**
+     * Copy a sample from the ring.
+     *
+     * @param sequence_number Sequence number of the sample.
+     * @param [out] change Where the sample is copied. Its payload should be big enough to hold the sample.
+     *
+     * @return false if the sample is no longer on the ring, does not fit on the change, or was overwritten while
+     * being copied. The contents of the change should be discarded in that case.
+     */
+    bool read(
+            const SequenceNumber_t& sequence_number,
+            CacheChange_t& change) const;
+
+    //! @return GUID of the writer owning the ring.
+    const GUID_t& writer_guid() const
+    {
+        return writer_guid_;
+    }
+
+    //! @return Number of samples on the ring.
+    uint32_t slot_count() const;
+
+    //! @return Maximum serialized payload size of a sample.
+    uint32_t max_payload_size() const;
+
+private:
+
+    struct RingNode;
+    struct SlotHeader;
+
+    DataSharingRing(
+            const GUID_t& writer_guid,
+            std::unique_ptr<fastdds::rtps::SharedMemSegment> segment,
+            RingNode* node,
+            bool is_owner);
+
+    //! Offset of the payload from the beginning of a slot.
+    static uint32_t payload_offset();
+
+    SlotHeader* slot(
+            uint64_t sequence) const;
+
+    GUID_t writer_guid_;
+    std::unique_ptr<fastdds::rtps::SharedMemSegment> segment_;
+    RingNode* node_;
+    uint8_t* slots_;
+    bool is_owner_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_DATASHARING_DATASHARINGRING_HPP_
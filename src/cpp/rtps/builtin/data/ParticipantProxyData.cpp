@@ -688,6 +688,7 @@ void ParticipantProxyData::clear()
     m_leaseDuration = Duration_t();
     lease_duration_ = std::chrono::microseconds::zero();
     isAlive = true;
+    announcement_digest.clear();
 #if HAVE_SECURITY
     identity_token_ = IdentityToken();
     permissions_token_ = PermissionsToken();
@@ -92,13 +92,16 @@ const std::vector<GUID_t>& DirectMessageSender::remote_guids() const
  * Send a message through this interface.
  *
  * @param message Pointer to the buffer with the message already serialized.
+ * @param buffers Gather list describing the message.
  * @param max_blocking_time_point Future timepoint where blocking send should end.
  */
 bool DirectMessageSender::send(
         CDRMessage_t* message,
+        const std::vector<NetworkBuffer>& buffers,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
-    return participant_->sendSync(message, Locators(locators_->begin()), Locators(locators_->end()), max_blocking_time_point);
+    return participant_->sendSync(message, buffers, Locators(locators_->begin()), Locators(locators_->end()),
+                   max_blocking_time_point);
 }
 
 } /* namespace rtps */
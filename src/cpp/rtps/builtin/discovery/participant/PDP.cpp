@@ -75,6 +75,13 @@ const Duration_t pdp_heartbeat_response_delay{ 0, 11 * 1000000 }; // 11 millisec
 
 const int32_t pdp_initial_reserved_caches = 20;
 
+//! Number of proxies created along the PDP, which is zero when the builtin allocation is lazy
+static size_t preallocated_proxies(
+        const BuiltinProtocols* built,
+        const ResourceLimitedContainerConfig& allocation)
+{
+    return built->m_att.lazy_builtin_allocation ? 0u : allocation.initial;
+}
 
 PDP::PDP (
         BuiltinProtocols* built,
@@ -84,12 +91,13 @@ PDP::PDP (
     , mp_PDPWriter(nullptr)
     , mp_PDPReader(nullptr)
     , mp_EDP(nullptr)
-    , participant_proxies_number_(allocation.participants.initial)
+    , participant_proxies_number_(preallocated_proxies(built, allocation.participants))
     , participant_proxies_(allocation.participants)
+    , participant_proxies_index_(new ParticipantProxyHashTable(allocation.participants))
     , participant_proxies_pool_(allocation.participants)
-    , reader_proxies_number_(allocation.total_readers().initial)
+    , reader_proxies_number_(preallocated_proxies(built, allocation.total_readers()))
     , reader_proxies_pool_(allocation.total_readers())
-    , writer_proxies_number_(allocation.total_writers().initial)
+    , writer_proxies_number_(preallocated_proxies(built, allocation.total_writers()))
     , writer_proxies_pool_(allocation.total_writers())
     , m_hasChangedLocalPDP(true)
     , mp_listener(nullptr)
@@ -105,18 +113,18 @@ PDP::PDP (
     size_t max_unicast_locators = allocation.locators.max_unicast_locators;
     size_t max_multicast_locators = allocation.locators.max_multicast_locators;
 
-    for (size_t i = 0; i < allocation.participants.initial; ++i)
+    for (size_t i = 0; i < participant_proxies_number_; ++i)
     {
         participant_proxies_pool_.push_back(new ParticipantProxyData(allocation));
     }
 
-    for (size_t i = 0; i < allocation.total_readers().initial; ++i)
+    for (size_t i = 0; i < reader_proxies_number_; ++i)
     {
         reader_proxies_pool_.push_back(new ReaderProxyData(max_unicast_locators, max_multicast_locators,
                 allocation.data_limits));
     }
 
-    for (size_t i = 0; i < allocation.total_writers().initial; ++i)
+    for (size_t i = 0; i < writer_proxies_number_; ++i)
     {
         writer_proxies_pool_.push_back(new WriterProxyData(max_unicast_locators, max_multicast_locators,
                 allocation.data_limits));
@@ -144,6 +152,8 @@ PDP::~PDP()
         delete it;
     }
 
+    delete participant_proxies_index_;
+
     for (ReaderProxyData* it : reader_proxies_pool_)
     {
         delete it;
@@ -200,10 +210,18 @@ ParticipantProxyData* PDP::add_participant_proxy_data(
     ret_val->should_check_lease_duration = with_lease_duration;
     ret_val->m_guid = participant_guid;
     participant_proxies_.push_back(ret_val);
+    participant_proxies_index_->insert_or_assign(participant_guid.guidPrefix, ret_val);
 
     return ret_val;
 }
 
+ParticipantProxyData* PDP::find_participant_proxy_data(
+        const GuidPrefix_t& guid_prefix) const
+{
+    auto it = participant_proxies_index_->find(guid_prefix);
+    return it != participant_proxies_index_->end() ? it->second : nullptr;
+}
+
 void PDP::initializeParticipantProxyData(
         ParticipantProxyData* participant_data)
 {
@@ -490,13 +508,11 @@ bool PDP::has_reader_proxy_data(
         const GUID_t& reader)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(reader.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader.guidPrefix)
-        {
-            ProxyHashTable<ReaderProxyData>& readers = *pit->m_readers;
-            return readers.find(reader.entityId) != readers.end();
-        }
+        ProxyHashTable<ReaderProxyData>& readers = *pit->m_readers;
+        return readers.find(reader.entityId) != readers.end();
     }
     return false;
 }
@@ -506,16 +522,14 @@ bool PDP::lookupReaderProxyData(
         ReaderProxyData& rdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(reader.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader.guidPrefix)
+        auto rit = pit->m_readers->find(reader.entityId);
+        if (rit != pit->m_readers->end())
         {
-            auto rit = pit->m_readers->find(reader.entityId);
-            if (rit != pit->m_readers->end())
-            {
-                rdata.copy(rit->second);
-                return true;
-            }
+            rdata.copy(rit->second);
+            return true;
         }
     }
     return false;
@@ -525,13 +539,11 @@ bool PDP::has_writer_proxy_data(
         const GUID_t& writer)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(writer.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer.guidPrefix)
-        {
-            ProxyHashTable<WriterProxyData>& writers = *pit->m_writers;
-            return writers.find(writer.entityId) != writers.end();
-        }
+        ProxyHashTable<WriterProxyData>& writers = *pit->m_writers;
+        return writers.find(writer.entityId) != writers.end();
     }
     return false;
 }
@@ -541,16 +553,14 @@ bool PDP::lookupWriterProxyData(
         WriterProxyData& wdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(writer.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer.guidPrefix)
+        auto wit = pit->m_writers->find(writer.entityId);
+        if ( wit != pit->m_writers->end() )
         {
-            auto wit = pit->m_writers->find(writer.entityId);
-            if ( wit != pit->m_writers->end() )
-            {
-                wdata.copy(wit->second);
-                return true;
-            }
+            wdata.copy(wit->second);
+            return true;
         }
     }
     return false;
@@ -562,31 +572,29 @@ bool PDP::removeReaderProxyData(
     logInfo(RTPS_PDP, "Removing reader proxy data " << reader_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(reader_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader_guid.guidPrefix)
+        auto rit = pit->m_readers->find(reader_guid.entityId);
+
+        if (rit != pit->m_readers->end())
         {
-            auto rit = pit->m_readers->find(reader_guid.entityId);
+            ReaderProxyData* pR = rit->second;
+            mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
 
-            if (rit != pit->m_readers->end())
+            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+            if (listener)
             {
-                ReaderProxyData* pR = rit->second;
-                mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    ReaderDiscoveryInfo info(std::move(*pR));
-                    info.status = ReaderDiscoveryInfo::REMOVED_READER;
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
-
-                // Clear reader proxy data and move to pool in order to allow reuse
-                pR->clear();
-                pit->m_readers->erase(rit);
-                reader_proxies_pool_.push_back(pR);
-                return true;
+                ReaderDiscoveryInfo info(std::move(*pR));
+                info.status = ReaderDiscoveryInfo::REMOVED_READER;
+                listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
             }
+
+            // Clear reader proxy data and move to pool in order to allow reuse
+            pR->clear();
+            pit->m_readers->erase(rit);
+            reader_proxies_pool_.push_back(pR);
+            return true;
         }
     }
 
@@ -599,32 +607,30 @@ bool PDP::removeWriterProxyData(
     logInfo(RTPS_PDP, "Removing writer proxy data " << writer_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(writer_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer_guid.guidPrefix)
+        auto wit = pit->m_writers->find(writer_guid.entityId);
+
+        if (wit != pit->m_writers->end())
         {
-            auto wit = pit->m_writers->find(writer_guid.entityId);
+            WriterProxyData* pW = wit->second;
+            mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid);
 
-            if (wit != pit->m_writers->end())
+            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+            if (listener)
             {
-                WriterProxyData* pW = wit->second;
-                mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid);
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    WriterDiscoveryInfo info(std::move(*pW));
-                    info.status = WriterDiscoveryInfo::REMOVED_WRITER;
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
+                WriterDiscoveryInfo info(std::move(*pW));
+                info.status = WriterDiscoveryInfo::REMOVED_WRITER;
+                listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            }
 
-                // Clear writer proxy data and move to pool in order to allow reuse
-                pW->clear();
-                pit->m_writers->erase(wit);
-                writer_proxies_pool_.push_back(pW);
+            // Clear writer proxy data and move to pool in order to allow reuse
+            pW->clear();
+            pit->m_writers->erase(wit);
+            writer_proxies_pool_.push_back(pW);
 
-                return true;
-            }
+            return true;
         }
     }
 
@@ -636,13 +642,11 @@ bool PDP::lookup_participant_name(
         string_255& name)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(guid.guidPrefix);
+    if (pit != nullptr && pit->m_guid == guid)
     {
-        if (pit->m_guid == guid)
-        {
-            name = pit->m_participantName;
-            return true;
-        }
+        name = pit->m_participantName;
+        return true;
     }
     return false;
 }
@@ -652,13 +656,11 @@ bool PDP::lookup_participant_key(
         InstanceHandle_t& key)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(participant_guid.guidPrefix);
+    if (pit != nullptr && pit->m_guid == participant_guid)
     {
-        if (pit->m_guid == participant_guid)
-        {
-            key = pit->m_key;
-            return true;
-        }
+        key = pit->m_key;
+        return true;
     }
     return false;
 }
@@ -673,68 +675,20 @@ ReaderProxyData* PDP::addReaderProxyData(
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(reader_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader_guid.guidPrefix)
-        {
-            // Copy participant data to be used outside.
-            participant_guid = pit->m_guid;
-
-            // Check that it is not already there:
-            auto rpi = pit->m_readers->find(reader_guid.entityId);
-
-            if ( rpi != pit->m_readers->end())
-            {
-                ret_val = rpi->second;
-
-                if (!initializer_func(ret_val, true, *pit))
-                {
-                    return nullptr;
-                }
+        // Copy participant data to be used outside.
+        participant_guid = pit->m_guid;
 
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    ReaderDiscoveryInfo info(*ret_val);
-                    info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    check_and_notify_type_discovery(listener, *ret_val);
-                }
-
-                return ret_val;
-            }
-
-            // Try to take one entry from the pool
-            if (reader_proxies_pool_.empty())
-            {
-                size_t max_proxies = reader_proxies_pool_.max_size();
-                if (reader_proxies_number_ < max_proxies)
-                {
-                    // Pool is empty but limit has not been reached, so we create a new entry.
-                    ++reader_proxies_number_;
-                    ret_val = new ReaderProxyData(
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.data_limits);
-                }
-                else
-                {
-                    logWarning(RTPS_PDP, "Maximum number of reader proxies (" << max_proxies <<
-                            ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                // Pool is not empty, use entry from pool
-                ret_val = reader_proxies_pool_.back();
-                reader_proxies_pool_.pop_back();
-            }
+        // Check that it is not already there:
+        auto rpi = pit->m_readers->find(reader_guid.entityId);
 
-            // Add to ParticipantProxyData
-            (*pit->m_readers)[reader_guid.entityId] = ret_val;
+        if ( rpi != pit->m_readers->end())
+        {
+            ret_val = rpi->second;
 
-            if (!initializer_func(ret_val, false, *pit))
+            if (!initializer_func(ret_val, true, *pit))
             {
                 return nullptr;
             }
@@ -743,13 +697,64 @@ ReaderProxyData* PDP::addReaderProxyData(
             if (listener)
             {
                 ReaderDiscoveryInfo info(*ret_val);
-                info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+                info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
                 listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
                 check_and_notify_type_discovery(listener, *ret_val);
             }
 
             return ret_val;
         }
+
+        // Try to take one entry from the pool
+        if (reader_proxies_pool_.empty())
+        {
+            size_t max_proxies = reader_proxies_pool_.max_size();
+            if (reader_proxies_number_ < max_proxies)
+            {
+                // Pool is empty but limit has not been reached, so we create a new entry.
+                ++reader_proxies_number_;
+                ret_val = new ReaderProxyData(
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.data_limits);
+            }
+            else
+            {
+                logWarning(RTPS_PDP, "Maximum number of reader proxies (" << max_proxies <<
+                        ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
+                return nullptr;
+            }
+        }
+        else
+        {
+            // Pool is not empty, use entry from pool
+            ret_val = reader_proxies_pool_.back();
+            reader_proxies_pool_.pop_back();
+        }
+
+        // Add to ParticipantProxyData
+        if (!pit->m_readers->try_emplace(reader_guid.entityId, ret_val).second)
+        {
+            logWarning(RTPS_PDP, "Maximum number of reader proxies reached for participant " << pit->m_guid);
+            reader_proxies_pool_.push_back(ret_val);
+            return nullptr;
+        }
+
+        if (!initializer_func(ret_val, false, *pit))
+        {
+            return nullptr;
+        }
+
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if (listener)
+        {
+            ReaderDiscoveryInfo info(*ret_val);
+            info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+            listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            check_and_notify_type_discovery(listener, *ret_val);
+        }
+
+        return ret_val;
     }
 
     return nullptr;
@@ -765,68 +770,20 @@ WriterProxyData* PDP::addWriterProxyData(
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy_data(writer_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer_guid.guidPrefix)
-        {
-            // Copy participant data to be used outside.
-            participant_guid = pit->m_guid;
-
-            // Check that it is not already there:
-            auto wpi = pit->m_writers->find(writer_guid.entityId);
-
-            if (wpi != pit->m_writers->end())
-            {
-                ret_val = wpi->second;
-
-                if (!initializer_func(ret_val, true, *pit))
-                {
-                    return nullptr;
-                }
+        // Copy participant data to be used outside.
+        participant_guid = pit->m_guid;
 
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    WriterDiscoveryInfo info(*ret_val);
-                    info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    check_and_notify_type_discovery(listener, *ret_val);
-                }
-
-                return ret_val;
-            }
+        // Check that it is not already there:
+        auto wpi = pit->m_writers->find(writer_guid.entityId);
 
-            // Try to take one entry from the pool
-            if (writer_proxies_pool_.empty())
-            {
-                size_t max_proxies = writer_proxies_pool_.max_size();
-                if (writer_proxies_number_ < max_proxies)
-                {
-                    // Pool is empty but limit has not been reached, so we create a new entry.
-                    ++writer_proxies_number_;
-                    ret_val = new WriterProxyData(
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.data_limits);
-                }
-                else
-                {
-                    logWarning(RTPS_PDP, "Maximum number of writer proxies (" << max_proxies <<
-                            ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                // Pool is not empty, use entry from pool
-                ret_val = writer_proxies_pool_.back();
-                writer_proxies_pool_.pop_back();
-            }
-
-            // Add to ParticipantProxyData
-            (*pit->m_writers)[writer_guid.entityId] = ret_val;
+        if (wpi != pit->m_writers->end())
+        {
+            ret_val = wpi->second;
 
-            if (!initializer_func(ret_val, false, *pit))
+            if (!initializer_func(ret_val, true, *pit))
             {
                 return nullptr;
             }
@@ -835,13 +792,64 @@ WriterProxyData* PDP::addWriterProxyData(
             if (listener)
             {
                 WriterDiscoveryInfo info(*ret_val);
-                info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+                info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
                 listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
                 check_and_notify_type_discovery(listener, *ret_val);
             }
 
             return ret_val;
         }
+
+        // Try to take one entry from the pool
+        if (writer_proxies_pool_.empty())
+        {
+            size_t max_proxies = writer_proxies_pool_.max_size();
+            if (writer_proxies_number_ < max_proxies)
+            {
+                // Pool is empty but limit has not been reached, so we create a new entry.
+                ++writer_proxies_number_;
+                ret_val = new WriterProxyData(
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.data_limits);
+            }
+            else
+            {
+                logWarning(RTPS_PDP, "Maximum number of writer proxies (" << max_proxies <<
+                        ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
+                return nullptr;
+            }
+        }
+        else
+        {
+            // Pool is not empty, use entry from pool
+            ret_val = writer_proxies_pool_.back();
+            writer_proxies_pool_.pop_back();
+        }
+
+        // Add to ParticipantProxyData
+        if (!pit->m_writers->try_emplace(writer_guid.entityId, ret_val).second)
+        {
+            logWarning(RTPS_PDP, "Maximum number of writer proxies reached for participant " << pit->m_guid);
+            writer_proxies_pool_.push_back(ret_val);
+            return nullptr;
+        }
+
+        if (!initializer_func(ret_val, false, *pit))
+        {
+            return nullptr;
+        }
+
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if (listener)
+        {
+            WriterDiscoveryInfo info(*ret_val);
+            info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+            listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            check_and_notify_type_discovery(listener, *ret_val);
+        }
+
+        return ret_val;
     }
 
     return nullptr;
@@ -868,6 +876,7 @@ bool PDP::remove_remote_participant(
         {
             pdata = *pit;
             participant_proxies_.erase(pit);
+            participant_proxies_index_->erase(partGUID.guidPrefix);
             break;
         }
     }
@@ -994,15 +1003,12 @@ void PDP::assert_remote_participant_liveliness(
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* it : this->participant_proxies_)
+    ParticipantProxyData* pdata = find_participant_proxy_data(remote_guid);
+    if (pdata != nullptr)
     {
-        if (it->m_guid.guidPrefix == remote_guid)
-        {
-            // TODO Ricardo: Study if isAlive attribute is necessary.
-            it->isAlive = true;
-            it->assert_liveliness();
-            break;
-        }
+        // TODO Ricardo: Study if isAlive attribute is necessary.
+        pdata->isAlive = true;
+        pdata->assert_liveliness();
     }
 }
 
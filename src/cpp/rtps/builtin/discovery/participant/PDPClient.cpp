@@ -350,7 +350,7 @@ bool PDPClient::createPDPEndpoints()
 
     HistoryAttributes hatt;
     hatt.payloadMaxSize = mp_builtin->m_att.readerPayloadSize;
-    hatt.initialReservedCaches = pdp_initial_reserved_caches;
+    hatt.initialReservedCaches = mp_builtin->m_att.lazy_builtin_allocation ? 1 : pdp_initial_reserved_caches;
     hatt.memoryPolicy = mp_builtin->m_att.readerHistoryMemoryPolicy;
     mp_PDPReaderHistory = new ReaderHistory(hatt);
 
@@ -398,7 +398,7 @@ bool PDPClient::createPDPEndpoints()
     }
 
     hatt.payloadMaxSize = mp_builtin->m_att.writerPayloadSize;
-    hatt.initialReservedCaches = pdp_initial_reserved_caches;
+    hatt.initialReservedCaches = mp_builtin->m_att.lazy_builtin_allocation ? 1 : pdp_initial_reserved_caches;
     hatt.memoryPolicy = mp_builtin->m_att.writerHistoryMemoryPolicy;
     mp_PDPWriterHistory = new WriterHistory(hatt);
 
@@ -95,6 +95,19 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        // Periodic announcements are usually identical to the previous one. In that case only the liveliness of
+        // the remote participant needs to be refreshed, and parsing the payload again can be avoided.
+        // As nothing changed, no CHANGED_QOS_PARTICIPANT discovery callback is called either.
+        AnnouncementDigest digest(change->serializedPayload);
+        ParticipantProxyData* pdata = parent_pdp_->find_participant_proxy_data(guid.guidPrefix);
+        if (pdata != nullptr && pdata->m_guid == guid && pdata->announcement_digest.matches(digest))
+        {
+            pdata->isAlive = true;
+            pdata->assert_liveliness();
+            parent_pdp_->mp_PDPReaderHistory->remove_change(change);
+            return;
+        }
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
@@ -108,15 +121,7 @@ void PDPListener::onNewCacheChangeAdded(
             guid = temp_participant_data_.m_guid;
 
             // Check if participant already exists (updated info)
-            ParticipantProxyData* pdata = nullptr;
-            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
-            {
-                if (guid == it->m_guid)
-                {
-                    pdata = it;
-                    break;
-                }
-            }
+            pdata = parent_pdp_->find_participant_proxy_data(guid.guidPrefix);
 
             auto status = (pdata == nullptr) ? ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT :
                     ParticipantDiscoveryInfo::CHANGED_QOS_PARTICIPANT;
@@ -127,6 +132,7 @@ void PDPListener::onNewCacheChangeAdded(
                 pdata = parent_pdp_->createParticipantProxyData(temp_participant_data_, writer_guid);
                 if (pdata != nullptr)
                 {
+                    pdata->announcement_digest = digest;
                     reader->getMutex().unlock();
                     lock.unlock();
 
@@ -150,6 +156,7 @@ void PDPListener::onNewCacheChangeAdded(
             {
                 pdata->updateData(temp_participant_data_);
                 pdata->isAlive = true;
+                pdata->announcement_digest = digest;
                 reader->getMutex().unlock();
                 lock.unlock();
 
@@ -147,7 +147,7 @@ bool PDPServer::createPDPEndpoints()
 
     HistoryAttributes hatt;
     hatt.payloadMaxSize = mp_builtin->m_att.readerPayloadSize;
-    hatt.initialReservedCaches = pdp_initial_reserved_caches;
+    hatt.initialReservedCaches = mp_builtin->m_att.lazy_builtin_allocation ? 1 : pdp_initial_reserved_caches;
     hatt.memoryPolicy = mp_builtin->m_att.readerHistoryMemoryPolicy;
     mp_PDPReaderHistory = new ReaderHistory(hatt);
 
@@ -193,7 +193,7 @@ bool PDPServer::createPDPEndpoints()
     }
 
     hatt.payloadMaxSize = mp_builtin->m_att.writerPayloadSize;
-    hatt.initialReservedCaches = pdp_initial_reserved_caches;
+    hatt.initialReservedCaches = mp_builtin->m_att.lazy_builtin_allocation ? 1 : pdp_initial_reserved_caches;
     hatt.memoryPolicy = mp_builtin->m_att.writerHistoryMemoryPolicy;
     mp_PDPWriterHistory = new WriterHistory(hatt);
 
@@ -1010,17 +1010,9 @@ bool PDPServer::remove_remote_participant(
     {
         std::lock_guard<std::recursive_mutex> lock(*mp_mutex);
 
-        for (ResourceLimitedVector<ParticipantProxyData*>::iterator pit = participant_proxies_.begin();
-                pit != participant_proxies_.end(); ++pit)
-        {
-            if ((*pit)->m_guid == partGUID)
-            {
-                pdata = *pit;
-                break;
-            }
-        }
+        pdata = find_participant_proxy_data(partGUID.guidPrefix);
 
-        if ( nullptr == pdata )
+        if ( nullptr == pdata || pdata->m_guid != partGUID )
         {
             return false;
         }
@@ -106,16 +106,8 @@ void PDPServerListener::onNewCacheChangeAdded(
             reader->getMutex().unlock();
 
             // Check if participant already exists (updated info)
-            ParticipantProxyData* pdata = nullptr;
             std::unique_lock<std::recursive_mutex> lock(*parent_pdp_->getMutex());
-            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
-            {
-                if (guid == it->m_guid)
-                {
-                    pdata = it;
-                    break;
-                }
-            }
+            ParticipantProxyData* pdata = parent_pdp_->find_participant_proxy_data(guid.guidPrefix);
 
             auto status = (pdata == nullptr) ? ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT :
                     ParticipantDiscoveryInfo::CHANGED_QOS_PARTICIPANT;
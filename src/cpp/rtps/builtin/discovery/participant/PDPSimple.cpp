@@ -249,6 +249,10 @@ bool PDPSimple::createPDPEndpoints()
     {
         hatt.maximumReservedCaches = (int32_t)allocation.participants.maximum;
     }
+    if (mp_builtin->m_att.lazy_builtin_allocation)
+    {
+        hatt.initialReservedCaches = 1;
+    }
 
     mp_PDPReaderHistory = new ReaderHistory(hatt);
     ReaderAttributes ratt;
@@ -21,6 +21,7 @@
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/dds/log/Log.hpp>
 
+#include <algorithm>
 #include <mutex>
 #include <cstring>
 #include <cassert>
@@ -30,6 +31,38 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+//! Payload size of the smallest size class is 2^SLAB_MIN_SHIFT bytes.
+static constexpr uint32_t SLAB_MIN_SHIFT = 6;
+//! Payload size of the biggest size class is 2^SLAB_MAX_SHIFT bytes. Bigger payloads are kept on this class.
+static constexpr uint32_t SLAB_MAX_SHIFT = 31;
+static constexpr uint32_t SLAB_NUM_CLASSES = SLAB_MAX_SHIFT - SLAB_MIN_SHIFT + 1;
+
+/*!
+ * CacheChange allocated on DYNAMIC_SLAB_MEMORY_MODE.
+ * Keeps its position on m_allCaches, so it can be removed from there in constant time.
+ */
+struct CacheChangePool::SlabChange : public CacheChange_t
+{
+    SlabChange(
+            uint32_t payload_size,
+            uint32_t size_class)
+        : CacheChange_t(payload_size)
+        , index(0)
+        , reserved_class(size_class)
+    {
+    }
+
+    //! Position on m_allCaches.
+    size_t index;
+    //! Size class whose statistics account for this change while it is reserved.
+    uint32_t reserved_class;
+};
+
+struct CacheChangePool::SizeClass
+{
+    std::vector<SlabChange*> free_changes;
+    SizeClassStatistics statistics;
+};
 
 CacheChangePool::~CacheChangePool()
 {
@@ -37,8 +70,17 @@ CacheChangePool::~CacheChangePool()
     //Deletion process does not depend on the memory management policy
     for(std::vector<CacheChange_t*>::iterator it = m_allCaches.begin();it!=m_allCaches.end();++it)
     {
-        delete(*it);
+        if (memoryMode == DYNAMIC_SLAB_MEMORY_MODE)
+        {
+            delete(static_cast<SlabChange*>(*it));
+        }
+        else
+        {
+            delete(*it);
+        }
     }
+
+    delete[] m_size_classes;
 }
 
 CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32_t max_pool_size, MemoryManagementPolicy_t memoryPolicy) :
@@ -79,6 +121,15 @@ CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32
         case DYNAMIC_REUSABLE_MEMORY_MODE:
             logInfo(RTPS_UTILS,"Semi-Dynamic Mode is active, no preallocation but dynamically allocated CacheChanges are reused for future cachechanges");
             break;
+        case DYNAMIC_SLAB_MEMORY_MODE:
+            logInfo(RTPS_UTILS,"Slab Mode is active, CacheChanges are allocated on request and reused by payload size class");
+            m_slab_high_water_mark = static_cast<uint32_t>(pool_size);
+            m_size_classes = new SizeClass[SLAB_NUM_CLASSES];
+            for (uint32_t i = 0; i < SLAB_NUM_CLASSES; ++i)
+            {
+                m_size_classes[i].statistics.payload_size = 1u << (SLAB_MIN_SHIFT + i);
+            }
+            break;
     }
 }
 
@@ -171,6 +222,9 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
                 }
             }
             break;
+
+        case DYNAMIC_SLAB_MEMORY_MODE:
+            return reserve_from_slab(chan, dataSize);
     }
 
     return true;
@@ -189,6 +243,9 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
         case DYNAMIC_REUSABLE_MEMORY_MODE:
             return_cache_to_pool(ch);
             break;
+        case DYNAMIC_SLAB_MEMORY_MODE:
+            release_to_slab(ch);
+            break;
         case DYNAMIC_RESERVE_MEMORY_MODE:
             // Find pointer in CacheChange vector, remove element, then delete it
             std::vector<CacheChange_t*>::iterator target = m_allCaches.begin();
@@ -207,7 +264,165 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
     }
 }
 
+uint32_t CacheChangePool::size_class_for_reserve(uint32_t data_size)
+{
+    uint32_t size_class = 0;
+    while (size_class < SLAB_NUM_CLASSES - 1 && (1u << (SLAB_MIN_SHIFT + size_class)) < data_size)
+    {
+        ++size_class;
+    }
+    return size_class;
+}
+
+uint32_t CacheChangePool::size_class_for_release(uint32_t max_size)
+{
+    uint32_t size_class = 0;
+    while (size_class < SLAB_NUM_CLASSES - 1 && (1u << (SLAB_MIN_SHIFT + size_class + 1)) <= max_size)
+    {
+        ++size_class;
+    }
+    return size_class;
+}
+
+bool CacheChangePool::reserve_from_slab(CacheChange_t** chan, uint32_t dataSize)
+{
+    uint32_t size_class = size_class_for_reserve(dataSize);
+    SizeClass& slab = m_size_classes[size_class];
+    SlabChange* ch = nullptr;
+
+    if(!slab.free_changes.empty())
+    {
+        ch = slab.free_changes.back();
+        slab.free_changes.pop_back();
+        --slab.statistics.free;
+        --m_slab_free_count;
+    }
+    else
+    {
+        if((m_max_pool_size > 0) && (m_pool_size >= m_max_pool_size))
+        {
+            logWarning(RTPS_HISTORY, "Maximum number of allowed reserved caches reached");
+            *chan = nullptr;
+            return false;
+        }
+
+        try
+        {
+            ch = new SlabChange((std::max)(dataSize, slab.statistics.payload_size), size_class);
+        }
+        catch(std::bad_alloc& ex)
+        {
+            logError(RTPS_HISTORY, "Failed to allocate memory for the serializedPayload, exception caught: " << ex.what());
+            *chan = nullptr;
+            return false;
+        }
+
+        ch->index = m_allCaches.size();
+        m_allCaches.push_back(ch);
+        ++m_pool_size;
+    }
+
+    // Only the biggest class may hold payloads bigger than its nominal size
+    try
+    {
+        ch->serializedPayload.reserve(dataSize);
+    }
+    catch(std::bad_alloc& ex)
+    {
+        logError(RTPS_HISTORY, "Failed to allocate memory for the serializedPayload, exception caught: " << ex.what());
+        delete_slab_change(ch);
+        *chan = nullptr;
+        return false;
+    }
+
+    ch->reserved_class = size_class;
+    if(++slab.statistics.in_use > slab.statistics.peak_in_use)
+    {
+        slab.statistics.peak_in_use = slab.statistics.in_use;
+    }
+
+    *chan = ch;
+    return true;
+}
+
+void CacheChangePool::release_to_slab(CacheChange_t* change)
+{
+    SlabChange* ch = static_cast<SlabChange*>(change);
+    assert(ch->index < m_allCaches.size() && m_allCaches[ch->index] == change);
+
+    --m_size_classes[ch->reserved_class].statistics.in_use;
+
+    // The payload could have been reallocated while reserved, so the class is taken from its current size.
+    SizeClass& slab = m_size_classes[size_class_for_release(ch->serializedPayload.max_size)];
+    if(slab.free_changes.size() >= m_slab_high_water_mark)
+    {
+        ++slab.statistics.trimmed;
+        delete_slab_change(ch);
+        return;
+    }
+
+    reset_cache(ch);
+    slab.free_changes.push_back(ch);
+    ++slab.statistics.free;
+    ++m_slab_free_count;
+}
+
+void CacheChangePool::delete_slab_change(SlabChange* ch)
+{
+    // Swap with the last one, so the removal is done in constant time.
+    SlabChange* last = static_cast<SlabChange*>(m_allCaches.back());
+    m_allCaches[ch->index] = last;
+    last->index = ch->index;
+    m_allCaches.pop_back();
+    --m_pool_size;
+    delete(ch);
+}
+
+std::vector<CacheChangePool::SizeClassStatistics> CacheChangePool::get_size_class_statistics() const
+{
+    std::vector<SizeClassStatistics> statistics;
+    if(m_size_classes != nullptr)
+    {
+        for (uint32_t i = 0; i < SLAB_NUM_CLASSES; ++i)
+        {
+            const SizeClassStatistics& current = m_size_classes[i].statistics;
+            if(current.peak_in_use > 0 || current.free > 0)
+            {
+                statistics.push_back(current);
+            }
+        }
+    }
+    return statistics;
+}
+
+void CacheChangePool::trim()
+{
+    if(m_size_classes == nullptr)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < SLAB_NUM_CLASSES; ++i)
+    {
+        SizeClass& slab = m_size_classes[i];
+        for(SlabChange* ch : slab.free_changes)
+        {
+            delete_slab_change(ch);
+        }
+        slab.statistics.trimmed += slab.free_changes.size();
+        slab.statistics.free = 0;
+        slab.free_changes.clear();
+    }
+    m_slab_free_count = 0;
+}
+
 void CacheChangePool::return_cache_to_pool(CacheChange_t* ch)
+{
+    reset_cache(ch);
+    m_freeCaches.push_back(ch);
+}
+
+void CacheChangePool::reset_cache(CacheChange_t* ch)
 {
     ch->kind = ALIVE;
     ch->sequenceNumber.high = 0;
@@ -220,7 +435,6 @@ void CacheChangePool::return_cache_to_pool(CacheChange_t* ch)
     ch->sourceTimestamp.seconds(0);
     ch->sourceTimestamp.fraction(0);
     ch->setFragmentSize(0);
-    m_freeCaches.push_back(ch);
 }
 
 bool CacheChangePool::allocateGroup(uint32_t group_size)
@@ -26,6 +26,7 @@
 
 #include <fastdds/core/policy/ParameterList.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <statistics/StatisticsProbes.hpp>
 
 #include <cassert>
 #include <limits>
@@ -44,7 +45,9 @@ namespace rtps {
 MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
-    : participant_(participant)
+    : last_reader_id_(c_EntityId_Unknown)
+    , last_readers_(nullptr)
+    , participant_(participant)
     , source_version_(c_ProtocolVersion)
     , source_vendor_id_(c_VendorId_Unknown)
     , source_guid_prefix_(c_GuidPrefix_Unknown)
@@ -71,6 +74,7 @@ void MessageReceiver::associateEndpoint(
         Endpoint* to_add)
 {
     std::lock_guard<std::mutex> guard(mtx_);
+    last_readers_ = nullptr;
     if (to_add->getAttributes().endpointKind == WRITER)
     {
         const auto writer = dynamic_cast<RTPSWriter*>(to_add);
@@ -115,6 +119,7 @@ void MessageReceiver::removeEndpoint(
         Endpoint* to_remove)
 {
     std::lock_guard<std::mutex> guard(mtx_);
+    last_readers_ = nullptr;
 
     if (to_remove->getAttributes().endpointKind == WRITER)
     {
@@ -166,9 +171,13 @@ void MessageReceiver::processCDRMsg(
 {
     (void)loc;
 
+    FASTDDS_STATISTICS_ADD(participant_->statistics(), MESSAGES_RECEIVED, 1);
+    FASTDDS_STATISTICS_ADD(participant_->statistics(), BYTES_RECEIVED, msg->length);
+
     if (msg->length < RTPSMESSAGE_HEADER_SIZE)
     {
         logWarning(RTPS_MSG_IN, IDSTRING "Received message too short, ignoring");
+        FASTDDS_STATISTICS_ADD(participant_->statistics(), MESSAGES_DISCARDED, 1);
         return;
     }
 
@@ -182,6 +191,7 @@ void MessageReceiver::processCDRMsg(
     //Once everything is set, the reading begins:
     if (!checkRTPSHeader(msg))
     {
+        FASTDDS_STATISTICS_ADD(participant_->statistics(), MESSAGES_DISCARDED, 1);
         return;
     }
 
@@ -442,6 +452,19 @@ bool MessageReceiver::readSubmessageHeader(
     return true;
 }
 
+const std::vector<RTPSReader*>* MessageReceiver::find_readers(
+        const EntityId_t& readerID)
+{
+    if (last_readers_ == nullptr || last_reader_id_ != readerID)
+    {
+        const auto readers = associated_readers_.find(readerID);
+        last_readers_ = (readers != associated_readers_.end()) ? &readers->second : nullptr;
+        last_reader_id_ = readerID;
+    }
+
+    return last_readers_;
+}
+
 bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
         const EntityId_t& readerID,
         RTPSReader*& first_reader)
@@ -455,10 +478,10 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
 
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const std::vector<RTPSReader*>* readers = find_readers(readerID);
+        if (readers != nullptr)
         {
-            first_reader = readers->second.front();
+            first_reader = readers->front();
             return true;
         }
     }
@@ -493,10 +516,10 @@ void MessageReceiver::findAllReaders(
 {
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const std::vector<RTPSReader*>* readers = find_readers(readerID);
+        if (readers != nullptr)
         {
-            for (const auto& it : readers->second)
+            for (const auto& it : *readers)
             {
                 callback(it);
             }
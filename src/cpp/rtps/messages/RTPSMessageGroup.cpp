@@ -24,6 +24,7 @@
 #include <rtps/flowcontrol/FlowController.h>
 #include "RTPSGapBuilder.hpp"
 #include "RTPSMessageGroup_t.hpp"
+#include <statistics/StatisticsProbes.hpp>
 
 #include <fastdds/dds/log/Log.hpp>
 
@@ -125,6 +126,8 @@ RTPSMessageGroup::RTPSMessageGroup(
     , endpoint_(endpoint)
     , full_msg_(nullptr)
     , submessage_msg_(nullptr)
+    , submessage_payload_position_(0)
+    , buffers_position_(0)
     , currentBytesSent_(0)
     , participant_(participant)
 #if HAVE_SECURITY
@@ -176,6 +179,8 @@ void RTPSMessageGroup::reset_to_header()
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
+    send_buffer_->buffers_.clear();
+    buffers_position_ = 0;
 }
 
 void RTPSMessageGroup::flush()
@@ -191,10 +196,16 @@ void RTPSMessageGroup::send()
 
     if (full_msg_->length > RTPSMESSAGE_HEADER_SIZE)
     {
+        finish_buffers();
+        std::vector<NetworkBuffer>& buffers = send_buffer_->buffers_;
+
 #if HAVE_SECURITY
         // TODO(Ricardo) Control message size if it will be encrypted.
         if (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection())
         {
+            // The whole message is encoded, so referenced payloads have to be copied into it
+            copy_network_buffers(buffers.data(), buffers.size(), full_msg_->buffer);
+
             CDRMessage::initCDRMsg(encrypt_msg_);
             full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
             encrypt_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
@@ -209,10 +220,12 @@ void RTPSMessageGroup::send()
             }
 
             msgToSend = encrypt_msg_;
+            buffers.clear();
+            buffers.emplace_back(encrypt_msg_->buffer, encrypt_msg_->length);
         }
 #endif // if HAVE_SECURITY
 
-        if (!sender_.send(msgToSend, max_blocking_time_point_))
+        if (!sender_.send(msgToSend, buffers, max_blocking_time_point_))
         {
             throw timeout();
         }
@@ -232,6 +245,7 @@ void RTPSMessageGroup::check_and_maybe_flush(
         const GuidPrefix_t& destination_guid_prefix)
 {
     CDRMessage::initCDRMsg(submessage_msg_);
+    submessage_payload_ = NetworkBuffer();
 
     if (sender_.destinations_have_changed())
     {
@@ -245,7 +259,7 @@ bool RTPSMessageGroup::insert_submessage(
         const GuidPrefix_t& destination_guid_prefix,
         bool is_big_submessage)
 {
-    if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    if (!append_submessage())
     {
         // Retry
         flush();
@@ -258,7 +272,7 @@ bool RTPSMessageGroup::insert_submessage(
             return false;
         }
 
-        if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+        if (!append_submessage())
         {
             logError(RTPS_WRITER, "Cannot add RTPS submesage to the CDRMessage. Buffer too small");
             return false;
@@ -274,6 +288,64 @@ bool RTPSMessageGroup::insert_submessage(
     return true;
 }
 
+bool RTPSMessageGroup::append_submessage()
+{
+    if (submessage_payload_.size == 0)
+    {
+        return CDRMessage::appendMsg(full_msg_, submessage_msg_);
+    }
+
+    uint32_t length = submessage_msg_->length;
+    if (full_msg_->pos + length > full_msg_->max_size)
+    {
+        return false;
+    }
+
+    // Copy everything but the payload, which is added to the gather list
+    uint32_t payload_start = full_msg_->pos + submessage_payload_position_;
+    uint32_t payload_end = submessage_payload_position_ + submessage_payload_.size;
+    memcpy(&full_msg_->buffer[full_msg_->pos], submessage_msg_->buffer, submessage_payload_position_);
+    memcpy(&full_msg_->buffer[full_msg_->pos + payload_end], &submessage_msg_->buffer[payload_end],
+            length - payload_end);
+    full_msg_->pos += length;
+    full_msg_->length += length;
+
+    std::vector<NetworkBuffer>& buffers = send_buffer_->buffers_;
+    buffers.emplace_back(&full_msg_->buffer[buffers_position_], payload_start - buffers_position_);
+    buffers.push_back(submessage_payload_);
+    buffers_position_ = payload_start + submessage_payload_.size;
+    submessage_payload_ = NetworkBuffer();
+
+    return true;
+}
+
+bool RTPSMessageGroup::can_reference_payload(
+        uint32_t payload_length) const
+{
+#if HAVE_SECURITY
+    // Protected payloads and submessages are encoded from a contiguous buffer
+    if (endpoint_->getAttributes().security_attributes().is_payload_protected ||
+            endpoint_->getAttributes().security_attributes().is_submessage_protected)
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    // Each reference adds two buffers to the gather list, and one more is needed for its tail
+    return payload_length >= min_payload_reference_size_ &&
+           send_buffer_->buffers_.size() + 3 <= max_network_buffers;
+}
+
+void RTPSMessageGroup::finish_buffers()
+{
+    std::vector<NetworkBuffer>& buffers = send_buffer_->buffers_;
+    if (buffers_position_ < full_msg_->length)
+    {
+        buffers.emplace_back(&full_msg_->buffer[buffers_position_], full_msg_->length - buffers_position_);
+        buffers_position_ = full_msg_->length;
+    }
+}
+
 bool RTPSMessageGroup::add_info_dst_in_buffer(
         CDRMessage_t* buffer,
         const GuidPrefix_t& destination_guid_prefix)
@@ -393,13 +465,21 @@ bool RTPSMessageGroup::add_data(
 
     // TODO (Ricardo). Check to create special wrapper.
     bool is_big_submessage;
+    uint32_t payload_position = 0;
     if (!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change_to_add, endpoint_->getAttributes().topicKind,
-            readerId, expectsInlineQos, inlineQos, &is_big_submessage))
+            readerId, expectsInlineQos, inlineQos, &is_big_submessage,
+            can_reference_payload(change_to_add.serializedPayload.length) ? &payload_position : nullptr))
     {
         logError(RTPS_WRITER, "Cannot add DATA submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
         return false;
     }
+    if (payload_position > 0)
+    {
+        submessage_payload_ = NetworkBuffer(change_to_add.serializedPayload.data,
+                        change_to_add.serializedPayload.length);
+        submessage_payload_position_ = payload_position;
+    }
     change_to_add.serializedPayload.data = nullptr;
 
 #if HAVE_SECURITY
@@ -428,7 +508,13 @@ bool RTPSMessageGroup::add_data(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(is_big_submessage);
+    if (!insert_submessage(is_big_submessage))
+    {
+        return false;
+    }
+
+    FASTDDS_STATISTICS_ADD(endpoint_->statistics(), DATA_SENT, 1);
+    return true;
 }
 
 bool RTPSMessageGroup::add_data_frag(
@@ -489,14 +575,22 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    uint32_t payload_position = 0;
     if (!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change_to_add, fragment_number,
             change.serializedPayload.length, endpoint_->getAttributes().topicKind, readerId,
-            expectsInlineQos, inlineQos))
+            expectsInlineQos, inlineQos,
+            can_reference_payload(change_to_add.serializedPayload.length) ? &payload_position : nullptr))
     {
         logError(RTPS_WRITER, "Cannot add DATA_FRAG submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
         return false;
     }
+    if (payload_position > 0)
+    {
+        submessage_payload_ = NetworkBuffer(change_to_add.serializedPayload.data,
+                        change_to_add.serializedPayload.length);
+        submessage_payload_position_ = payload_position;
+    }
     change_to_add.serializedPayload.data = nullptr;
 
 #if HAVE_SECURITY
@@ -525,7 +619,13 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(false);
+    if (!insert_submessage(false))
+    {
+        return false;
+    }
+
+    FASTDDS_STATISTICS_ADD(endpoint_->statistics(), DATA_FRAGS_SENT, 1);
+    return true;
 }
 
 bool RTPSMessageGroup::add_heartbeat(
@@ -576,7 +676,13 @@ bool RTPSMessageGroup::add_heartbeat(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(false);
+    if (!insert_submessage(false))
+    {
+        return false;
+    }
+
+    FASTDDS_STATISTICS_ADD(endpoint_->statistics(), HEARTBEATS_SENT, 1);
+    return true;
 }
 
 // TODO (Ricardo) Check with standard 8.3.7.4.5
@@ -672,6 +778,7 @@ bool RTPSMessageGroup::create_gap_submessage(
     }
 #endif // if HAVE_SECURITY
 
+    FASTDDS_STATISTICS_ADD(endpoint_->statistics(), GAPS_SENT, 1);
     return true;
 }
 
@@ -727,7 +834,13 @@ bool RTPSMessageGroup::add_acknack(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(false);
+    if (!insert_submessage(false))
+    {
+        return false;
+    }
+
+    FASTDDS_STATISTICS_ADD(endpoint_->statistics(), ACKNACKS_SENT, 1);
+    return true;
 }
 
 bool RTPSMessageGroup::add_nackfrag(
@@ -777,7 +890,13 @@ bool RTPSMessageGroup::add_nackfrag(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(false);
+    if (!insert_submessage(false))
+    {
+        return false;
+    }
+
+    FASTDDS_STATISTICS_ADD(endpoint_->statistics(), NACKFRAGS_SENT, 1);
+    return true;
 }
 
 } /* namespace rtps */
@@ -21,6 +21,7 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastrtps/rtps/common/CDRMessage_t.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
@@ -95,6 +96,7 @@ public:
     {
         CDRMessage::initCDRMsg(&rtpsmsg_fullmsg_);
         RTPSMessageCreator::addHeader(&rtpsmsg_fullmsg_, participant_guid);
+        buffers_.reserve(max_network_buffers);
     }
 
     CDRMessage_t rtpsmsg_submessage_;
@@ -104,6 +106,9 @@ public:
 #if HAVE_SECURITY
     CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+    //! Gather list of rtpsmsg_fullmsg_, when it references serialized payloads instead of containing them
+    std::vector<NetworkBuffer> buffers_;
 };
 
 } // namespace rtps
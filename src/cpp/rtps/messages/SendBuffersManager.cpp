@@ -19,6 +19,9 @@
 #include "SendBuffersManager.hpp"
 #include "../participant/RTPSParticipantImpl.h"
 
+#include <functional>
+#include <thread>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -26,9 +29,41 @@ namespace rtps {
 SendBuffersManager::SendBuffersManager(
         size_t reserved_size,
         bool allow_growing)
-    : allow_growing_(allow_growing)
+    : reserved_size_(reserved_size)
+    , pool_(reserved_size)
+    , allow_growing_(allow_growing)
 {
-    pool_.reserve(reserved_size);
+}
+
+SendBuffersManager::~SendBuffersManager()
+{
+    size_t n_destroyed = 0;
+    RTPSMessageGroup_t* buffer = nullptr;
+
+    for (CacheSlot& slot : cache_slots_)
+    {
+        buffer = slot.buffer.exchange(nullptr);
+        if (buffer != nullptr)
+        {
+            delete buffer;
+            ++n_destroyed;
+        }
+    }
+
+    while (pool_.pop(buffer))
+    {
+        delete buffer;
+        ++n_destroyed;
+    }
+
+    for (RTPSMessageGroup_t* overflow_buffer : overflow_pool_)
+    {
+        delete overflow_buffer;
+        ++n_destroyed;
+    }
+
+    assert(n_destroyed == n_created_.load());
+    (void)n_destroyed;
 }
 
 void SendBuffersManager::init(
@@ -36,7 +71,8 @@ void SendBuffersManager::init(
 {
     std::lock_guard<std::mutex> guard(mutex_);
 
-    if (n_created_ < pool_.capacity())
+    size_t n_created = n_created_.load();
+    if (n_created < reserved_size_)
     {
         const GuidPrefix_t& guid_prefix = participant->getGuid().guidPrefix;
 
@@ -54,21 +90,27 @@ void SendBuffersManager::init(
 #else
         advance *= 2;
 #endif
-        size_t data_size = advance * (pool_.capacity() - n_created_);
+        size_t data_size = advance * (reserved_size_ - n_created);
         common_buffer_.assign(data_size, 0);
 
         octet* raw_buffer = common_buffer_.data();
-        while(n_created_ < pool_.capacity())
+        while (n_created < reserved_size_)
         {
-            pool_.emplace_back(new RTPSMessageGroup_t(
+            RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
                 raw_buffer,
 #if HAVE_SECURITY
                 secure,
 #endif
                 payload_size, guid_prefix
-            ));
+                );
             raw_buffer += advance;
-            ++n_created_;
+            ++n_created;
+            n_created_.store(n_created);
+
+            // The ring has room for all the reserved buffers.
+            bool added = pool_.push(new_item);
+            assert(added);
+            (void)added;
         }
     }
 }
@@ -76,47 +118,161 @@ void SendBuffersManager::init(
 std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
         const RTPSParticipantImpl* participant)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
+    CacheSlot& slot = current_thread_slot();
+    RTPSMessageGroup_t* buffer = nullptr;
 
-    std::unique_ptr<RTPSMessageGroup_t> ret_val;
-
-    while (pool_.empty())
+    if (!try_take(slot, buffer))
     {
-        if (allow_growing_ || n_created_ < pool_.capacity())
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!try_take_overflow(slot, buffer))
         {
-            add_one_buffer(participant);
+            misses_.fetch_add(1u, std::memory_order_relaxed);
+            if (!try_create(participant, buffer))
+            {
+                n_waiting_.fetch_add(1u);
+                waits_.fetch_add(1u, std::memory_order_relaxed);
+                logInfo(RTPS_PARTICIPANT, "Waiting for send buffer");
+                while (!try_take(slot, buffer) && !try_take_overflow(slot, buffer))
+                {
+                    available_cv_.wait(lock);
+                }
+                n_waiting_.fetch_sub(1u);
+            }
         }
-        else
+    }
+
+    return std::unique_ptr<RTPSMessageGroup_t>(buffer);
+}
+
+void SendBuffersManager::return_buffer(
+        std::unique_ptr <RTPSMessageGroup_t>&& buffer)
+{
+    RTPSMessageGroup_t* item = buffer.release();
+    RTPSMessageGroup_t* expected = nullptr;
+
+    // Keep it on the slot of this thread, so it is reused by the next request of the same thread.
+    if (!current_thread_slot().buffer.compare_exchange_strong(expected, item))
+    {
+        put(item);
+    }
+
+    // Only take the mutex when someone may be waiting for a buffer.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (n_waiting_.load() > 0u)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        available_cv_.notify_one();
+    }
+}
+
+SendBuffersManager::Statistics SendBuffersManager::get_statistics() const
+{
+    Statistics stats;
+    for (const CacheSlot& slot : cache_slots_)
+    {
+        stats.cache_hits += slot.cache_hits.load(std::memory_order_relaxed);
+        stats.pool_hits += slot.pool_hits.load(std::memory_order_relaxed);
+    }
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.waits = waits_.load(std::memory_order_relaxed);
+    stats.created = n_created_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+SendBuffersManager::CacheSlot& SendBuffersManager::current_thread_slot()
+{
+    static_assert((num_cache_slots & (num_cache_slots - 1)) == 0, "num_cache_slots should be a power of two");
+    size_t hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return cache_slots_[(hash ^ (hash >> 7)) & (num_cache_slots - 1)];
+}
+
+bool SendBuffersManager::try_take(
+        CacheSlot& slot,
+        RTPSMessageGroup_t*& buffer)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    buffer = slot.buffer.exchange(nullptr, std::memory_order_acquire);
+    if (buffer != nullptr)
+    {
+        slot.cache_hits.fetch_add(1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (pool_.pop(buffer))
+    {
+        slot.pool_hits.fetch_add(1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Buffers parked on the slots of other threads.
+    for (CacheSlot& other : cache_slots_)
+    {
+        if (other.buffer.load(std::memory_order_relaxed) != nullptr)
         {
-            logInfo(RTPS_PARTICIPANT, "Waiting for send buffer");
-            available_cv_.wait(lock);
+            buffer = other.buffer.exchange(nullptr, std::memory_order_acquire);
+            if (buffer != nullptr)
+            {
+                slot.pool_hits.fetch_add(1u, std::memory_order_relaxed);
+                return true;
+            }
         }
     }
 
-    ret_val = std::move(pool_.back());
-    pool_.pop_back();
+    return false;
+}
 
-    return ret_val;
+bool SendBuffersManager::try_take_overflow(
+        CacheSlot& slot,
+        RTPSMessageGroup_t*& buffer)
+{
+    if (!overflow_pool_.empty())
+    {
+        buffer = overflow_pool_.back();
+        overflow_pool_.pop_back();
+        slot.pool_hits.fetch_add(1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
 }
 
-void SendBuffersManager::return_buffer(
-        std::unique_ptr <RTPSMessageGroup_t>&& buffer)
+bool SendBuffersManager::try_create(
+        const RTPSParticipantImpl* participant,
+        RTPSMessageGroup_t*& buffer)
 {
-    std::lock_guard<std::mutex> guard(mutex_);
-    pool_.push_back(std::move(buffer));
-    available_cv_.notify_one();
+    size_t n_created = n_created_.load();
+    do
+    {
+        if (!allow_growing_ && n_created >= reserved_size_)
+        {
+            return false;
+        }
+    } while (!n_created_.compare_exchange_weak(n_created, n_created + 1));
+
+    buffer = create_buffer(participant);
+    return true;
+}
+
+void SendBuffersManager::put(
+        RTPSMessageGroup_t* buffer)
+{
+    if (!pool_.push(buffer))
+    {
+        // The pool has grown beyond the capacity of the ring.
+        std::lock_guard<std::mutex> guard(mutex_);
+        overflow_pool_.push_back(buffer);
+    }
 }
 
-void SendBuffersManager::add_one_buffer(
+RTPSMessageGroup_t* SendBuffersManager::create_buffer(
         const RTPSParticipantImpl* participant)
 {
-    RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
+    return new RTPSMessageGroup_t(
 #if HAVE_SECURITY
         participant->is_secure(),
 #endif
         participant->getMaxMessageSize(), participant->getGuid().guidPrefix);
-    pool_.emplace_back(new_item);
-    ++n_created_;
 }
 
 } /* namespace rtps */
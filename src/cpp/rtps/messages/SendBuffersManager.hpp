@@ -22,7 +22,10 @@
 
 #include "RTPSMessageGroup_t.hpp"
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <utils/collections/lock_free_ring.hpp>
 
+#include <array>               // std::array
+#include <atomic>              // std::atomic
 #include <vector>              // std::vector
 #include <memory>              // std::unique_ptr
 #include <mutex>               // std::mutex
@@ -37,12 +40,33 @@ class RTPSParticipantImpl;
 
 /**
  * Manages a pool of send buffers.
+ *
+ * Buffers are kept on a lock-free ring, in front of which there is a small set of cache slots selected by the
+ * calling thread, so a thread that returns a buffer usually gets the same one back on its next request without
+ * touching the shared ring. Threads only block when the pool is exhausted and it is not allowed to grow.
  * @ingroup WRITER_MODULE
  */
 class SendBuffersManager
 {
 public:
 
+    /**
+     * Usage counters of the pool, intended for tuning the number of preallocated buffers.
+     */
+    struct Statistics
+    {
+        //! Number of buffers served from the cache slot of the requesting thread.
+        uint64_t cache_hits = 0;
+        //! Number of buffers served from the shared pool.
+        uint64_t pool_hits = 0;
+        //! Number of requests that found the pool empty.
+        uint64_t misses = 0;
+        //! Number of requests that had to wait for a buffer to be returned.
+        uint64_t waits = 0;
+        //! Number of buffers created, including the preallocated ones.
+        size_t created = 0;
+    };
+
     /**
      * Construct a SendBuffersManager.
      * @param reserved_size Initial size for the pool.
@@ -52,10 +76,7 @@ public:
             size_t reserved_size,
             bool allow_growing);
 
-    ~SendBuffersManager()
-    {
-        assert(pool_.size() == n_created_);
-    }
+    ~SendBuffersManager();
 
     /**
      * Initialization of pool.
@@ -80,23 +101,71 @@ public:
     void return_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Get the usage counters of the pool.
+     * @return A snapshot of the counters.
+     */
+    Statistics get_statistics() const;
+
 private:
 
-    void add_one_buffer(
+    //! Number of cache slots. Must be a power of two.
+    static constexpr size_t num_cache_slots = 16;
+
+    //! A cache slot, padded to its own cache line to avoid false sharing between threads.
+    struct CacheSlot
+    {
+        std::atomic<RTPSMessageGroup_t*> buffer{nullptr};
+        std::atomic<uint64_t> cache_hits{0};
+        std::atomic<uint64_t> pool_hits{0};
+        char padding[64 - sizeof(std::atomic<RTPSMessageGroup_t*>) - 2 * sizeof(std::atomic<uint64_t>)];
+    };
+
+    CacheSlot& current_thread_slot();
+
+    bool try_take(
+            CacheSlot& slot,
+            RTPSMessageGroup_t*& buffer);
+
+    // Should be called with mutex_ locked.
+    bool try_take_overflow(
+            CacheSlot& slot,
+            RTPSMessageGroup_t*& buffer);
+
+    bool try_create(
+            const RTPSParticipantImpl* participant,
+            RTPSMessageGroup_t*& buffer);
+
+    void put(
+            RTPSMessageGroup_t* buffer);
+
+    RTPSMessageGroup_t* create_buffer(
             const RTPSParticipantImpl* participant);
 
-    //!Protects all data
-    std::mutex mutex_;
+    //!Number of buffers reserved on construction
+    size_t reserved_size_ = 0;
+    //!Per-thread cache slots
+    std::array<CacheSlot, num_cache_slots> cache_slots_;
     //!Send buffers pool
-    std::vector<std::unique_ptr<RTPSMessageGroup_t>> pool_;
+    LockFreeRing<RTPSMessageGroup_t*> pool_;
+    //!Protects overflow_pool_ and is used to wait on available_cv_
+    std::mutex mutex_;
+    //!Buffers returned when pool_ is full. Only used when the pool is allowed to grow.
+    std::vector<RTPSMessageGroup_t*> overflow_pool_;
     //!Raw buffer shared by the buffers created inside init()
     std::vector<octet> common_buffer_;
     //!Creation counter
-    std::size_t n_created_ = 0;
-    //!Whether we allow n_created_ to grow beyond the pool_ capacity.
+    std::atomic<size_t> n_created_{0};
+    //!Whether we allow n_created_ to grow beyond reserved_size_.
     bool allow_growing_ = true;
+    //!Number of threads waiting on available_cv_
+    std::atomic<uint32_t> n_waiting_{0};
     //!To wait for a buffer to be returned to the pool.
     std::condition_variable available_cv_;
+    //!Number of requests that found the pool empty
+    std::atomic<uint64_t> misses_{0};
+    //!Number of requests that had to wait
+    std::atomic<uint64_t> waits_{0};
 };
 
 } /* namespace rtps */
@@ -26,6 +26,32 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+ * Add the serialized payload of a DATA or DATA_FRAG submessage.
+ * When payload_position is not null, the room for the payload is reserved on the message but the payload is not
+ * copied, and the position where it should be is returned instead.
+ */
+static bool add_serialized_payload(
+        CDRMessage_t* msg,
+        const SerializedPayload_t& payload,
+        uint32_t* payload_position)
+{
+    if (payload_position == nullptr)
+    {
+        return CDRMessage::addData(msg, payload.data, payload.length);
+    }
+
+    if (msg->pos + payload.length > msg->max_size)
+    {
+        return false;
+    }
+
+    *payload_position = msg->pos;
+    msg->pos += payload.length;
+    msg->length += payload.length;
+    return true;
+}
+
 bool RTPSMessageCreator::addMessageData(
         CDRMessage_t* msg,
         GuidPrefix_t& guidprefix,
@@ -56,7 +82,8 @@ bool RTPSMessageCreator::addSubmessageData(
         const EntityId_t& readerId,
         bool expectsInlineQos,
         InlineQosWriter* inlineQos,
-        bool* is_big_submessage)
+        bool* is_big_submessage,
+        uint32_t* payload_position)
 {
     octet flags = 0x0;
     //Find out flags
@@ -181,7 +208,7 @@ bool RTPSMessageCreator::addSubmessageData(
     //Add Serialized Payload
     if (dataFlag)
     {
-        added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data, change->serializedPayload.length);
+        added_no_error &= add_serialized_payload(msg, change->serializedPayload, payload_position);
     }
 
     if (keyFlag)
@@ -289,7 +316,8 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
         TopicKind_t topicKind,
         const EntityId_t& readerId,
         bool expectsInlineQos,
-        InlineQosWriter* inlineQos)
+        InlineQosWriter* inlineQos,
+        uint32_t* payload_position)
 {
     octet flags = 0x0;
     //Find out flags
@@ -422,8 +450,7 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
     //Add Serialized Payload XXX TODO
     if (!keyFlag) // keyflag = 0 means that the serializedPayload SubmessageElement contains the serialized Data
     {
-        added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data,
-                        change->serializedPayload.length);
+        added_no_error &= add_serialized_payload(msg, change->serializedPayload, payload_position);
     }
     else
     {   // keyflag = 1 means that the serializedPayload SubmessageElement contains the serialized Key
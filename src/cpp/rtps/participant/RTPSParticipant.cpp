@@ -170,6 +170,12 @@ void RTPSParticipant::enable()
     mp_impl->enable();
 }
 
+bool RTPSParticipant::get_statistics(
+        std::vector<fastdds::statistics::EntityStatistics>& statistics) const
+{
+    return mp_impl->get_statistics(statistics);
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
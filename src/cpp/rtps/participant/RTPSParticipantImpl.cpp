@@ -55,6 +55,8 @@
 #include <mutex>
 #include <functional>
 #include <algorithm>
+#include <set>
+#include <thread>
 
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
@@ -87,6 +89,30 @@ static bool should_be_intraprocess_only(
         (ParticipantFilteringFlags::FILTER_DIFFERENT_HOST | ParticipantFilteringFlags::FILTER_DIFFERENT_PROCESS);
 }
 
+static void add_ports(
+        const LocatorList_t& locators,
+        std::set<uint32_t>& ports)
+{
+    for (const Locator_t& locator : locators)
+    {
+        ports.insert(locator.port);
+    }
+}
+
+static bool has_any_port(
+        const LocatorList_t& locators,
+        const std::set<uint32_t>& ports)
+{
+    for (const Locator_t& locator : locators)
+    {
+        if (ports.count(locator.port) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 Locator_t& RTPSParticipantImpl::applyLocatorAdaptRule(
         Locator_t& loc)
 {
@@ -110,6 +136,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , mp_builtinProtocols(nullptr)
     , mp_ResourceSemaphore(new Semaphore(0))
     , IdCounter(0)
+    , async_thread_(PParam.async_writer_thread)
     , type_check_fn_(nullptr)
 #if HAVE_SECURITY
     , m_security_manager(this)
@@ -120,6 +147,10 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , is_intraprocess_only_(should_be_intraprocess_only(PParam))
     , has_shm_transport_(false)
 {
+#if HAVE_FASTDDS_STATISTICS
+    statistics_ = statistics_registry_.register_entity(m_guid, fastdds::statistics::StatisticsEntityKind::PARTICIPANT);
+#endif
+
     // Builtin transports by default
     if (PParam.useBuiltinTransports)
     {
@@ -196,7 +227,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 
     mp_userParticipant->mp_impl = this;
-    mp_event_thr.init_thread();
+    mp_event_thr.init_thread(m_att.timed_events_thread);
 
     if (!networkFactoryHasRegisteredTransports())
     {
@@ -319,10 +350,33 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         m_att.defaultMulticastLocatorList.clear();
     }
 
-    createReceiverResources(m_att.builtin.metatrafficMulticastLocatorList, true, false);
-    createReceiverResources(m_att.builtin.metatrafficUnicastLocatorList, true, false);
-    createReceiverResources(m_att.defaultUnicastLocatorList, true, false);
-    createReceiverResources(m_att.defaultMulticastLocatorList, true, false);
+    // Opening a receiver resource may involve creating sockets and shared memory segments, so metatraffic
+    // resources are opened on an auxiliary thread while the user ones are opened on this one.
+    // Both sets are opened sequentially when they share a port, to never open the same input channel twice.
+    std::set<uint32_t> metatraffic_ports;
+    add_ports(m_att.builtin.metatrafficMulticastLocatorList, metatraffic_ports);
+    add_ports(m_att.builtin.metatrafficUnicastLocatorList, metatraffic_ports);
+    bool has_user_locators = !m_att.defaultUnicastLocatorList.empty() || !m_att.defaultMulticastLocatorList.empty();
+    if (!metatraffic_ports.empty() && has_user_locators &&
+            !has_any_port(m_att.defaultUnicastLocatorList, metatraffic_ports) &&
+            !has_any_port(m_att.defaultMulticastLocatorList, metatraffic_ports))
+    {
+        std::thread metatraffic_thread([this]()
+                {
+                    createReceiverResources(m_att.builtin.metatrafficMulticastLocatorList, true, false);
+                    createReceiverResources(m_att.builtin.metatrafficUnicastLocatorList, true, false);
+                });
+        createReceiverResources(m_att.defaultUnicastLocatorList, true, false);
+        createReceiverResources(m_att.defaultMulticastLocatorList, true, false);
+        metatraffic_thread.join();
+    }
+    else
+    {
+        createReceiverResources(m_att.builtin.metatrafficMulticastLocatorList, true, false);
+        createReceiverResources(m_att.builtin.metatrafficUnicastLocatorList, true, false);
+        createReceiverResources(m_att.defaultUnicastLocatorList, true, false);
+        createReceiverResources(m_att.defaultMulticastLocatorList, true, false);
+    }
 
     bool allow_growing_buffers = m_att.allocation.send_buffers.dynamic;
     size_t num_send_buffers = m_att.allocation.send_buffers.preallocated_number;
@@ -440,6 +494,7 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
 
     delete mp_ResourceSemaphore;
     delete mp_userParticipant;
+    std::atomic_store(&send_resource_table_, std::shared_ptr<const SendResourceTable>());
     send_resource_list_.clear();
 
     delete mp_mutex;
@@ -1035,7 +1090,7 @@ bool RTPSParticipantImpl::createSendResources(
         m_network_Factory.GetDefaultOutputLocators(pend->m_att.remoteLocatorList);
     }
 
-    std::lock_guard<std::timed_mutex> guard(m_send_resources_mutex_);
+    std::lock_guard<std::mutex> guard(m_send_resources_mutex_);
 
     //Output locators have been specified, create them
     for (auto it = pend->m_att.remoteLocatorList.begin(); it != pend->m_att.remoteLocatorList.end(); ++it)
@@ -1046,6 +1101,7 @@ bool RTPSParticipantImpl::createSendResources(
                     pend->getGuid() << ", " << (*it) << ")");
         }
     }
+    update_send_resource_table();
 
     return true;
 }
@@ -1101,20 +1157,34 @@ void RTPSParticipantImpl::createReceiverResources(
 void RTPSParticipantImpl::createSenderResources(
         const LocatorList_t& locator_list)
 {
-    std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_);
+    std::lock_guard<std::mutex> lock(m_send_resources_mutex_);
 
     for (auto it_loc = locator_list.begin(); it_loc != locator_list.end(); ++it_loc)
     {
         m_network_Factory.build_send_resources(send_resource_list_, *it_loc);
     }
+    update_send_resource_table();
 }
 
 void RTPSParticipantImpl::createSenderResources(
         const Locator_t& locator)
 {
-    std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_);
+    std::lock_guard<std::mutex> lock(m_send_resources_mutex_);
 
     m_network_Factory.build_send_resources(send_resource_list_, locator);
+    update_send_resource_table();
+}
+
+void RTPSParticipantImpl::update_send_resource_table()
+{
+    std::shared_ptr<SendResourceTable> table = std::make_shared<SendResourceTable>();
+    table->reserve(send_resource_list_.size());
+    for (const auto& send_resource : send_resource_list_)
+    {
+        table->push_back(send_resource.get());
+    }
+
+    std::atomic_store(&send_resource_table_, std::shared_ptr<const SendResourceTable>(std::move(table)));
 }
 
 bool RTPSParticipantImpl::deleteUserEndpoint(
@@ -1465,6 +1535,23 @@ void RTPSParticipantImpl::return_send_buffer(
     send_buffers_->return_buffer(std::move(buffer));
 }
 
+SendBuffersManager::Statistics RTPSParticipantImpl::get_send_buffers_statistics() const
+{
+    return send_buffers_->get_statistics();
+}
+
+bool RTPSParticipantImpl::get_statistics(
+        std::vector<fastdds::statistics::EntityStatistics>& statistics) const
+{
+#if HAVE_FASTDDS_STATISTICS
+    statistics_registry_.snapshot(statistics);
+    return true;
+#else
+    statistics.clear();
+    return false;
+#endif
+}
+
 uint32_t RTPSParticipantImpl::get_domain_id() const
 {
     return domain_id_;
@@ -25,6 +25,8 @@
 #include <sys/types.h>
 #include <mutex>
 #include <atomic>
+#include <memory>
+#include <vector>
 #include <chrono>
 #include <fastrtps/utils/Semaphore.h>
 
@@ -36,6 +38,7 @@
 
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastdds/rtps/builtin/discovery/endpoint/EDPSimple.h>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
@@ -50,6 +53,13 @@
 #include "../messages/RTPSMessageGroup_t.hpp"
 #include "../messages/SendBuffersManager.hpp"
 
+#include <fastdds/statistics/EntityStatistics.hpp>
+#include <statistics/StatisticsProbes.hpp>
+
+#if HAVE_FASTDDS_STATISTICS
+#include <statistics/StatisticsRegistry.hpp>
+#endif
+
 #if HAVE_SECURITY
 #include <fastdds/rtps/Endpoint.h>
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
@@ -247,37 +257,67 @@ public:
     }
 
     /**
-     * Send a message to several locations
+     * Send a message to several locations.
+     * Several threads may send concurrently, as the send resources are taken from an immutable snapshot.
+     * Resources supporting gather sends receive the buffers, so referenced payloads are not copied. The payloads
+     * are copied into msg, only once, before the first send through a resource without that support.
      * @param msg Message to send.
+     * @param buffers Gather list describing the message.
      * @param destination_locators_begin Iterator at the first destination locator.
      * @param destination_locators_end Iterator at the end destination locator.
      * @param max_blocking_time_point execution time limit timepoint.
-     * @return true if at least one locator has been sent.
+     * @return true if the message has been offered to the send resources.
      */
     template<class LocatorIteratorT>
     bool sendSync(
             CDRMessage_t* msg,
+            const std::vector<NetworkBuffer>& buffers,
             const LocatorIteratorT& destination_locators_begin,
             const LocatorIteratorT& destination_locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point)
     {
-        bool ret_code = false;
-        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
+        std::shared_ptr<const SendResourceTable> send_resources = std::atomic_load(&send_resource_table_);
+        if (!send_resources)
+        {
+            return false;
+        }
 
-        if (lock.try_lock_until(max_blocking_time_point))
+        // Only offer the message to the resources of the transports the destinations belong to
+        uint32_t kinds = 0;
+        for (LocatorIteratorT it = destination_locators_begin; it != destination_locators_end; ++it)
         {
-            ret_code = true;
+            kinds |= locator_kind_mask((*it).kind);
+        }
 
-            for (auto& send_resource : send_resource_list_)
+        bool flat = buffers.size() <= 1;
+        for (fastrtps::rtps::SenderResource* send_resource : *send_resources)
+        {
+            if (kinds & locator_kind_mask(send_resource->kind()))
             {
                 LocatorIteratorT locators_begin = destination_locators_begin;
                 LocatorIteratorT locators_end = destination_locators_end;
-                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
-                        max_blocking_time_point);
+                if (!flat && send_resource->supports_gather())
+                {
+                    send_resource->send(buffers, msg->length, &locators_begin, &locators_end,
+                            max_blocking_time_point);
+                }
+                else
+                {
+                    if (!flat)
+                    {
+                        copy_network_buffers(buffers.data(), buffers.size(), msg->buffer);
+                        flat = true;
+                    }
+                    send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
+                            max_blocking_time_point);
+                }
             }
         }
 
-        return ret_code;
+        FASTDDS_STATISTICS_ADD(statistics_, MESSAGES_SENT, 1);
+        FASTDDS_STATISTICS_ADD(statistics_, BYTES_SENT, msg->length);
+
+        return true;
     }
 
     //!Get the participant Mutex
@@ -438,8 +478,36 @@ public:
     void return_send_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Get the usage counters of the send buffers pool.
+     * Useful to tune RTPSParticipantAllocationAttributes::send_buffers.
+     * @return A snapshot of the counters.
+     */
+    SendBuffersManager::Statistics get_send_buffers_statistics() const;
+
     uint32_t get_domain_id() const;
 
+#if HAVE_FASTDDS_STATISTICS
+    fastdds::statistics::StatisticsRegistry& statistics_registry()
+    {
+        return statistics_registry_;
+    }
+
+    //! Performance counters of the participant itself
+    fastdds::statistics::EntityStatisticsCounters* statistics() const
+    {
+        return statistics_;
+    }
+#endif
+
+    /**
+     * Get the current value of the performance counters of the participant and all its endpoints.
+     * @param statistics Vector where the snapshots are stored.
+     * @return false if the library was built without FASTDDS_STATISTICS.
+     */
+    bool get_statistics(
+            std::vector<fastdds::statistics::EntityStatistics>& statistics) const;
+
     //!Compare metatraffic locators list searching for mutations
     bool did_mutation_took_place_on_meta(
         const LocatorList_t& MulticastLocatorList,
@@ -483,6 +551,12 @@ private:
     //!Pool of send buffers
     std::unique_ptr<SendBuffersManager> send_buffers_;
 
+#if HAVE_FASTDDS_STATISTICS
+    //!Performance counters of the participant and its endpoints
+    fastdds::statistics::StatisticsRegistry statistics_registry_;
+    fastdds::statistics::EntityStatisticsCounters* statistics_;
+#endif
+
 #if HAVE_SECURITY
     // Security manager
     security::SecurityManager m_security_manager;
@@ -497,10 +571,29 @@ private:
     //! Receiver resource list needs its own mutext to avoid a race condition.
     std::mutex m_receiverResourcelistMutex;
 
-    //!SenderResource List
-    std::timed_mutex m_send_resources_mutex_;
+    //!SenderResource List. Only modified with m_send_resources_mutex_ taken.
+    std::mutex m_send_resources_mutex_;
     fastdds::rtps::SendResourceList send_resource_list_;
 
+    using SendResourceTable = std::vector<fastrtps::rtps::SenderResource*>;
+    /**
+     * Snapshot of send_resource_list_ used by sendSync.
+     * It is replaced (never modified) with std::atomic_store each time a send resource is created, so senders
+     * don't need to take any lock. Send resources are only destroyed with the participant.
+     */
+    std::shared_ptr<const SendResourceTable> send_resource_table_;
+
+    //! Publish a new snapshot of send_resource_list_. Must be called with m_send_resources_mutex_ taken.
+    void update_send_resource_table();
+
+    //! Bit representing a locator kind on the masks used to filter the send resources.
+    static uint32_t locator_kind_mask(
+            int32_t kind)
+    {
+        // Kinds out of range are mapped to all bits, so they are never filtered out
+        return (kind >= 0 && kind < 32) ? (1u << kind) : ~0u;
+    }
+
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
     //!Pointer to the user participant
@@ -0,0 +1,316 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FragmentReassemblyManager.cpp
+ */
+
+#include <rtps/reader/FragmentReassemblyManager.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+FragmentReassemblyManager::FragmentReassemblyManager(
+        uint32_t max_bytes,
+        ReserveFunction reserve,
+        ReleaseFunction release)
+    : max_bytes_(max_bytes)
+    , reserve_(reserve)
+    , release_(release)
+{
+}
+
+FragmentReassemblyManager::~FragmentReassemblyManager()
+{
+    clear();
+}
+
+CacheChange_t* FragmentReassemblyManager::process_fragments(
+        const CacheChange_t* incoming_change,
+        uint32_t sample_size,
+        uint32_t fragment_starting_num,
+        uint16_t fragments_in_submessage)
+{
+    uint32_t fragment_size = incoming_change->getFragmentSize();
+    if (0 == fragment_size || 0 == sample_size || 0 == fragment_starting_num || 0 == fragments_in_submessage)
+    {
+        return nullptr;
+    }
+
+    auto it = find(incoming_change->writerGUID, incoming_change->sequenceNumber);
+    if (it == samples_.end())
+    {
+        it = create_sample(incoming_change, sample_size);
+        if (it == samples_.end())
+        {
+            return nullptr;
+        }
+    }
+    else if (it->change->serializedPayload.length != sample_size ||
+            it->change->getFragmentSize() != fragment_size)
+    {
+        logWarning(RTPS_MSG_IN, "Fragment of change " << incoming_change->sequenceNumber <<
+                " from " << incoming_change->writerGUID << " does not match the sample being reassembled");
+        return nullptr;
+    }
+
+    PartialSample& sample = *it;
+    sample.last_use = ++use_counter_;
+
+    // Validate fragment indexes
+    uint32_t first_index = fragment_starting_num - 1;
+    uint32_t end_index = first_index + fragments_in_submessage;
+    if (first_index >= sample.fragment_count || end_index > sample.fragment_count)
+    {
+        return nullptr;
+    }
+
+    const SerializedPayload_t& incoming_data = incoming_change->serializedPayload;
+    octet* destination = sample.change->serializedPayload.data;
+    uint32_t source_offset = 0;
+    for (uint32_t index = first_index; index < end_index; ++index, source_offset += fragment_size)
+    {
+        uint32_t offset = index * fragment_size;
+        uint32_t length = (offset + fragment_size > sample_size) ? sample_size - offset : fragment_size;
+        if (source_offset + length > incoming_data.length)
+        {
+            // Submessage shorter than announced
+            break;
+        }
+
+        if (!sample.is_received(index))
+        {
+            memcpy(&destination[offset], &incoming_data.data[source_offset], length);
+            sample.received[index >> 5] |= 1u << (index & 31u);
+            ++sample.received_count;
+        }
+    }
+
+    while (sample.first_missing < sample.fragment_count && sample.is_received(sample.first_missing))
+    {
+        ++sample.first_missing;
+    }
+
+    if (sample.received_count < sample.fragment_count)
+    {
+        return nullptr;
+    }
+
+    // Sample complete. Its change is handed over to the caller.
+    CacheChange_t* ret_val = sample.change;
+    bytes_in_use_ -= sample_size;
+    samples_.erase(it);
+    return ret_val;
+}
+
+bool FragmentReassemblyManager::get_missing_fragments(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number,
+        FragmentNumberSet_t& frag_sns) const
+{
+    auto it = find(writer_guid, sequence_number);
+    if (it == samples_.end())
+    {
+        return false;
+    }
+
+    // Note: Fragment numbers are 1-based but we keep them 0 based.
+    frag_sns.base(it->first_missing + 1);
+    for (uint32_t index = it->first_missing; index < it->fragment_count; ++index)
+    {
+        if (!it->is_received(index) && !frag_sns.add(index + 1))
+        {
+            // Bitmap limit reached
+            break;
+        }
+    }
+
+    return true;
+}
+
+void FragmentReassemblyManager::discard_until(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number)
+{
+    auto it = samples_.begin();
+    while (it != samples_.end())
+    {
+        if (it->change->writerGUID == writer_guid && it->change->sequenceNumber < sequence_number)
+        {
+            logInfo(RTPS_MSG_IN, "Discarding partial change " << it->change->sequenceNumber);
+            it = discard(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void FragmentReassemblyManager::discard_sample(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number)
+{
+    auto it = find(writer_guid, sequence_number);
+    if (it != samples_.end())
+    {
+        discard(it);
+    }
+}
+
+void FragmentReassemblyManager::discard_writer(
+        const GUID_t& writer_guid)
+{
+    auto it = samples_.begin();
+    while (it != samples_.end())
+    {
+        if (it->change->writerGUID == writer_guid)
+        {
+            it = discard(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void FragmentReassemblyManager::clear()
+{
+    for (PartialSample& sample : samples_)
+    {
+        release_(sample.change);
+    }
+    samples_.clear();
+    bytes_in_use_ = 0;
+}
+
+std::vector<FragmentReassemblyManager::PartialSample>::iterator FragmentReassemblyManager::find(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number)
+{
+    auto it = samples_.begin();
+    for (; it != samples_.end(); ++it)
+    {
+        if (it->change->sequenceNumber == sequence_number && it->change->writerGUID == writer_guid)
+        {
+            break;
+        }
+    }
+    return it;
+}
+
+std::vector<FragmentReassemblyManager::PartialSample>::const_iterator FragmentReassemblyManager::find(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number) const
+{
+    auto it = samples_.cbegin();
+    for (; it != samples_.cend(); ++it)
+    {
+        if (it->change->sequenceNumber == sequence_number && it->change->writerGUID == writer_guid)
+        {
+            break;
+        }
+    }
+    return it;
+}
+
+std::vector<FragmentReassemblyManager::PartialSample>::iterator FragmentReassemblyManager::create_sample(
+        const CacheChange_t* incoming_change,
+        uint32_t sample_size)
+{
+    // Make room on the budget. A sample bigger than the budget is accepted when it is the only one.
+    if (max_bytes_ > 0)
+    {
+        while (bytes_in_use_ + sample_size > max_bytes_ && evict_lru())
+        {
+        }
+    }
+
+    CacheChange_t* change = nullptr;
+    while (!reserve_(&change, sample_size))
+    {
+        // The pool may be full of partial samples
+        change = nullptr;
+        if (!evict_lru())
+        {
+            logWarning(RTPS_MSG_IN, "Cannot reserve a change for fragmented sample " <<
+                    incoming_change->sequenceNumber << " from " << incoming_change->writerGUID);
+            return samples_.end();
+        }
+    }
+
+    if (change->serializedPayload.max_size < sample_size)
+    {
+        release_(change);
+        return samples_.end();
+    }
+
+    change->copy_not_memcpy(incoming_change);
+    change->serializedPayload.length = sample_size;
+    // Partial samples are tracked here, so the change is marked as fully assembled from the start.
+    change->setFragmentSize(incoming_change->getFragmentSize(), false);
+
+    PartialSample sample;
+    sample.change = change;
+    sample.fragment_count = change->getFragmentCount();
+    sample.received.assign((sample.fragment_count + 31u) / 32u, 0u);
+    sample.received_count = 0;
+    sample.first_missing = 0;
+    sample.last_use = use_counter_;
+
+    bytes_in_use_ += sample_size;
+    samples_.push_back(std::move(sample));
+    return samples_.end() - 1;
+}
+
+bool FragmentReassemblyManager::evict_lru()
+{
+    if (samples_.empty())
+    {
+        return false;
+    }
+
+    auto lru = samples_.begin();
+    for (auto it = samples_.begin() + 1; it != samples_.end(); ++it)
+    {
+        if (it->last_use < lru->last_use)
+        {
+            lru = it;
+        }
+    }
+
+    logInfo(RTPS_MSG_IN, "Evicting partial change " << lru->change->sequenceNumber <<
+            " from " << lru->change->writerGUID);
+    discard(lru);
+    ++evicted_count_;
+    return true;
+}
+
+std::vector<FragmentReassemblyManager::PartialSample>::iterator FragmentReassemblyManager::discard(
+        std::vector<PartialSample>::iterator it)
+{
+    bytes_in_use_ -= it->change->serializedPayload.length;
+    release_(it->change);
+    return samples_.erase(it);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,235 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FragmentReassemblyManager.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_READER_FRAGMENTREASSEMBLYMANAGER_HPP_
+#define _FASTDDS_RTPS_READER_FRAGMENTREASSEMBLYMANAGER_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/FragmentNumber.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Keeps the samples a reader is receiving in fragments until they are complete.
+ *
+ * Each partial sample owns a CacheChange_t big enough for the whole sample, where fragments are copied as they
+ * arrive, and a bitmap of the fragments already received. Partial samples are not added to the reader history,
+ * so they neither take history slots nor have to be searched for when processing the history. Once all the
+ * fragments of a sample have been received its change is handed to the caller, which can add it to the history
+ * directly.
+ *
+ * The total size of the partial samples is limited by a byte budget. When a new sample does not fit, or a change
+ * could not be reserved for it, the least recently updated partial samples are discarded.
+ *
+ * This class is not thread safe. It is expected to be protected by the mutex of the reader owning it.
+ * @ingroup READER_MODULE
+ */
+class FragmentReassemblyManager
+{
+public:
+
+    //! Function used to reserve a change of a certain payload size.
+    using ReserveFunction = std::function<bool (CacheChange_t**, uint32_t)>;
+
+    //! Function used to give back a change that will not be used.
+    using ReleaseFunction = std::function<void (CacheChange_t*)>;
+
+    /**
+     * Constructor.
+     * @param max_bytes Maximum number of payload bytes held by partial samples. 0 means no limit.
+     * @param reserve Function used to reserve the change of a new partial sample.
+     * @param release Function used to release the change of a discarded partial sample.
+     */
+    FragmentReassemblyManager(
+            uint32_t max_bytes,
+            ReserveFunction reserve,
+            ReleaseFunction release);
+
+    /**
+     * Destructor. Releases the changes of all the partial samples.
+     */
+    ~FragmentReassemblyManager();
+
+    // Non-copyable
+    FragmentReassemblyManager(
+            const FragmentReassemblyManager&) = delete;
+    FragmentReassemblyManager& operator =(
+            const FragmentReassemblyManager&) = delete;
+
+    /**
+     * Process a set of consecutive fragments received on a DATA_FRAG submessage.
+     *
+     * @param incoming_change Change with the information of the submessage, with the fragments on its payload.
+     * @param sample_size Size of the complete sample.
+     * @param fragment_starting_num Number (1-based) of the first fragment on the submessage.
+     * @param fragments_in_submessage Number of fragments on the submessage.
+     *
+     * @return The change holding the complete sample when this submessage completes it, nullptr otherwise.
+     * The returned change is no longer managed by this object.
+     */
+    CacheChange_t* process_fragments(
+            const CacheChange_t* incoming_change,
+            uint32_t sample_size,
+            uint32_t fragment_starting_num,
+            uint16_t fragments_in_submessage);
+
+    /**
+     * Fill a FragmentNumberSet_t with the missing fragments of a partial sample.
+     *
+     * @param writer_guid GUID of the writer of the sample.
+     * @param sequence_number Sequence number of the sample.
+     * @param [out] frag_sns Where the missing fragments are stored.
+     *
+     * @return true when the sample is being reassembled, false otherwise.
+     */
+    bool get_missing_fragments(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& sequence_number,
+            FragmentNumberSet_t& frag_sns) const;
+
+    /**
+     * Discard the partial samples of a writer with a sequence number lower than the given one.
+     * @param writer_guid GUID of the writer.
+     * @param sequence_number First sequence number to keep.
+     */
+    void discard_until(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& sequence_number);
+
+    /**
+     * Discard a partial sample, if it is being reassembled.
+     * @param writer_guid GUID of the writer of the sample.
+     * @param sequence_number Sequence number of the sample.
+     */
+    void discard_sample(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& sequence_number);
+
+    /**
+     * Discard all the partial samples of a writer.
+     * @param writer_guid GUID of the writer.
+     */
+    void discard_writer(
+            const GUID_t& writer_guid);
+
+    /**
+     * Discard all the partial samples.
+     */
+    void clear();
+
+    /**
+     * @return Number of samples being reassembled.
+     */
+    size_t size() const
+    {
+        return samples_.size();
+    }
+
+    /**
+     * @return Number of payload bytes held by the samples being reassembled.
+     */
+    uint64_t bytes_in_use() const
+    {
+        return bytes_in_use_;
+    }
+
+    /**
+     * @return Number of partial samples discarded to make room for new ones.
+     */
+    uint64_t evicted_count() const
+    {
+        return evicted_count_;
+    }
+
+private:
+
+    struct PartialSample
+    {
+        //! Change where the sample is being reassembled.
+        CacheChange_t* change;
+
+        //! One bit per fragment, set when the fragment has been received.
+        std::vector<uint32_t> received;
+
+        //! Total number of fragments.
+        uint32_t fragment_count;
+
+        //! Number of fragments received.
+        uint32_t received_count;
+
+        //! Index (0-based) of the first missing fragment.
+        uint32_t first_missing;
+
+        //! Value of use_counter_ the last time a fragment for this sample was received.
+        uint64_t last_use;
+
+        bool is_received(
+                uint32_t index) const
+        {
+            return 0 != (received[index >> 5] & (1u << (index & 31u)));
+        }
+
+    };
+
+    std::vector<PartialSample>::iterator find(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& sequence_number);
+
+    std::vector<PartialSample>::const_iterator find(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& sequence_number) const;
+
+    /**
+     * Create a new partial sample, evicting the least recently used ones if necessary.
+     * @return Iterator to the new sample, or samples_.end() if it could not be created.
+     */
+    std::vector<PartialSample>::iterator create_sample(
+            const CacheChange_t* incoming_change,
+            uint32_t sample_size);
+
+    //! Discard the least recently used partial sample. Returns false if there was none.
+    bool evict_lru();
+
+    //! Release the change of a partial sample and remove it.
+    std::vector<PartialSample>::iterator discard(
+            std::vector<PartialSample>::iterator it);
+
+    uint32_t max_bytes_;
+    ReserveFunction reserve_;
+    ReleaseFunction release_;
+    std::vector<PartialSample> samples_;
+    uint64_t bytes_in_use_ = 0;
+    uint64_t use_counter_ = 0;
+    uint64_t evicted_count_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_READER_FRAGMENTREASSEMBLYMANAGER_HPP_
@@ -25,6 +25,9 @@
 #include <fastdds/rtps/reader/ReaderListener.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastrtps_deprecated/participant/ParticipantImpl.h>
+#if HAVE_FASTDDS_STATISTICS
+#include <rtps/participant/RTPSParticipantImpl.h>
+#endif
 
 #include <foonathan/memory/namespace_alias.hpp>
 
@@ -54,6 +57,10 @@ RTPSReader::RTPSReader(
 {
     mp_history->mp_reader = this;
     mp_history->mp_mutex = &mp_mutex;
+#if HAVE_FASTDDS_STATISTICS
+    statistics_ = mp_RTPSParticipant->statistics_registry().register_entity(
+        guid, fastdds::statistics::StatisticsEntityKind::READER);
+#endif
 
     logInfo(RTPS_READER, "RTPSReader created correctly");
 }
@@ -64,6 +71,10 @@ RTPSReader::~RTPSReader()
     delete history_state_;
     mp_history->mp_reader = nullptr;
     mp_history->mp_mutex = nullptr;
+
+#if HAVE_FASTDDS_STATISTICS
+    mp_RTPSParticipant->statistics_registry().unregister_entity(statistics_);
+#endif
 }
 
 bool RTPSReader::reserveCache(
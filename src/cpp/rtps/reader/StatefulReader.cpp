@@ -32,6 +32,12 @@
 #include <fastdds/rtps/writer/LivelinessManager.h>
 
 #include "rtps/RTPSDomainImpl.hpp"
+#include "rtps/reader/FragmentReassemblyManager.hpp"
+#include <statistics/StatisticsProbes.hpp>
+
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#include <rtps/DataSharing/DataSharingListener.hpp>
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 
 #include <mutex>
 #include <thread>
@@ -46,12 +52,20 @@ StatefulReader::~StatefulReader()
 {
     logInfo(RTPS_READER, "StatefulReader destructor.");
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    // The listening thread takes the mutex, so it is stopped before.
+    delete datasharing_listener_;
+    datasharing_listener_ = nullptr;
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
     // Only is_alive_ assignment needs to be protected, as
     // matched_writers_ and matched_writers_pool_ are only used
     // when is_alive_ is true
     {
         std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
         is_alive_ = false;
+        delete fragments_;
+        fragments_ = nullptr;
     }
 
     for (WriterProxy* writer : matched_writers_)
@@ -74,17 +88,54 @@ StatefulReader::StatefulReader(
     , acknack_count_(0)
     , nackfrag_count_(0)
     , times_(att.times)
+    , fragments_(nullptr)
+    , datasharing_listener_(nullptr)
     , matched_writers_(att.matched_writers_allocation)
     , matched_writers_pool_(att.matched_writers_allocation)
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
 {
+    fragments_ = new FragmentReassemblyManager(att.fragment_reassembly_max_bytes,
+                    [this](CacheChange_t** change, uint32_t size)
+                    {
+                        return reserveCache(change, size);
+                    },
+                    [this](CacheChange_t* change)
+                    {
+                        releaseCache(change);
+                    });
+
     const RTPSParticipantAttributes& part_att = pimpl->getRTPSParticipantAttributes();
     for (size_t n = 0; n < att.matched_writers_allocation.initial; ++n)
     {
         matched_writers_pool_.push_back(new WriterProxy(this, part_att.allocation.locators, proxy_changes_config_));
     }
+
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#if HAVE_SECURITY
+    // Samples on the rings are not protected by the crypto plugin.
+    if (att.endpoint.data_sharing && pimpl->security_attributes().is_rtps_protected)
+    {
+        logInfo(RTPS_READER, "Data-sharing disabled on reader " << guid << ", as RTPS messages are protected");
+    }
+    else
+#endif // if HAVE_SECURITY
+    if (att.endpoint.data_sharing)
+    {
+        std::shared_ptr<DataSharingNotification> notification = DataSharingNotification::create(guid);
+        if (notification)
+        {
+            datasharing_listener_ = new DataSharingListener(notification,
+                            [this](DataSharingRing& ring, const SequenceNumber_t& sequence_number)
+                            {
+                                return process_datasharing_sample(ring, sequence_number);
+                            },
+                            att.endpoint.data_sharing_listener_thread);
+            datasharing_listener_->start();
+        }
+    }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 }
 
 bool StatefulReader::matched_writer_add(
@@ -155,6 +206,21 @@ bool StatefulReader::matched_writer_add(
 
     wp->start(wdata, initial_sequence);
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    // Writers on the same host may publish their samples on a data-sharing ring.
+    // The security attributes of the reader are only known once it has been registered on the security plugins, so
+    // they are checked here.
+    if (datasharing_listener_ != nullptr && !is_same_process && m_guid.is_on_same_host_as(wdata.guid())
+#if HAVE_SECURITY
+            && DataSharingRing::is_allowed(getRTPSParticipant()->security_attributes(),
+            getAttributes().security_attributes(), wdata.security_attributes_)
+#endif // if HAVE_SECURITY
+            )
+    {
+        datasharing_listener_->add_writer(wdata.guid());
+    }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
     matched_writers_.push_back(wp);
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
@@ -187,6 +253,13 @@ bool StatefulReader::matched_writer_remove(
 
         //Remove cachechanges belonging to the unmatched writer
         mp_history->remove_changes_with_guid(writer_guid);
+        fragments_->discard_writer(writer_guid);
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+        if (datasharing_listener_ != nullptr)
+        {
+            datasharing_listener_->remove_writer(writer_guid);
+        }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 
         for (ResourceLimitedVector<WriterProxy*>::iterator it = matched_writers_.begin(); it != matched_writers_.end();
                 ++it)
@@ -308,21 +381,7 @@ bool StatefulReader::processDataMsg(
 
     if (acceptMsgFrom(change->writerGUID, &pWP))
     {
-        if (liveliness_lease_duration_ < c_TimeInfinite)
-        {
-            auto wlp = this->mp_RTPSParticipant->wlp();
-            if (wlp != nullptr)
-            {
-                wlp->sub_liveliness_manager_->assert_liveliness(
-                    change->writerGUID,
-                    liveliness_kind_,
-                    liveliness_lease_duration_);
-            }
-            else
-            {
-                logError(RTPS_LIVELINESS, "Finite liveliness lease duration but WLP not enabled");
-            }
-        }
+        assert_writer_liveliness(change->writerGUID);
 
         // Check if CacheChange was received or is framework data
         if (!pWP || !pWP->change_was_received(change->sequenceNumber))
@@ -361,6 +420,81 @@ bool StatefulReader::processDataMsg(
     return false;
 }
 
+void StatefulReader::assert_writer_liveliness(
+        const GUID_t& writer_guid)
+{
+    if (liveliness_lease_duration_ < c_TimeInfinite)
+    {
+        auto wlp = this->mp_RTPSParticipant->wlp();
+        if (wlp != nullptr)
+        {
+            wlp->sub_liveliness_manager_->assert_liveliness(
+                writer_guid,
+                liveliness_kind_,
+                liveliness_lease_duration_);
+        }
+        else
+        {
+            logError(RTPS_LIVELINESS, "Finite liveliness lease duration but WLP not enabled");
+        }
+    }
+}
+
+bool StatefulReader::process_datasharing_sample(
+        DataSharingRing& ring,
+        const SequenceNumber_t& sequence_number)
+{
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    WriterProxy* pWP = nullptr;
+
+    std::lock_guard<RecursiveTimedMutex> lock(mp_mutex);
+    if (!is_alive_ || !acceptMsgFrom(ring.writer_guid(), &pWP))
+    {
+        return false;
+    }
+
+    if (pWP != nullptr && pWP->change_was_received(sequence_number))
+    {
+        return true;
+    }
+
+    // Samples no longer on the ring will be repaired through the network.
+    uint32_t length = 0;
+    if (!ring.get_payload_length(sequence_number, length))
+    {
+        return false;
+    }
+
+    CacheChange_t* change_to_add = nullptr;
+    if (!reserveCache(&change_to_add, length))
+    {
+        logWarning(RTPS_READER, "Problem reserving CacheChange in reader: " << getGuid().entityId);
+        return false;
+    }
+
+    if (!ring.read(sequence_number, *change_to_add))
+    {
+        releaseCache(change_to_add);
+        return false;
+    }
+
+    assert_writer_liveliness(change_to_add->writerGUID);
+
+    if (!change_received(change_to_add, pWP))
+    {
+        logInfo(RTPS_READER, "Data-sharing change " << sequence_number << " not added");
+        releaseCache(change_to_add);
+        return false;
+    }
+
+    return true;
+#else
+    (void)ring;
+    (void)sequence_number;
+    return false;
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+}
+
 bool StatefulReader::processDataFragMsg(
         CacheChange_t* incomingChange,
         uint32_t sampleSize,
@@ -403,55 +537,16 @@ bool StatefulReader::processDataFragMsg(
                     IDSTRING "Trying to add fragment " << incomingChange->sequenceNumber.to64long() << " TO reader: " <<
                     getGuid().entityId);
 
-            CacheChange_t* change_to_add = incomingChange;
-
-            CacheChange_t* change_created = nullptr;
-            CacheChange_t* work_change = nullptr;
-            if (!mp_history->get_change(change_to_add->sequenceNumber, change_to_add->writerGUID, &work_change))
-            {
-                // A new change should be reserved
-                if (reserveCache(&work_change, sampleSize))
-                {
-                    if (work_change->serializedPayload.max_size < sampleSize)
-                    {
-                        releaseCache(work_change);
-                        work_change = nullptr;
-                    }
-                    else
-                    {
-                        work_change->copy_not_memcpy(change_to_add);
-                        work_change->serializedPayload.length = sampleSize;
-                        work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
-                        change_created = work_change;
-                    }
-                }
-            }
-
-            if (work_change != nullptr)
-            {
-                work_change->add_fragments(change_to_add->serializedPayload, fragmentStartingNum,
-                        fragmentsInSubmessage);
-            }
+            // Partial samples are kept apart from the history until all their fragments have been received
+            CacheChange_t* work_change = fragments_->process_fragments(incomingChange, sampleSize,
+                            fragmentStartingNum, fragmentsInSubmessage);
 
-            // If this is the first time we have received fragments for this change, add it to history
-            if (change_created != nullptr)
+            if (work_change != nullptr && !change_received(work_change, pWP))
             {
-                if (!change_received(change_created, pWP))
-                {
-
-                    logInfo(RTPS_MSG_IN,
-                            IDSTRING "MessageReceiver not add change " << change_created->sequenceNumber.to64long());
+                logInfo(RTPS_MSG_IN,
+                        IDSTRING "MessageReceiver not add change " << work_change->sequenceNumber.to64long());
 
-                    releaseCache(change_created);
-                    work_change = nullptr;
-                }
-            }
-
-            // If change has been fully reassembled, mark as received and add notify user
-            if (work_change != nullptr && work_change->is_fully_assembled())
-            {
-                pWP->received_change_set(work_change->sequenceNumber);
-                NotifyChanges(pWP);
+                releaseCache(work_change);
             }
         }
     }
@@ -477,11 +572,12 @@ bool StatefulReader::processHeartbeatMsg(
 
     if (acceptMsgFrom(writerGUID, &writer) && writer)
     {
+        FASTDDS_STATISTICS_ADD(statistics_, HEARTBEATS_RECEIVED, 1);
         bool assert_liveliness = false;
         if (writer->process_heartbeat(
                     hbCount, firstSN, lastSN, finalFlag, livelinessFlag, disable_positive_acks_, assert_liveliness))
         {
-            mp_history->remove_fragmented_changes_until(firstSN, writerGUID);
+            fragments_->discard_until(writerGUID, firstSN);
 
             // Try to assert liveliness if requested by proxy's logic
             if (assert_liveliness)
@@ -534,21 +630,11 @@ bool StatefulReader::processGapMsg(
         // TODO (Miguel C): Refactor this inside WriterProxy
         SequenceNumber_t auxSN;
         SequenceNumber_t finalSN = gapList.base() - 1;
-        History::const_iterator history_iterator = mp_history->changesBegin();
         for (auxSN = gapStart; auxSN <= finalSN; auxSN++)
         {
             if (pWP->irrelevant_change_set(auxSN))
             {
-                CacheChange_t* to_remove = nullptr;
-                auto ret_iterator = findCacheInFragmentedProcess(auxSN, pWP->guid(), &to_remove, history_iterator);
-                if (to_remove != nullptr)
-                {
-                    history_iterator = mp_history->remove_change_nts(to_remove, ret_iterator);
-                }
-                else if (ret_iterator != mp_history->changesEnd())
-                {
-                    history_iterator = ret_iterator;
-                }
+                fragments_->discard_sample(pWP->guid(), auxSN);
             }
         }
 
@@ -557,17 +643,7 @@ bool StatefulReader::processGapMsg(
             {
                 if (pWP->irrelevant_change_set(it))
                 {
-                    CacheChange_t* to_remove = nullptr;
-                    auto ret_iterator =
-                    findCacheInFragmentedProcess(auxSN, pWP->guid(), &to_remove, history_iterator);
-                    if (to_remove != nullptr)
-                    {
-                        history_iterator = mp_history->remove_change_nts(to_remove, ret_iterator);
-                    }
-                    else if (ret_iterator != mp_history->changesEnd())
-                    {
-                        history_iterator = ret_iterator;
-                    }
+                    fragments_->discard_sample(pWP->guid(), it);
                 }
             });
 
@@ -667,6 +743,7 @@ bool StatefulReader::change_received(
                     if (mp_history->received_change(a_change, 0))
                     {
                         Time_t::now(a_change->receptionTimestamp);
+                        FASTDDS_STATISTICS_CHANGE_RECEIVED(statistics_, a_change);
                         update_last_notified(a_change->writerGUID, a_change->sequenceNumber);
                         if (getListener() != nullptr)
                         {
@@ -690,6 +767,7 @@ bool StatefulReader::change_received(
     if (mp_history->received_change(a_change, unknown_missing_changes_up_to))
     {
         Time_t::now(a_change->receptionTimestamp);
+        FASTDDS_STATISTICS_CHANGE_RECEIVED(statistics_, a_change);
         GUID_t proxGUID = prox->guid();
 
         // If KEEP_LAST and history full, make older changes as lost.
@@ -711,6 +789,7 @@ bool StatefulReader::change_received(
         return ret;
     }
 
+    FASTDDS_STATISTICS_ADD(statistics_, DATA_REJECTED, 1);
     return false;
 }
 
@@ -973,19 +1052,13 @@ void StatefulReader::send_acknack(
         {
             GUID_t guid = sender.remote_guids().at(0);
             SequenceNumberSet_t sns(writer->available_changes_max() + 1);
-            History::const_iterator history_iterator = mp_history->changesBegin();
 
             missing_changes.for_each(
                 [&](const SequenceNumber_t& seq)
                 {
-                    // Check if the CacheChange_t is uncompleted.
-                    CacheChange_t* uncomplete_change = nullptr;
-                    auto ret_iterator = findCacheInFragmentedProcess(seq, guid, &uncomplete_change, history_iterator);
-                    if (ret_iterator != mp_history->changesEnd())
-                    {
-                        history_iterator = ret_iterator;
-                    }
-                    if (uncomplete_change == nullptr)
+                    // Check if the sample is being reassembled.
+                    FragmentNumberSet_t frag_sns;
+                    if (!fragments_->get_missing_fragments(guid, seq, frag_sns))
                     {
                         if (!sns.add(seq))
                         {
@@ -997,8 +1070,6 @@ void StatefulReader::send_acknack(
                     }
                     else
                     {
-                        FragmentNumberSet_t frag_sns;
-                        uncomplete_change->get_missing_fragments(frag_sns);
                         ++nackfrag_count_;
                         logInfo(RTPS_READER, "Sending NACKFRAG for sample" << seq << ": " << frag_sns; );
 
@@ -1022,9 +1093,10 @@ void StatefulReader::send_acknack(
 
 bool StatefulReader::send_sync_nts(
         CDRMessage_t* message,
+        const std::vector<NetworkBuffer>& buffers,
         const Locators& locators_begin,
         const Locators& locators_end,
         std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
-    return mp_RTPSParticipant->sendSync(message, locators_begin, locators_end, max_blocking_time_point);
+    return mp_RTPSParticipant->sendSync(message, buffers, locators_begin, locators_end, max_blocking_time_point);
 }
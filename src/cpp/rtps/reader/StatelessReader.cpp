@@ -26,6 +26,7 @@
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 #include <fastdds/rtps/writer/LivelinessManager.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <statistics/StatisticsProbes.hpp>
 
 #include <mutex>
 #include <thread>
@@ -160,6 +161,7 @@ bool StatelessReader::change_received(
         if (mp_history->received_change(change, 0))
         {
             Time_t::now(change->receptionTimestamp);
+            FASTDDS_STATISTICS_CHANGE_RECEIVED(statistics_, change);
             update_last_notified(change->writerGUID, change->sequenceNumber);
             ++total_unread_;
 
@@ -173,6 +175,7 @@ bool StatelessReader::change_received(
         }
     }
 
+    FASTDDS_STATISTICS_ADD(statistics_, DATA_REJECTED, 1);
     return false;
 }
 
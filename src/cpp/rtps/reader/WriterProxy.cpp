@@ -560,6 +560,7 @@ void WriterProxy::update_heartbeat_response_interval(
 
 bool WriterProxy::send(
         CDRMessage_t* message,
+        const std::vector<NetworkBuffer>& buffers,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     if (is_on_same_process_)
@@ -569,7 +570,7 @@ bool WriterProxy::send(
 
     const ResourceLimitedVector<Locator_t>& remote_locators = remote_locators_shrinked();
 
-    return reader_->send_sync_nts(message,
+    return reader_->send_sync_nts(message, buffers,
                    Locators(remote_locators.begin()),
                    Locators(remote_locators.end()),
                    max_blocking_time_point);
@@ -310,10 +310,12 @@ public:
      * Send a message through this interface.
      *
      * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers Gather list describing the message.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     virtual bool send(
             CDRMessage_t* message,
+            const std::vector<NetworkBuffer>& buffers,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
     bool is_on_same_process() const
@@ -14,6 +14,7 @@
 
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <utils/threading.hpp>
 
 #include <mutex>
 #include <algorithm>
@@ -73,7 +74,10 @@ void AsyncWriterThread::wake_up(
         if (thread_ == nullptr)
         {
             running_ = true;
-            thread_ = new std::thread(&AsyncWriterThread::run, this);
+            thread_ = new eprosima::thread(eprosima::create_thread([this]()
+                        {
+                            run();
+                        }, thread_settings_, "dds.async"));
         }
         else
         {
@@ -97,7 +101,10 @@ void AsyncWriterThread::wake_up(
             if (thread_ == nullptr)
             {
                 running_ = true;
-                thread_ = new std::thread(&AsyncWriterThread::run, this);
+                thread_ = new eprosima::thread(eprosima::create_thread([this]()
+                        {
+                            run();
+                        }, thread_settings_, "dds.async"));
             }
             else
             {
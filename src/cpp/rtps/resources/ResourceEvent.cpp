@@ -21,6 +21,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include "TimedEventImpl.h"
+#include <utils/threading.hpp>
 
 #include <cassert>
 #include <thread>
@@ -252,14 +253,19 @@ void ResourceEvent::do_timer_actions()
     }
 }
 
-void ResourceEvent::init_thread()
+void ResourceEvent::init_thread(
+        const fastdds::rtps::ThreadSettings& settings,
+        const std::string& name)
 {
     std::lock_guard<TimedMutex> lock(mutex_);
 
     allow_vector_manipulation_ = false;
     resize_collections();
 
-    thread_ = std::thread(&ResourceEvent::event_service, this);
+    thread_ = create_thread([this]()
+                    {
+                        event_service();
+                    }, settings, name);
 }
 
 } /* namespace rtps */
@@ -205,6 +205,8 @@ size_t TCPChannelResourceSecure::send(
 
     if (eConnecting < connection_status_)
     {
+        std::lock_guard<std::mutex> send_guard(send_mutex_);
+
         std::vector<asio::const_buffer> buffers;
         if(header_size > 0)
         {
@@ -21,6 +21,7 @@
 #include <fastrtps/utils/System.h>
 #include <fastdds/rtps/transport/TCPChannelResourceBasic.h>
 #include <fastdds/rtps/transport/TCPAcceptorBasic.h>
+#include <utils/threading.hpp>
 #if TLS_FOUND
 #include <fastdds/rtps/transport/TCPChannelResourceSecure.h>
 #include <fastdds/rtps/transport/TCPAcceptorSecure.h>
@@ -389,11 +390,12 @@ bool TCPTransportInterface::init()
 #endif
         io_service_.run();
     };
-    io_service_thread_ = std::make_shared<std::thread>(ioServiceFunction);
+    io_service_thread_ = std::make_shared<eprosima::thread>(
+        create_thread(ioServiceFunction, configuration()->reception_threads, "dds.tcp.io"));
 
     if (0 < configuration()->keep_alive_frequency_ms)
     {
-        io_service_timers_thread_ = std::make_shared<std::thread>([&]()
+        io_service_timers_thread_ = std::make_shared<eprosima::thread>(create_thread([&]()
         {
 
 #if ASIO_VERSION >= 101200
@@ -402,7 +404,7 @@ bool TCPTransportInterface::init()
             io_service::work work(io_service_timers_);
 #endif
             io_service_timers_.run();
-        });
+        }, configuration()->reception_threads, "dds.tcp.timers"));
     }
 
     return true;
@@ -1157,8 +1159,11 @@ void TCPTransportInterface::SocketAccepted(
             channel->set_options(configuration());
             std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
             std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                        channel_weak_ptr, rtcp_manager_weak_ptr));
+            channel->thread(create_thread([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                    {
+                        perform_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                    }, configuration()->reception_threads,
+                    "dds.tcp." + std::to_string(IPLocator::getPhysicalPort(channel->locator()))));
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                     << ", remote: " << channel->remote_endpoint().address()
@@ -1203,8 +1208,11 @@ void TCPTransportInterface::SecureSocketAccepted(
             secure_channel->set_options(configuration());
             std::weak_ptr<TCPChannelResource> channel_weak_ptr = secure_channel;
             std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            secure_channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                        channel_weak_ptr, rtcp_manager_weak_ptr));
+            secure_channel->thread(create_thread([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                    {
+                        perform_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                    }, configuration()->reception_threads,
+                    "dds.tcp." + std::to_string(IPLocator::getPhysicalPort(secure_channel->locator()))));
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                     << ", remote: " << socket->lowest_layer().remote_endpoint().address()
@@ -1246,8 +1254,11 @@ void TCPTransportInterface::SocketConnected(
                     channel->set_options(configuration());
 
                     std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-                    channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                                channel_weak_ptr, rtcp_manager_weak_ptr));
+                    channel->thread(create_thread([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                            {
+                                perform_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                            }, configuration()->reception_threads,
+                            "dds.tcp." + std::to_string(IPLocator::getPhysicalPort(channel->locator()))));
                 }
             }
             else
@@ -16,6 +16,8 @@
 #include <fastdds/rtps/transport/UDPTransportInterface.h>
 #include <fastdds/rtps/transport/UDPChannelResource.h>
 #include <fastdds/rtps/messages/MessageReceiver.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -31,7 +33,8 @@ UDPChannelResource::UDPChannelResource(
         uint32_t maxMsgSize,
         const Locator_t& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver)
+        TransportReceiverInterface* receiver,
+        const ThreadSettings& thread_settings)
     : ChannelResource(maxMsgSize)
     , message_receiver_(receiver)
     , socket_(moveSocket(socket))
@@ -39,7 +42,10 @@ UDPChannelResource::UDPChannelResource(
     , interface_(sInterface)
     , transport_(transport)
 {
-    thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
+    thread(create_thread([this, locator]()
+            {
+                perform_listen_operation(locator);
+            }, thread_settings, "dds.udp." + std::to_string(fastrtps::rtps::IPLocator::getPhysicalPort(locator))));
 }
 
 UDPChannelResource::~UDPChannelResource()
@@ -51,6 +57,8 @@ void UDPChannelResource::perform_listen_operation(Locator_t input_locator)
 {
     Locator_t remote_locator;
 
+    relocate_message_buffer();
+
     while (alive())
     {
         // Blocking receive.
@@ -25,6 +25,13 @@
 #include <algorithm>
 #include <chrono>
 
+#ifndef _WIN32
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif // ifndef _WIN32
+
 using namespace std;
 using namespace asio;
 
@@ -39,6 +46,8 @@ using LocatorSelectorEntry = fastrtps::rtps::LocatorSelectorEntry;
 using LocatorSelector = fastrtps::rtps::LocatorSelector;
 using IPFinder = fastrtps::rtps::IPFinder;
 using octet = fastrtps::rtps::octet;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
+using fastrtps::rtps::max_network_buffers;
 using PortParameters = fastrtps::rtps::PortParameters;
 using SenderResource = fastrtps::rtps::SenderResource;
 using Log = fastdds::dds::Log;
@@ -226,7 +235,8 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
                                                              IPLocator::getPhysicalPort(locator), is_multicast);
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
-                                                                    sInterface, receiver);
+                                                                    sInterface, receiver,
+                                                                    configuration()->reception_threads);
     return p_channel_resource;
 }
 
@@ -446,6 +456,34 @@ bool UDPTransportInterface::send(
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         bool only_multicast_purpose,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    NetworkBuffer buffer(send_buffer, send_buffer_size);
+    return send(&buffer, 1u, send_buffer_size, socket, destination_locators_begin, destination_locators_end,
+                   only_multicast_purpose, max_blocking_time_point);
+}
+
+bool UDPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send(buffers.data(), buffers.size(), total_bytes, socket, destination_locators_begin,
+                   destination_locators_end, only_multicast_purpose, max_blocking_time_point);
+}
+
+bool UDPTransportInterface::send(
+        const NetworkBuffer* buffers,
+        size_t buffer_count,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -458,8 +496,9 @@ bool UDPTransportInterface::send(
     {
         if (IsLocatorSupported(*it))
         {
-            ret &= send(send_buffer, 
-                send_buffer_size, 
+            ret &= send(buffers,
+                buffer_count,
+                total_bytes,
                 socket,
                 *it, 
                 only_multicast_purpose, 
@@ -480,7 +519,20 @@ bool UDPTransportInterface::send(
         bool only_multicast_purpose,
         const std::chrono::microseconds& timeout)
 {
-    if (send_buffer_size > configuration()->sendBufferSize)
+    NetworkBuffer buffer(send_buffer, send_buffer_size);
+    return send(&buffer, 1u, send_buffer_size, socket, remote_locator, only_multicast_purpose, timeout);
+}
+
+bool UDPTransportInterface::send(
+        const NetworkBuffer* buffers,
+        size_t buffer_count,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const fastrtps::rtps::Locator_t& remote_locator,
+        bool only_multicast_purpose,
+        const std::chrono::microseconds& timeout)
+{
+    if (total_bytes > configuration()->sendBufferSize || buffer_count > max_network_buffers)
     {
         return false;
     }
@@ -496,17 +548,64 @@ bool UDPTransportInterface::send(
 
         try
         {
-            (void)timeout;
 #ifndef _WIN32
-            struct timeval timeStruct;
-            timeStruct.tv_sec = 0;
-            timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
-            setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
-                    reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
-#endif
+            // The socket is not modified, so several threads can send through it concurrently. The message is sent
+            // without blocking, and the socket is only polled when its buffer is full.
+            // The buffers are gathered by the kernel into a single datagram.
+            struct iovec iov[max_network_buffers];
+            for (size_t i = 0; i < buffer_count; ++i)
+            {
+                iov[i].iov_base = const_cast<octet*>(buffers[i].buffer);
+                iov[i].iov_len = buffers[i].size;
+            }
+
+            struct msghdr msg;
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_name = destinationEndpoint.data();
+            msg.msg_namelen = static_cast<socklen_t>(destinationEndpoint.size());
+            msg.msg_iov = iov;
+            msg.msg_iovlen = buffer_count;
+
+            int fd = getSocketPtr(socket)->native_handle();
+            ssize_t sent = ::sendmsg(fd, &msg, MSG_DONTWAIT);
+            if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) && !configuration()->non_blocking_send &&
+                    timeout.count() > 0)
+            {
+                struct pollfd poll_fd;
+                poll_fd.fd = fd;
+                poll_fd.events = POLLOUT;
+                poll_fd.revents = 0;
+                int timeout_ms = static_cast<int>((timeout.count() + 999) / 1000);
+                if (::poll(&poll_fd, 1, timeout_ms) > 0)
+                {
+                    sent = ::sendmsg(fd, &msg, MSG_DONTWAIT);
+                }
+            }
+
+            if (sent < 0)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+                    return true;
+                }
+
+                logWarning(RTPS_MSG_OUT, strerror(errno));
+                return false;
+            }
+            bytesSent = static_cast<size_t>(sent);
+#else
+            (void)timeout;
+
+            std::vector<asio::const_buffer> asio_buffers;
+            asio_buffers.reserve(buffer_count);
+            for (size_t i = 0; i < buffer_count; ++i)
+            {
+                asio_buffers.push_back(asio::buffer(buffers[i].buffer, buffers[i].size));
+            }
 
             asio::error_code ec;
-            bytesSent = getSocketPtr(socket)->send_to(asio::buffer(send_buffer, send_buffer_size), destinationEndpoint, 0, ec);
+            bytesSent = getSocketPtr(socket)->send_to(asio_buffers, destinationEndpoint, 0, ec);
             if(!!ec)
             {
                 if ((ec.value() == asio::error::would_block) ||
@@ -519,6 +618,7 @@ bool UDPTransportInterface::send(
                 logWarning(RTPS_MSG_OUT, ec.message());
                 return false;
             }
+#endif // ifndef _WIN32
         }
         catch (const std::exception& error)
         {
@@ -21,6 +21,7 @@
 
 #include <rtps/transport/shared_mem/SharedMemManager.hpp>
 #include <rtps/transport/shared_mem/SharedMemTransport.h>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -37,7 +38,8 @@ public:
             const fastrtps::rtps::Locator_t& locator,
             TransportReceiverInterface* receiver,
             const std::string& dump_file,
-            bool should_init_thread = true)
+            bool should_init_thread = true,
+            const ThreadSettings& thread_settings = ThreadSettings())
         : ChannelResource()
         , message_receiver_(receiver)
         , listener_(listener)
@@ -55,7 +57,7 @@ public:
 
         if (should_init_thread)
         {
-            init_thread(locator);
+            init_thread(locator, thread_settings);
         }
     }
 
@@ -163,9 +165,13 @@ private:
 protected:
 
     void init_thread(
-            const fastrtps::rtps::Locator_t& locator)
+            const fastrtps::rtps::Locator_t& locator,
+            const ThreadSettings& thread_settings = ThreadSettings())
     {
-        this->thread(std::thread(&SharedMemChannelResource::perform_listen_operation, this, locator));
+        this->thread(create_thread([this, locator]()
+                {
+                    perform_listen_operation(locator);
+                }, thread_settings, "dds.shm." + std::to_string(locator.port)));
     }
 
 
@@ -16,7 +16,10 @@
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <list>
+#include <thread>
 #include <unordered_map>
 
 #include <rtps/transport/shared_mem/SharedMemGlobal.hpp>
@@ -342,6 +345,8 @@ public:
     /**
      * Handle a shared-memory segment
      * Allows buffer allocation / deallocation
+     * When slab_size is not zero, the payload area is split at creation into fixed-size buffers, which are
+     * handed out without calling the segment's allocator. Otherwise buffers are allocated from the segment.
      */
     class Segment
     {
@@ -351,9 +356,12 @@ public:
                 uint32_t size,
                 uint32_t payload_size,
                 uint32_t max_allocations,
-                const std::string& domain_name)
+                const std::string& domain_name,
+                uint32_t slab_size = 0,
+                bool huge_pages = false)
             : segment_id_()
             , overflows_count_(0)
+            , slab_size_(0)
         {
             generate_segment_id_and_name(domain_name);
 
@@ -372,20 +380,51 @@ public:
                 throw;
             }
 
+            if (huge_pages && !segment_->advise_huge_pages())
+            {
+                logWarning(RTPS_TRANSPORT_SHM, "Segment " << segment_name_ << " cannot be backed by huge pages");
+            }
+
             free_bytes_ = payload_size;
 
+            uint32_t num_nodes = max_allocations;
+            void* slabs = nullptr;
+            if (slab_size > 0)
+            {
+                // Keep the slabs aligned as the allocator would
+                constexpr uint32_t alignment = static_cast<uint32_t>(alignof(std::max_align_t));
+                slab_size_ = (slab_size + alignment - 1) & ~(alignment - 1);
+                num_nodes = (std::min)(max_allocations, payload_size / slab_size_);
+                if (num_nodes == 0)
+                {
+                    throw std::runtime_error("buffer slab size greater than the segment size");
+                }
+
+                free_bytes_ = num_nodes * slab_size_;
+                slabs = segment_->get().allocate(free_bytes_);
+            }
+
             // Alloc the buffer nodes
             auto buffers_nodes = segment_->get().construct<BufferNode>
-                        (boost::interprocess::anonymous_instance)[max_allocations]();
+                        (boost::interprocess::anonymous_instance)[num_nodes]();
 
             // All buffer nodes are free
-            for (uint32_t i = 0; i < max_allocations; i++)
+            for (uint32_t i = 0; i < num_nodes; i++)
             {
                 buffers_nodes[i].status.exchange({0, 0, 0});
                 buffers_nodes[i].data_size = 0;
                 buffers_nodes[i].data_offset = 0;
+                if (slabs != nullptr)
+                {
+                    // Each node owns a slab for the whole life of the segment
+                    buffers_nodes[i].data_offset = segment_->get_offset_from_address(
+                        static_cast<char*>(slabs) + static_cast<size_t>(i) * slab_size_);
+                }
                 free_buffers_.push_back(&buffers_nodes[i]);
             }
+
+            // Map every page now instead of on the data path
+            segment_->prefault();
         }
 
         ~Segment()
@@ -420,7 +459,13 @@ public:
 
             std::lock_guard<std::mutex> lock(alloc_mutex_);
 
-            if (!recover_buffers(size))
+            if (slab_size_ > 0 && size > slab_size_)
+            {
+                overflows_count_++;
+                throw std::runtime_error("allocation greater than buffer slab size");
+            }
+
+            if (!recover_buffers(allocation_size(size)))
             {
                 throw std::runtime_error("allocation overflow");
             }
@@ -433,10 +478,17 @@ public:
             {
                 buffer_node = pop_free_node();
 
-                data = segment_->get().allocate(size);
-                free_bytes_ -= size;
+                if (slab_size_ > 0)
+                {
+                    data = segment_->get_address_from_offset(buffer_node->data_offset);
+                }
+                else
+                {
+                    data = segment_->get().allocate(size);
+                    buffer_node->data_offset = segment_->get_offset_from_address(data);
+                }
+                free_bytes_ -= allocation_size(size);
 
-                buffer_node->data_offset = segment_->get_offset_from_address(data);
                 buffer_node->data_size = size;
 
                 auto validity_id = buffer_node->status.load(std::memory_order_relaxed).validity_id;
@@ -499,6 +551,16 @@ public:
 
         uint32_t free_bytes_;
 
+        //! Size of the fixed-size buffers, 0 when buffers are allocated from the segment
+        uint32_t slab_size_;
+
+        //! @return the bytes of the segment taken by a buffer of the given size
+        inline uint32_t allocation_size(
+                uint32_t size) const
+        {
+            return slab_size_ > 0 ? slab_size_ : size;
+        }
+
         void generate_segment_id_and_name(
                 const std::string& domain_name)
         {
@@ -544,10 +606,13 @@ public:
         void release_buffer(
                 BufferNode* buffer_node)
         {
-            segment_->get().deallocate(
-                segment_->get_address_from_offset(buffer_node->data_offset));
+            if (slab_size_ == 0)
+            {
+                segment_->get().deallocate(
+                    segment_->get_address_from_offset(buffer_node->data_offset));
+            }
 
-            free_bytes_ += buffer_node->data_size;
+            free_bytes_ += allocation_size(buffer_node->data_size);
         }
 
         /**
@@ -605,18 +670,29 @@ public:
 
     /**
      * Listen to descriptors pushed to a port.
-     * Provides an interface to wait and access to the data referenced by the descriptors
+     * Provides an interface to wait and access to the data referenced by the descriptors.
+     * When busy-polling is enabled, pop() spins on the port's queue for a while before parking on the
+     * port's condition variable. A spinning listener is not counted as waiting, so producers skip the notification.
      */
     class Listener
     {
     public:
 
+        /**
+         * @param shared_mem_manager Manager owning the listener.
+         * @param port Port to listen to.
+         * @param busy_poll_us Maximum time, in microseconds, to busy-poll the port before parking.
+         *                     0 disables busy-polling.
+         */
         Listener(
                 SharedMemManager* shared_mem_manager,
-                std::shared_ptr<SharedMemGlobal::Port> port)
+                std::shared_ptr<SharedMemGlobal::Port> port,
+                uint32_t busy_poll_us = 0)
             : global_port_(port)
             , shared_mem_manager_(shared_mem_manager)
             , is_closed_(false)
+            , busy_poll_us_(busy_poll_us)
+            , spin_budget_us_(busy_poll_us)
         {
             global_listener_ = global_port_->create_listener(&listener_index_);
         }
@@ -645,6 +721,8 @@ public:
             other.global_port_.reset();
             shared_mem_manager_ = other.shared_mem_manager_;
             is_closed_.exchange(other.is_closed_);
+            busy_poll_us_ = other.busy_poll_us_;
+            spin_budget_us_ = other.spin_budget_us_;
 
             return *this;
         }
@@ -673,8 +751,13 @@ public:
 
                     while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()) )
                     {
-                        // Wait until there's data to pop
-                        global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        if (!busy_poll())
+                        {
+                            // Wait until there's data to pop
+                            global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                            // Data arrived while parked, give the next spin a chance again
+                            spin_budget_us_ = (std::min)(busy_poll_us_, (std::max)(1u, spin_budget_us_ * 2));
+                        }
                     }
 
                     if (!head_cell)
@@ -748,7 +831,7 @@ public:
         {
             auto new_port = shared_mem_manager_->regenerate_port(global_port_, global_port_->open_mode());
 
-            auto new_listener = new_port->create_listener();
+            auto new_listener = new_port->create_listener(busy_poll_us_);
 
             *this = std::move(*new_listener);
         }
@@ -765,6 +848,41 @@ public:
 
     private:
 
+        /**
+         * Spin on the head of the port's queue, without taking the port's mutex, during the current spin budget.
+         * The budget adapts to the traffic: it is restored to busy_poll_us when data arrives while spinning and
+         * halved when it does not, so a listener on an idle port ends up parking straight away.
+         * @return true when there is data to pop or the listener was closed, false when the listener should park.
+         */
+        bool busy_poll()
+        {
+            if (0 == spin_budget_us_)
+            {
+                return false;
+            }
+
+            // Checking the clock is more expensive than checking the queue
+            constexpr uint32_t polls_per_clock_check = 64;
+
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_budget_us_);
+            do
+            {
+                for (uint32_t i = 0; i < polls_per_clock_check; ++i)
+                {
+                    if (is_closed_.load(std::memory_order_relaxed) || nullptr != global_listener_->head())
+                    {
+                        spin_budget_us_ = busy_poll_us_;
+                        return true;
+                    }
+                }
+
+                std::this_thread::yield();
+            } while (std::chrono::steady_clock::now() < deadline);
+
+            spin_budget_us_ /= 2;
+            return false;
+        }
+
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -774,6 +892,12 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        //! Configured maximum busy-polling time
+        uint32_t busy_poll_us_;
+
+        //! Busy-polling time for the next pop, adapted to the traffic
+        uint32_t spin_budget_us_;
+
     }; // Listener
 
     /**
@@ -853,9 +977,15 @@ public:
             return ret;
         }
 
-        std::shared_ptr<Listener> create_listener()
+        /**
+         * Create a listener of the port.
+         * @param busy_poll_us Maximum time, in microseconds, the listener busy-polls the port before parking.
+         *                     0 disables busy-polling.
+         */
+        std::shared_ptr<Listener> create_listener(
+                uint32_t busy_poll_us = 0)
         {
-            return std::make_shared<Listener>(shared_mem_manager_, global_port_);
+            return std::make_shared<Listener>(shared_mem_manager_, global_port_, busy_poll_us);
         }
 
     private:
@@ -883,10 +1013,12 @@ public:
      */
     std::shared_ptr<Segment> create_segment(
             uint32_t size,
-            uint32_t max_allocations)
+            uint32_t max_allocations,
+            uint32_t slab_size = 0,
+            bool huge_pages = false)
     {
         return std::make_shared<Segment>(size + segment_allocation_extra_size(max_allocations), size, max_allocations,
-                       global_segment_.domain_name());
+                       global_segment_.domain_name(), slab_size, huge_pages);
     }
 
     /**
@@ -40,6 +40,10 @@
 #include "RobustInterprocessCondition.hpp"
 #include "SharedMemUUID.hpp"
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif // if defined(__linux__)
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -136,6 +140,36 @@ public:
         return *segment_;
     }
 
+    /**
+     * Advise the kernel to back the segment with transparent huge pages.
+     * Only effective on Linux with shmem huge pages enabled, and for pages not touched yet.
+     * @return true when the advice was accepted.
+     */
+    bool advise_huge_pages()
+    {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        return 0 == madvise(segment_->get_address(), segment_->get_size(), MADV_HUGEPAGE);
+#else
+        return false;
+#endif // if defined(__linux__) && defined(MADV_HUGEPAGE)
+    }
+
+    /**
+     * Touch every page of the segment, so no page faults happen later on the data path.
+     * Contents are preserved, but it should only be called while no other process uses the segment.
+     */
+    void prefault()
+    {
+        volatile char* base = static_cast<char*>(segment_->get_address());
+        size_t size = segment_->get_size();
+        size_t page_size = boost::interprocess::mapped_region::get_page_size();
+
+        for (size_t offset = 0; offset < size; offset += page_size)
+        {
+            base[offset] = base[offset];
+        }
+    }
+
     static void remove(
             const std::string& name)
     {
@@ -42,6 +42,7 @@ using Locator_t = fastrtps::rtps::Locator_t;
 using LocatorList_t = fastrtps::rtps::LocatorList_t;
 using Log = dds::Log;
 using octet = fastrtps::rtps::octet;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
 using SenderResource = fastrtps::rtps::SenderResource;
 using LocatorSelectorEntry = fastrtps::rtps::LocatorSelectorEntry;
 using LocatorSelector = fastrtps::rtps::LocatorSelector;
@@ -206,7 +207,10 @@ void SharedMemTransport::clean_up()
     try
     {
         // Delete send ports
-        opened_ports_.clear();
+        {
+            std::lock_guard<std::mutex> lock(opened_ports_mutex_);
+            opened_ports_.clear();
+        }
 
         // Delete input channels
         {
@@ -251,17 +255,22 @@ bool SharedMemTransport::init()
         return false;
     }
 
+    if (configuration_.buffer_slab_size() != 0 &&
+            configuration_.buffer_slab_size() < configuration_.max_message_size())
+    {
+        logError(RTPS_MSG_OUT, "max_message_size cannot be greater than buffer_slab_size");
+        return false;
+    }
+
     try
     {
+        SharedMemWatchdog::thread_settings(configuration_.reception_threads);
+
+        // The segment maps all its pages on creation, so no page faults happen on the data path
         shared_mem_manager_ = SharedMemManager::create(SHM_MANAGER_DOMAIN);
         shared_mem_segment_ = shared_mem_manager_->create_segment(configuration_.segment_size(),
-                        configuration_.port_queue_capacity());
-
-        // Memset the whole segment to zero in order to force physical map of the buffer
-        auto buffer = shared_mem_segment_->alloc_buffer(configuration_.segment_size(),
-                        (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
-        memset(buffer->data(), 0, configuration_.segment_size());
-        buffer.reset();
+                        configuration_.port_queue_capacity(), configuration_.buffer_slab_size(),
+                        configuration_.huge_pages());
 
         if (!configuration_.rtps_dump_file().empty())
         {
@@ -316,10 +325,12 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
             locator.port,
             configuration_.port_queue_capacity(),
             configuration_.healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+            open_mode)->create_listener(configuration_.busy_poll_us()),
         locator,
         receiver,
-        configuration_.rtps_dump_file());
+        configuration_.rtps_dump_file(),
+        true,
+        configuration_.reception_threads);
 }
 
 bool SharedMemTransport::OpenOutputChannel(
@@ -388,16 +399,17 @@ bool SharedMemTransport::transform_remote_locator(
 }
 
 std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const NetworkBuffer* buffers,
+        size_t buffer_count,
+        uint32_t total_bytes,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     assert(shared_mem_segment_);
 
     std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
-            shared_mem_segment_->alloc_buffer(send_buffer_size, max_blocking_time_point);
+            shared_mem_segment_->alloc_buffer(total_bytes, max_blocking_time_point);
 
-    memcpy(shared_buffer->data(), send_buffer, send_buffer_size);
+    fastrtps::rtps::copy_network_buffers(buffers, buffer_count, static_cast<octet*>(shared_buffer->data()));
 
     return shared_buffer;
 }
@@ -408,6 +420,30 @@ bool SharedMemTransport::send(
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    NetworkBuffer buffer(send_buffer, send_buffer_size);
+    return send(&buffer, 1u, send_buffer_size, destination_locators_begin, destination_locators_end,
+                   max_blocking_time_point);
+}
+
+bool SharedMemTransport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send(buffers.data(), buffers.size(), total_bytes, destination_locators_begin, destination_locators_end,
+                   max_blocking_time_point);
+}
+
+bool SharedMemTransport::send(
+        const NetworkBuffer* buffers,
+        size_t buffer_count,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -424,7 +460,8 @@ bool SharedMemTransport::send(
                 // Only copy the first time
                 if (shared_buffer == nullptr)
                 {
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = copy_to_shared_buffer(buffers, buffer_count, total_bytes,
+                                    max_blocking_time_point);
                 }
 
                 ret &= send(shared_buffer, *it);
@@ -461,6 +498,8 @@ bool SharedMemTransport::send(
 std::shared_ptr<SharedMemManager::Port> SharedMemTransport::find_port(
         uint32_t port_id)
 {
+    std::lock_guard<std::mutex> lock(opened_ports_mutex_);
+
     auto ports_it = opened_ports_.find(port_id);
 
     // The port is already opened
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_SHAREDMEM_TRANSPORT_H_
 #define _FASTDDS_SHAREDMEM_TRANSPORT_H_
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 
@@ -146,6 +147,22 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Send a gather list. The buffers are copied directly into the shared memory buffer, which is then pushed to
+     * all the destinations.
+     * @param buffers Gather list of the message to send.
+     * @param total_bytes Sum of the sizes of the buffers.
+     * @param destination_locators_begin pointer to destination locators iterator begin.
+     * @param destination_locators_end pointer to destination locators iterator end.
+     * @param max_blocking_time_point maximum blocking time.
+     */
+    virtual bool send(
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -206,6 +223,9 @@ private:
 
     std::map<uint32_t, std::shared_ptr<SharedMemManager::Port>> opened_ports_;
 
+    //! Protects opened_ports_, as messages can be sent from several threads concurrently
+    std::mutex opened_ports_mutex_;
+
     mutable std::recursive_mutex input_channels_mutex_;
 
     std::vector<SharedMemChannelResource*> input_channels_;
@@ -232,8 +252,17 @@ protected:
 private:
 
     std::shared_ptr<SharedMemManager::Buffer> copy_to_shared_buffer(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const fastrtps::rtps::NetworkBuffer* buffers,
+            size_t buffer_count,
+            uint32_t total_bytes,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    bool send(
+            const fastrtps::rtps::NetworkBuffer* buffers,
+            size_t buffer_count,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
     bool send(
@@ -24,6 +24,8 @@ namespace rtps {
 static constexpr uint32_t shm_default_segment_size = 0;
 static constexpr uint32_t shm_default_port_queue_capacity = 512;
 static constexpr uint32_t shm_default_healthy_check_timeout_ms = 1000;
+static constexpr uint32_t shm_default_busy_poll_us = 0;
+static constexpr uint32_t shm_default_buffer_slab_size = 0;
 
 } // rtps
 } // fastdds
@@ -37,6 +39,9 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     , segment_size_(shm_default_segment_size)
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
+    , busy_poll_us_(shm_default_busy_poll_us)
+    , buffer_slab_size_(shm_default_buffer_slab_size)
+    , huge_pages_(false)
     , rtps_dump_file_("")
 {
     maxMessageSize = s_maximumMessageSize;
@@ -48,9 +53,13 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor(
     , segment_size_(t.segment_size_)
     , port_queue_capacity_(t.port_queue_capacity_)
     , healthy_check_timeout_ms_(t.healthy_check_timeout_ms_)
+    , busy_poll_us_(t.busy_poll_us_)
+    , buffer_slab_size_(t.buffer_slab_size_)
+    , huge_pages_(t.huge_pages_)
     , rtps_dump_file_(t.rtps_dump_file_)
 {
     maxMessageSize = t.max_message_size();
+    reception_threads = t.reception_threads;
 }
 
 #ifdef FASTDDS_SHM_TRANSPORT_DISABLED
@@ -18,6 +18,9 @@
 #include <thread>
 #include <condition_variable>
 #include <mutex>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <utils/threading.hpp>
 #include <unordered_set>
 #include <memory>
 
@@ -46,6 +49,19 @@ public:
         return watch_dog;
     }
 
+    /**
+     * Set the settings of the watchdog thread.
+     * The watchdog is shared by all the shared-memory transports of the process, so only the settings set before
+     * the watchdog is started are applied.
+     * @param settings Settings of the thread.
+     */
+    static void thread_settings(
+            const ThreadSettings& settings)
+    {
+        std::lock_guard<std::mutex> lock(thread_settings_mutex());
+        thread_settings_storage() = settings;
+    }
+
     /**
      * Add a new task to the tasks list
      * @param task Pointer to a singleton task
@@ -82,7 +98,7 @@ public:
 private:
 
     std::unordered_set<Task*> tasks_;
-    std::thread thread_run_;
+    eprosima::thread thread_run_;
 
     std::mutex running_tasks_mutex_;
     std::condition_variable wake_run_cv_;
@@ -95,7 +111,28 @@ private:
         : wake_run_(false)
         , exit_thread_(false)
     {
-        thread_run_ = std::thread(&SharedMemWatchdog::run, this);
+        ThreadSettings settings;
+        {
+            std::lock_guard<std::mutex> lock(thread_settings_mutex());
+            settings = thread_settings_storage();
+        }
+
+        thread_run_ = create_thread([this]()
+                        {
+                            run();
+                        }, settings, "dds.shm.wdog");
+    }
+
+    static std::mutex& thread_settings_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static ThreadSettings& thread_settings_storage()
+    {
+        static ThreadSettings settings;
+        return settings;
     }
 
     ~SharedMemWatchdog()
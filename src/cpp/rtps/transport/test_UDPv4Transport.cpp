@@ -24,6 +24,7 @@ namespace fastdds{
 namespace rtps{
 
 using octet = fastrtps::rtps::octet;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
 using Locator_t = fastrtps::rtps::Locator_t;
 using CDRMessage_t = fastrtps::rtps::CDRMessage_t;
 using SubmessageHeader_t = fastrtps::rtps::SubmessageHeader_t;
@@ -130,6 +131,21 @@ bool test_UDPv4Transport::send(
     return ret;
 }
 
+bool test_UDPv4Transport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    std::vector<octet> send_buffer(total_bytes);
+    fastrtps::rtps::copy_network_buffers(buffers.data(), buffers.size(), send_buffer.data());
+    return send(send_buffer.data(), total_bytes, socket, destination_locators_begin, destination_locators_end,
+                   only_multicast_purpose, max_blocking_time_point);
+}
+
 bool test_UDPv4Transport::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -2,6 +2,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <algorithm>
+#include <limits>
 
 using namespace std::chrono;
 
@@ -9,7 +10,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-using LivelinessDataIterator = ResourceLimitedVector<LivelinessData>::iterator;
+static constexpr size_t NOT_IN_HEAP = std::numeric_limits<size_t>::max();
 
 LivelinessManager::LivelinessManager(
         const LivelinessCallback& callback,
@@ -18,8 +19,8 @@ LivelinessManager::LivelinessManager(
     : callback_(callback)
     , manage_automatic_(manage_automatic)
     , writers_()
+    , alive_count_{{0, 0, 0}}
     , mutex_()
-    , timer_owner_(nullptr)
     , timer_(
         service,
         [this]() -> bool
@@ -33,7 +34,7 @@ LivelinessManager::LivelinessManager(
 LivelinessManager::~LivelinessManager()
 {
     std::unique_lock<std::mutex> lock(mutex_);
-    timer_owner_ = nullptr;
+    deadline_heap_.clear();
     timer_.cancel_timer();
 }
 
@@ -50,17 +51,16 @@ bool LivelinessManager::add_writer(
         return false;
     }
 
-    for (LivelinessData& writer : writers_)
+    size_t index;
+    if (find_writer(guid, kind, lease_duration, &index))
     {
-        if (writer.guid == guid &&
-                writer.kind == kind &&
-                writer.lease_duration == lease_duration)
-        {
-            writer.count++;
-            return true;
-        }
+        writers_[index].count++;
+        return true;
     }
+
     writers_.emplace_back(guid, kind, lease_duration);
+    heap_positions_.push_back(NOT_IN_HEAP);
+    writers_index_.emplace(guid, writers_.size() - 1);
     return true;
 }
 
@@ -71,57 +71,88 @@ bool LivelinessManager::remove_writer(
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    for (LivelinessData& writer: writers_)
+    size_t index;
+    if (!find_writer(guid, kind, lease_duration, &index))
     {
-        if (writer.guid == guid &&
-                writer.kind == kind &&
-                writer.lease_duration == lease_duration)
+        return false;
+    }
+
+    LivelinessData& writer = writers_[index];
+    if (--writer.count != 0)
+    {
+        return true;
+    }
+
+    bool was_timer_owner = !deadline_heap_.empty() && deadline_heap_.front() == index;
+    LivelinessData::WriterStatus status = writer.status;
+    if (status == LivelinessData::WriterStatus::ALIVE)
+    {
+        set_writer_not_alive(index);
+    }
+
+    // Move the last writer to the position of the removed one, so only its references need to be updated
+    size_t last = writers_.size() - 1;
+    auto range = writers_index_.equal_range(guid);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == index)
+        {
+            writers_index_.erase(it);
+            break;
+        }
+    }
+    if (index != last)
+    {
+        range = writers_index_.equal_range(writers_[last].guid);
+        for (auto it = range.first; it != range.second; ++it)
         {
-            if (--writer.count == 0)
+            if (it->second == last)
             {
-                writers_.remove(writer);
-
-                if (callback_ != nullptr)
-                {
-                    if (writer.status == LivelinessData::WriterStatus::ALIVE)
-                    {
-                        callback_(writer.guid,
-                                writer.kind,
-                                writer.lease_duration,
-                                -1,
-                                0);
-                    }
-                    else if (writer.status == LivelinessData::WriterStatus::NOT_ALIVE)
-                    {
-                        callback_(writer.guid,
-                                writer.kind,
-                                writer.lease_duration,
-                                0,
-                                -1);
-                    }
-                }
-
-                if (timer_owner_ != nullptr && timer_owner_->guid == guid)
-                {
-                    timer_owner_ = nullptr;
-                    if (!calculate_next())
-                    {
-                        timer_.cancel_timer();
-                        return true;
-                    }
-
-                    // Some times the interval could be negative if a writer expired during the call to this function
-                    // Once in this situation there is not much we can do but let asio timers expire inmediately
-                    auto interval = timer_owner_->time - steady_clock::now();
-                    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-                    timer_.restart_timer();
-                }
-                return true;
+                it->second = index;
+                break;
             }
         }
+        writers_[index] = writers_[last];
+        heap_positions_[index] = heap_positions_[last];
+        if (heap_positions_[index] != NOT_IN_HEAP)
+        {
+            deadline_heap_[heap_positions_[index]] = index;
+        }
     }
+    writers_.pop_back();
+    heap_positions_.pop_back();
 
-    return false;
+    if (callback_ != nullptr)
+    {
+        if (status == LivelinessData::WriterStatus::ALIVE)
+        {
+            callback_(guid,
+                    kind,
+                    lease_duration,
+                    -1,
+                    0);
+        }
+        else if (status == LivelinessData::WriterStatus::NOT_ALIVE)
+        {
+            callback_(guid,
+                    kind,
+                    lease_duration,
+                    0,
+                    -1);
+        }
+    }
+
+    if (was_timer_owner)
+    {
+        if (!calculate_next())
+        {
+            timer_.cancel_timer();
+            return true;
+        }
+
+        restart_timer();
+    }
+    return true;
 }
 
 bool LivelinessManager::assert_liveliness(
@@ -131,32 +162,32 @@ bool LivelinessManager::assert_liveliness(
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    ResourceLimitedVector<LivelinessData>::iterator wit;
+    size_t index;
     if (!find_writer(
                 guid,
                 kind,
                 lease_duration,
-                &wit))
+                &index))
     {
         return false;
     }
 
     timer_.cancel_timer();
 
-    if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
-            wit->kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+    if (kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
+            kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
     {
-        for (LivelinessData& w: writers_)
+        for (size_t i = 0; i < writers_.size(); ++i)
         {
-            if (w.kind == wit->kind)
+            if (writers_[i].kind == kind)
             {
-                assert_writer_liveliness(w);
+                assert_writer_liveliness(i);
             }
         }
     }
-    else if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    else if (kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
     {
-        assert_writer_liveliness(*wit);
+        assert_writer_liveliness(index);
     }
 
     // Updates the timer owner
@@ -166,11 +197,7 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
+    restart_timer();
 
     return true;
 }
@@ -193,11 +220,11 @@ bool LivelinessManager::assert_liveliness(
 
     timer_.cancel_timer();
 
-    for (LivelinessData& writer: writers_)
+    for (size_t i = 0; i < writers_.size(); ++i)
     {
-        if (writer.kind == kind)
+        if (writers_[i].kind == kind)
         {
-            assert_writer_liveliness(writer);
+            assert_writer_liveliness(i);
         }
     }
 
@@ -210,65 +237,59 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
+    restart_timer();
 
     return true;
 }
 
 bool LivelinessManager::calculate_next()
 {
+    return !deadline_heap_.empty();
+}
 
-    timer_owner_ = nullptr;
-
-    steady_clock::time_point min_time = steady_clock::now() + nanoseconds(c_TimeInfinite.to_ns());
-
-    bool any_alive = false;
-
-    for (LivelinessDataIterator it=writers_.begin(); it!=writers_.end(); ++it)
-    {
-        if (it->status == LivelinessData::WriterStatus::ALIVE)
-        {
-            if (it->time < min_time)
-            {
-                min_time = it->time;
-                timer_owner_ = &*it;
-            }
-            any_alive = true;
-        }
-    }
-    return any_alive;
+void LivelinessManager::restart_timer()
+{
+    // Some times the interval could be negative if a writer expired during the call to this function
+    // Once in this situation there is not much we can do but let asio timers expire inmediately
+    auto interval = writers_[deadline_heap_.front()].time - steady_clock::now();
+    timer_.update_interval_millisec(duration<double, std::milli>(interval).count());
+    timer_.restart_timer();
 }
 
 bool LivelinessManager::timer_expired()
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    if (timer_owner_ == nullptr)
+    if (!calculate_next())
     {
         logError(RTPS_WRITER, "Liveliness timer expired but there is no writer");
         return false;
     }
 
-    if (callback_ != nullptr)
+    // Every writer whose lease has already elapsed loses its liveliness. The timer owner always does, as the timer
+    // was programmed for it.
+    steady_clock::time_point now = steady_clock::now();
+    do
     {
-        callback_(timer_owner_->guid,
-                timer_owner_->kind,
-                timer_owner_->lease_duration,
-                -1,
-                1);
-    }
-    timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
+        size_t index = deadline_heap_.front();
+        LivelinessData& writer = writers_[index];
+        if (callback_ != nullptr)
+        {
+            callback_(writer.guid,
+                    writer.kind,
+                    writer.lease_duration,
+                    -1,
+                    1);
+        }
+        set_writer_not_alive(index);
+    } while (calculate_next() && writers_[deadline_heap_.front()].time <= now);
 
     if (calculate_next())
     {
         // Some times the interval could be negative if a writer expired during the call to this function
         // Once in this situation there is not much we can do but let asio timers expire inmediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+        auto interval = writers_[deadline_heap_.front()].time - steady_clock::now();
+        timer_.update_interval_millisec(duration<double, std::milli>(interval).count());
         return true;
     }
 
@@ -279,15 +300,16 @@ bool LivelinessManager::find_writer(
         const GUID_t& guid,
         const LivelinessQosPolicyKind& kind,
         const Duration_t& lease_duration,
-        ResourceLimitedVector<LivelinessData>::iterator* wit_out)
+        size_t* index_out)
 {
-    for (LivelinessDataIterator it=writers_.begin(); it!=writers_.end(); ++it)
+    auto range = writers_index_.equal_range(guid);
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (it->guid == guid &&
-                it->kind == kind &&
-                it->lease_duration == lease_duration)
+        const LivelinessData& writer = writers_[it->second];
+        if (writer.kind == kind &&
+                writer.lease_duration == lease_duration)
         {
-            *wit_out = it;
+            *index_out = it->second;
             return true;
         }
     }
@@ -299,19 +321,14 @@ bool LivelinessManager::is_any_alive(
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    for (const auto& writer : writers_)
-    {
-        if (writer.kind == kind && writer.status == LivelinessData::WriterStatus::ALIVE)
-        {
-            return true;
-        }
-    }
-    return false;
+    return alive_count_[kind] > 0;
 }
 
 void LivelinessManager::assert_writer_liveliness(
-        LivelinessData& writer)
+        size_t index)
 {
+    LivelinessData& writer = writers_[index];
+
     if (callback_ != nullptr)
     {
         if (writer.status == LivelinessData::WriterStatus::NOT_ASSERTED)
@@ -332,8 +349,105 @@ void LivelinessManager::assert_writer_liveliness(
         }
     }
 
-    writer.status = LivelinessData::WriterStatus::ALIVE;
     writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
+    if (writer.status == LivelinessData::WriterStatus::ALIVE)
+    {
+        heap_update(heap_positions_[index]);
+    }
+    else
+    {
+        writer.status = LivelinessData::WriterStatus::ALIVE;
+        ++alive_count_[writer.kind];
+        heap_push(index);
+    }
+}
+
+void LivelinessManager::set_writer_not_alive(
+        size_t index)
+{
+    writers_[index].status = LivelinessData::WriterStatus::NOT_ALIVE;
+    --alive_count_[writers_[index].kind];
+    heap_remove(index);
+}
+
+void LivelinessManager::heap_push(
+        size_t index)
+{
+    heap_positions_[index] = deadline_heap_.size();
+    deadline_heap_.push_back(index);
+    heap_update(deadline_heap_.size() - 1);
+}
+
+void LivelinessManager::heap_remove(
+        size_t index)
+{
+    size_t pos = heap_positions_[index];
+    size_t last = deadline_heap_.size() - 1;
+    if (pos != last)
+    {
+        heap_swap(pos, last);
+    }
+    deadline_heap_.pop_back();
+    heap_positions_[index] = NOT_IN_HEAP;
+    if (pos < deadline_heap_.size())
+    {
+        heap_update(pos);
+    }
+}
+
+void LivelinessManager::heap_update(
+        size_t heap_pos)
+{
+    // Sift up
+    while (heap_pos > 0)
+    {
+        size_t parent = (heap_pos - 1) / 2;
+        if (!heap_less(heap_pos, parent))
+        {
+            break;
+        }
+        heap_swap(heap_pos, parent);
+        heap_pos = parent;
+    }
+
+    // Sift down
+    size_t size = deadline_heap_.size();
+    while (true)
+    {
+        size_t smallest = heap_pos;
+        size_t left = 2 * heap_pos + 1;
+        size_t right = left + 1;
+        if (left < size && heap_less(left, smallest))
+        {
+            smallest = left;
+        }
+        if (right < size && heap_less(right, smallest))
+        {
+            smallest = right;
+        }
+        if (smallest == heap_pos)
+        {
+            break;
+        }
+        heap_swap(heap_pos, smallest);
+        heap_pos = smallest;
+    }
+}
+
+void LivelinessManager::heap_swap(
+        size_t a,
+        size_t b)
+{
+    std::swap(deadline_heap_[a], deadline_heap_[b]);
+    heap_positions_[deadline_heap_[a]] = a;
+    heap_positions_[deadline_heap_[b]] = b;
+}
+
+bool LivelinessManager::heap_less(
+        size_t a,
+        size_t b) const
+{
+    return writers_[deadline_heap_[a]].time < writers_[deadline_heap_[b]].time;
 }
 
 const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
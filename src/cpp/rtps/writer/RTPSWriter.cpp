@@ -20,9 +20,12 @@
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/flowcontrol/FlowController.h>
+#include <fastrtps/utils/TimeConversion.h>
 
 #include <mutex>
 
@@ -42,6 +45,10 @@ RTPSWriter::RTPSWriter(
     , mp_listener(listen)
     , is_async_(att.mode == SYNCHRONOUS_WRITER ? false : true)
     , m_separateSendingEnabled(false)
+    , batching_(att.batching)
+    , batched_samples_(0)
+    , batched_bytes_(0)
+    , batch_flush_event_(nullptr)
     , locator_selector_(att.matched_readers_allocation)
     , all_remote_readers_(att.matched_readers_allocation)
     , all_remote_participants_(att.matched_readers_allocation)
@@ -52,6 +59,42 @@ RTPSWriter::RTPSWriter(
 {
     mp_history->mp_writer = this;
     mp_history->mp_mutex = &mp_mutex;
+
+    if (batching_.enabled)
+    {
+        if (is_async_)
+        {
+            // The asynchronous thread already sends all the pending samples together.
+            logWarning(RTPS_WRITER, "Batching is ignored on asynchronous writer " << guid);
+            batching_.enabled = false;
+        }
+        else
+        {
+            // A flush sends at most this amount of bytes without flow controllers, so a bigger batch would be
+            // partially kept until the next one is sent.
+            static constexpr uint32_t max_batch_bytes = RTPSMessageGroup::get_max_fragment_payload_size();
+            if (batching_.max_bytes == 0 || batching_.max_bytes > max_batch_bytes)
+            {
+                logInfo(RTPS_WRITER, "Batching max_bytes limited to " << max_batch_bytes << " on writer " << guid);
+                batching_.max_bytes = max_batch_bytes;
+            }
+
+            if (batching_.max_flush_delay != c_TimeInfinite)
+            {
+                batch_flush_event_ = new TimedEvent(impl->getEventResource(), [&]() -> bool
+                                {
+                                    flush_batch();
+                                    return false;
+                                },
+                                TimeConv::Duration_t2MilliSecondsDouble(batching_.max_flush_delay));
+            }
+        }
+    }
+
+#if HAVE_FASTDDS_STATISTICS
+    statistics_ = mp_RTPSParticipant->statistics_registry().register_entity(
+        guid, fastdds::statistics::StatisticsEntityKind::WRITER);
+#endif
     logInfo(RTPS_WRITER, "RTPSWriter created");
 }
 
@@ -63,6 +106,10 @@ RTPSWriter::~RTPSWriter()
 
     mp_history->mp_writer = nullptr;
     mp_history->mp_mutex = nullptr;
+
+#if HAVE_FASTDDS_STATISTICS
+    mp_RTPSParticipant->statistics_registry().unregister_entity(statistics_);
+#endif
 }
 
 CacheChange_t* RTPSWriter::new_change(
@@ -89,6 +136,50 @@ CacheChange_t* RTPSWriter::new_change(
     return ch;
 }
 
+void RTPSWriter::flush_batch()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    flush_batch_nts();
+}
+
+void RTPSWriter::add_to_batch_nts(
+        const CacheChange_t* change)
+{
+    ++batched_samples_;
+    batched_bytes_ += change->serializedPayload.length;
+
+    // Fragmented samples fill the messages on their own, so there is nothing to gain waiting for more.
+    bool is_full = (change->getFragmentCount() > 0) ||
+            (batching_.max_samples > 0 && batched_samples_ >= batching_.max_samples) ||
+            (batched_bytes_ >= batching_.max_bytes);
+
+    if (is_full)
+    {
+        flush_batch_nts();
+    }
+    else if (batched_samples_ == 1 && batch_flush_event_ != nullptr)
+    {
+        batch_flush_event_->restart_timer();
+    }
+}
+
+void RTPSWriter::flush_batch_nts()
+{
+    if (batched_samples_ == 0)
+    {
+        return;
+    }
+
+    batched_samples_ = 0;
+    batched_bytes_ = 0;
+    if (batch_flush_event_ != nullptr)
+    {
+        batch_flush_event_->cancel_timer();
+    }
+
+    send_any_unsent_changes();
+}
+
 SequenceNumber_t RTPSWriter::get_seq_num_min()
 {
     CacheChange_t* change;
@@ -229,12 +320,14 @@ const std::vector<GUID_t>& RTPSWriter::remote_guids() const
 
 bool RTPSWriter::send(
         CDRMessage_t* message,
+        const std::vector<NetworkBuffer>& buffers,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     RTPSParticipantImpl* participant = getRTPSParticipant();
 
     return locator_selector_.selected_size() == 0 ||
-           participant->sendSync(message, locator_selector_.begin(), locator_selector_.end(), max_blocking_time_point);
+           participant->sendSync(message, buffers, locator_selector_.begin(), locator_selector_.end(),
+                   max_blocking_time_point);
 }
 
 const LivelinessQosPolicyKind& RTPSWriter::get_liveliness_kind() const
@@ -0,0 +1,119 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderLocatorCluster.cpp
+ */
+
+#include <fastdds/rtps/writer/ReaderLocatorCluster.h>
+#include <fastdds/rtps/writer/ReaderLocator.h>
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+ReaderLocatorCluster::ReaderLocatorCluster(
+        RTPSParticipantImpl* participant,
+        const ResourceLimitedVector<Locator_t>& destinations)
+    : participant_(participant)
+    , destinations_(destinations.begin(), destinations.end())
+{
+}
+
+const ResourceLimitedVector<Locator_t>& ReaderLocatorCluster::destinations_of(
+        ReaderLocator& reader)
+{
+    const LocatorSelectorEntry* entry = reader.locator_selector_entry();
+    return entry->unicast.empty() ? entry->multicast : entry->unicast;
+}
+
+void ReaderLocatorCluster::build_clusters(
+        RTPSParticipantImpl* participant,
+        ResourceLimitedVector<ReaderLocator>& readers,
+        std::vector<ReaderLocatorCluster>& clusters)
+{
+    clusters.clear();
+
+    for (ReaderLocator& reader : readers)
+    {
+        if (reader.remote_guid() == c_Guid_Unknown || reader.is_local_reader())
+        {
+            continue;
+        }
+
+        const ResourceLimitedVector<Locator_t>& destinations = destinations_of(reader);
+        auto it = std::find_if(clusters.begin(), clusters.end(),
+                        [&destinations](const ReaderLocatorCluster& cluster)
+                        {
+                            return cluster.has_destinations(destinations);
+                        });
+        if (it == clusters.end())
+        {
+            clusters.emplace_back(participant, destinations);
+            it = clusters.end() - 1;
+        }
+        it->add_reader(reader.remote_guid());
+    }
+}
+
+bool ReaderLocatorCluster::has_destinations(
+        const ResourceLimitedVector<Locator_t>& destinations) const
+{
+    if (destinations.size() != destinations_.size())
+    {
+        return false;
+    }
+
+    for (const Locator_t& locator : destinations)
+    {
+        if (std::find(destinations_.begin(), destinations_.end(), locator) == destinations_.end())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ReaderLocatorCluster::add_reader(
+        const GUID_t& remote_guid)
+{
+    guids_.push_back(remote_guid);
+    if (std::find(guid_prefixes_.begin(), guid_prefixes_.end(), remote_guid.guidPrefix) == guid_prefixes_.end())
+    {
+        guid_prefixes_.push_back(remote_guid.guidPrefix);
+    }
+}
+
+bool ReaderLocatorCluster::send(
+        CDRMessage_t* message,
+        const std::vector<NetworkBuffer>& buffers,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    if (destinations_.empty())
+    {
+        return true;
+    }
+
+    return participant_->sendSync(message, buffers, Locators(destinations_.begin()),
+                   Locators(destinations_.end()), max_blocking_time_point);
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
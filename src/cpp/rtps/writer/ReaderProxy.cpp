@@ -146,6 +146,7 @@ void ReaderProxy::stop()
 {
     locator_info_.stop(guid());
     is_active_ = false;
+    datasharing_notification_.reset();
     disable_timers();
 
     changes_for_reader_.clear();
@@ -483,9 +484,26 @@ bool ReaderProxy::perform_nack_supression()
     return convert_status_on_all_changes(UNDERWAY, UNACKNOWLEDGED);
 }
 
-bool ReaderProxy::perform_acknack_response()
+bool ReaderProxy::perform_acknack_response(
+        std::vector<SequenceNumber_t>* requested_changes)
 {
-    return convert_status_on_all_changes(REQUESTED, UNSENT);
+    if (requested_changes == nullptr)
+    {
+        return convert_status_on_all_changes(REQUESTED, UNSENT);
+    }
+
+    bool at_least_one_modified = false;
+    for (ChangeForReader_t& change : changes_for_reader_)
+    {
+        if (change.getStatus() == REQUESTED)
+        {
+            at_least_one_modified = true;
+            change.setStatus(UNSENT);
+            requested_changes->push_back(change.getSequenceNumber());
+        }
+    }
+
+    return at_least_one_modified;
 }
 
 bool ReaderProxy::convert_status_on_all_changes(
@@ -20,6 +20,7 @@
 #include <fastdds/rtps/writer/StatefulWriter.h>
 #include <fastdds/rtps/writer/WriterListener.h>
 #include <fastdds/rtps/writer/ReaderProxy.h>
+#include <fastdds/rtps/writer/ReaderLocatorCluster.h>
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -43,7 +44,14 @@
 #include <rtps/writer/RTPSWriterCollector.h>
 #include "rtps/RTPSDomainImpl.hpp"
 #include "rtps/messages/RTPSGapBuilder.hpp"
+#include <statistics/StatisticsProbes.hpp>
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+#include <rtps/DataSharing/DataSharingRing.hpp>
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
+#include <algorithm>
 #include <mutex>
 #include <vector>
 #include <stdexcept>
@@ -119,6 +127,10 @@ StatefulWriter::StatefulWriter(
     , all_acked_(false)
     , may_remove_change_cond_()
     , may_remove_change_(0)
+    , adaptive_reliability_(att.adaptive_reliability)
+    , heartbeat_period_ms_(TimeConv::Time_t2MilliSecondsDouble(att.times.heartbeatPeriod))
+    , nack_response_pending_(false)
+    , nacks_in_window_(0)
     , disable_heartbeat_piggyback_(att.disable_heartbeat_piggyback)
     , disable_positive_acks_(att.disable_positive_acks)
     , keep_duration_us_(att.keep_duration.to_ns() * 1e-3)
@@ -140,8 +152,7 @@ StatefulWriter::StatefulWriter(
 
     nack_response_event_ = new TimedEvent(pimpl->getEventResource(), [&]() -> bool
                     {
-                        perform_nack_response();
-                        return false;
+                        return perform_nack_response();
                     },
                     TimeConv::Time_t2MilliSecondsDouble(m_times.nackResponseDelay));
 
@@ -158,6 +169,32 @@ StatefulWriter::StatefulWriter(
     {
         matched_readers_pool_.push_back(new ReaderProxy(m_times, part_att.allocation.locators, this));
     }
+
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#if HAVE_SECURITY
+    // Samples on the ring are not protected by the crypto plugin.
+    if (att.endpoint.data_sharing && pimpl->security_attributes().is_rtps_protected)
+    {
+        logInfo(RTPS_WRITER, "Data-sharing disabled on writer " << guid << ", as RTPS messages are protected");
+    }
+    else
+#endif // if HAVE_SECURITY
+    if (att.endpoint.data_sharing)
+    {
+        // Every change on the history should fit on the ring, so its size should be limited.
+        const HistoryAttributes& history_att = hist->m_att;
+        if (history_att.maximumReservedCaches > 0)
+        {
+            datasharing_ring_ = DataSharingRing::create(guid,
+                            static_cast<uint32_t>(history_att.maximumReservedCaches),
+                            history_att.payloadMaxSize).release();
+        }
+        else
+        {
+            logWarning(RTPS_WRITER, "Data-sharing needs a limited history size. Disabled on writer " << guid);
+        }
+    }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 }
 
 StatefulWriter::~StatefulWriter()
@@ -181,6 +218,12 @@ StatefulWriter::~StatefulWriter()
         nack_response_event_ = nullptr;
     }
 
+    if (batch_flush_event_ != nullptr)
+    {
+        delete(batch_flush_event_);
+        batch_flush_event_ = nullptr;
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -212,6 +255,10 @@ StatefulWriter::~StatefulWriter()
         delete(remote_reader);
     }
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    delete(datasharing_ring_);
+    datasharing_ring_ = nullptr;
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 }
 
 /*
@@ -234,7 +281,7 @@ void StatefulWriter::unsent_change_added_to_history(
 
     if (!matched_readers_.empty())
     {
-        if (!isAsync())
+        if (!isAsync() && !batching_.enabled)
         {
             //TODO(Ricardo) Temporal.
             bool expectsInlineQos = false;
@@ -267,14 +314,33 @@ void StatefulWriter::unsent_change_added_to_history(
                 expectsInlineQos |= it->expects_inline_qos();
             }
 
+            // Readers using data-sharing take the change from the ring. If it could not be stored there, they will
+            // receive it through the network as any other remote reader.
+            bool datasharing_delivered = m_pushMode && there_are_datasharing_readers_ && datasharing_write_nts(change);
+            if (datasharing_delivered)
+            {
+                datasharing_notify_nts();
+            }
+
             try
             {
                 //At this point we are sure all information was stored. We now can send data.
                 if (!m_separateSendingEnabled)
                 {
-                    if (locator_selector_.selected_size() > 0)
+                    // When the change is on the ring, it is only sent to the readers not using data-sharing.
+                    const RTPSMessageSenderInterface* sender = this;
+                    bool send_to_network = locator_selector_.selected_size() > 0;
+                    size_t number_of_readers = all_remote_readers_.size();
+                    if (datasharing_delivered)
                     {
-                        RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
+                        sender = network_readers_.get();
+                        send_to_network = network_readers_->size() > 0;
+                        number_of_readers = network_readers_->size();
+                    }
+
+                    if (send_to_network)
+                    {
+                        RTPSMessageGroup group(mp_RTPSParticipant, this, *sender, max_blocking_time);
 
                         auto sent_fun = [this, change](
                             FragmentNumber_t frag)
@@ -283,7 +349,7 @@ void StatefulWriter::unsent_change_added_to_history(
                                     {
                                         for (ReaderProxy* it : matched_readers_)
                                         {
-                                            if (!it->is_local_reader())
+                                            if (!it->is_local_reader() && !it->is_datasharing_reader())
                                             {
                                                 bool allFragmentsSent = false;
                                                 it->mark_fragment_as_sent_for_change(
@@ -296,7 +362,7 @@ void StatefulWriter::unsent_change_added_to_history(
                                 };
 
                         send_data_or_fragments(group, change, expectsInlineQos, sent_fun);
-                        send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_);
+                        send_heartbeat_nts_(number_of_readers, group, disable_positive_acks_);
                     }
 
                     for (ReaderProxy* it : matched_readers_)
@@ -325,7 +391,7 @@ void StatefulWriter::unsent_change_added_to_history(
                                 delivered ? ACKNOWLEDGED : UNDERWAY,
                                 false);
                         }
-                        else
+                        else if (!datasharing_delivered || !it->is_datasharing_reader())
                         {
                             RTPSMessageGroup group(mp_RTPSParticipant, this, it->message_sender(),
                                     max_blocking_time);
@@ -369,11 +435,18 @@ void StatefulWriter::unsent_change_added_to_history(
         }
         else
         {
+            // Readers using data-sharing do not wait for the asynchronous thread.
+            bool datasharing_delivered = m_pushMode && there_are_datasharing_readers_ && datasharing_write_nts(change);
+
             for (ReaderProxy* it : matched_readers_)
             {
                 ChangeForReader_t changeForReader(change);
 
-                if (m_pushMode)
+                if (datasharing_delivered && it->is_datasharing_reader())
+                {
+                    changeForReader.setStatus(it->is_reliable() ? UNDERWAY : ACKNOWLEDGED);
+                }
+                else if (m_pushMode)
                 {
                     changeForReader.setStatus(UNSENT);
                 }
@@ -385,9 +458,22 @@ void StatefulWriter::unsent_change_added_to_history(
                 it->add_change(changeForReader, false, max_blocking_time);
             }
 
+            if (datasharing_delivered)
+            {
+                datasharing_notify_nts();
+                periodic_hb_event_->restart_timer(max_blocking_time);
+            }
+
             if (m_pushMode)
             {
-                mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+                if (batching_.enabled)
+                {
+                    add_to_batch_nts(change);
+                }
+                else
+                {
+                    mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+                }
             }
         }
 
@@ -1174,6 +1260,70 @@ void StatefulWriter::select_all_readers_with_lowmark_below(
     }
 }
 
+bool StatefulWriter::datasharing_write_nts(
+        CacheChange_t* change)
+{
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    if (datasharing_ring_ != nullptr)
+    {
+        return datasharing_ring_->write(*change);
+    }
+#else
+    (void)change;
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
+    return false;
+}
+
+void StatefulWriter::datasharing_notify_nts()
+{
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    for (ReaderProxy* it : matched_readers_)
+    {
+        if (it->is_datasharing_reader())
+        {
+            it->datasharing_notification()->notify();
+        }
+    }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+}
+
+void StatefulWriter::update_network_readers_nts()
+{
+    network_readers_.reset();
+    if (!there_are_datasharing_readers_)
+    {
+        return;
+    }
+
+    locator_selector_.reset(false);
+    for (ReaderProxy* it : matched_readers_)
+    {
+        if (!it->is_local_reader() && !it->is_datasharing_reader())
+        {
+            locator_selector_.enable(it->guid());
+        }
+    }
+    getRTPSParticipant()->network_factory().select_locators(locator_selector_);
+
+    ResourceLimitedVector<Locator_t> destinations;
+    locator_selector_.for_each([&destinations](const Locator_t& locator)
+            {
+                destinations.push_back(locator);
+            });
+    network_readers_.reset(new ReaderLocatorCluster(mp_RTPSParticipant, destinations));
+    for (ReaderProxy* it : matched_readers_)
+    {
+        if (!it->is_local_reader() && !it->is_datasharing_reader())
+        {
+            network_readers_->add_reader(it->guid());
+        }
+    }
+
+    // Restore the selection of every remote reader.
+    update_cached_info_nts();
+}
+
 /*
  * MATCHED_READER-RELATED METHODS
  */
@@ -1210,6 +1360,14 @@ void StatefulWriter::update_reader_info(
         bool is_local = matched_readers_.at(i)->is_local_reader();
         there_are_local_readers_ |= is_local;
     }
+
+    there_are_datasharing_readers_ = false;
+    for (i = 0; i < n_readers && !there_are_datasharing_readers_; ++i)
+    {
+        there_are_datasharing_readers_ |= matched_readers_.at(i)->is_datasharing_reader();
+    }
+
+    update_network_readers_nts();
 }
 
 bool StatefulWriter::matched_reader_add(
@@ -1262,6 +1420,39 @@ bool StatefulWriter::matched_reader_add(
 
     // Add info of new datareader.
     rp->start(rdata);
+
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#if HAVE_SECURITY
+    // The security attributes of the writer are only known once it has been registered on the security plugins,
+    // so a ring of a writer that should be protected is discarded on its first match.
+    if (datasharing_ring_ != nullptr &&
+            !DataSharingRing::is_allowed(mp_RTPSParticipant->security_attributes(),
+            getAttributes().security_attributes(), 0))
+    {
+        logInfo(RTPS_WRITER, "Data-sharing disabled on protected writer " << m_guid);
+        delete(datasharing_ring_);
+        datasharing_ring_ = nullptr;
+    }
+#endif // if HAVE_SECURITY
+
+    // Readers on the same host are notified of the changes on the ring, if they are also using data-sharing.
+    if (datasharing_ring_ != nullptr && !rp->is_local_reader() && m_guid.is_on_same_host_as(rdata.guid())
+#if HAVE_SECURITY
+            && DataSharingRing::is_allowed(mp_RTPSParticipant->security_attributes(),
+            getAttributes().security_attributes(), rdata.security_attributes_)
+#endif // if HAVE_SECURITY
+            )
+    {
+        rp->datasharing_notification(DataSharingNotification::open(rdata.guid()));
+        // Best-effort changes written from now on until the reader opens the ring are not repaired, so that reader
+        // may lose them.
+        if (rp->is_datasharing_reader())
+        {
+            logInfo(RTPS_WRITER, "Using data-sharing with reader " << rdata.guid());
+        }
+    }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
     locator_selector_.add_entry(rp->locator_selector_entry());
     matched_readers_.push_back(rp);
     update_reader_info(true);
@@ -1523,6 +1714,10 @@ bool StatefulWriter::wait_for_all_acked(
         const Duration_t& max_wait)
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+
+    // Samples waiting on the batch could not be acknowledged until it is sent.
+    flush_batch_nts();
+
     std::unique_lock<std::mutex> all_acked_lock(all_acked_mutex_);
 
     all_acked_ = std::none_of(matched_readers_.begin(), matched_readers_.end(),
@@ -1635,6 +1830,11 @@ void StatefulWriter::check_acked_status()
         min_readers_low_mark_ = min_low_mark;
     }
 
+    if (adaptive_reliability_.enabled)
+    {
+        update_heartbeat_period_nts();
+    }
+
     if (all_acked)
     {
         std::unique_lock<std::mutex> all_acked_lock(all_acked_mutex_);
@@ -1698,6 +1898,10 @@ bool StatefulWriter::try_remove_change(
 void StatefulWriter::updateAttributes(
         const WriterAttributes& att)
 {
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+        adaptive_reliability_ = att.adaptive_reliability;
+    }
     this->updateTimes(att.times);
 }
 
@@ -1708,6 +1912,7 @@ void StatefulWriter::updateTimes(
     if (m_times.heartbeatPeriod != times.heartbeatPeriod)
     {
         periodic_hb_event_->update_interval(times.heartbeatPeriod);
+        heartbeat_period_ms_ = TimeConv::Time_t2MilliSecondsDouble(times.heartbeatPeriod);
     }
     if (m_times.nackResponseDelay != times.nackResponseDelay)
     {
@@ -1728,6 +1933,9 @@ void StatefulWriter::updateTimes(
         }
     }
     m_times = times;
+
+    // Recompute the heartbeat period for the new base period, or restore it if adaptive reliability was disabled
+    update_heartbeat_period_nts();
 }
 
 void StatefulWriter::add_flow_controller(
@@ -1741,6 +1949,47 @@ SequenceNumber_t StatefulWriter::next_sequence_number() const
     return mp_history->next_sequence_number();
 }
 
+StatefulWriter::RepairStatistics StatefulWriter::get_repair_statistics() const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    RepairStatistics ret_val = repair_statistics_;
+    ret_val.heartbeat_period_ms = heartbeat_period_ms_;
+    return ret_val;
+}
+
+void StatefulWriter::update_heartbeat_period_nts()
+{
+    double period_ms = TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod);
+
+    if (adaptive_reliability_.enabled)
+    {
+        double min_period_ms = TimeConv::Time_t2MilliSecondsDouble(adaptive_reliability_.min_heartbeat_period);
+        SequenceNumber_t last_seq = get_seq_num_max();
+        if (min_period_ms < period_ms && last_seq != c_SequenceNumber_Unknown && min_readers_low_mark_ < last_seq)
+        {
+            // Number of changes on the history not acknowledged by all the readers
+            uint64_t backlog = last_seq.to64long() - min_readers_low_mark_.to64long();
+            backlog = std::min(backlog, static_cast<uint64_t>(mp_history->getHistorySize()));
+
+            uint32_t threshold = std::max(adaptive_reliability_.backlog_threshold, 1u);
+            if (backlog >= threshold)
+            {
+                period_ms = min_period_ms;
+            }
+            else
+            {
+                period_ms -= (period_ms - min_period_ms) * static_cast<double>(backlog) / threshold;
+            }
+        }
+    }
+
+    if (period_ms != heartbeat_period_ms_)
+    {
+        heartbeat_period_ms_ = period_ms;
+        periodic_hb_event_->update_interval_millisec(period_ms);
+    }
+}
+
 bool StatefulWriter::send_periodic_heartbeat(
         bool final,
         bool liveliness)
@@ -1878,6 +2127,7 @@ void StatefulWriter::send_heartbeat_nts_(
 
     incrementHBCount();
     message_group.add_heartbeat(firstSeq, lastSeq, m_heartbeatCount, final, liveliness);
+    ++repair_statistics_.heartbeats_sent;
     // Update calculate of heartbeat piggyback.
     currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
 
@@ -1919,23 +2169,67 @@ void StatefulWriter::send_heartbeat_piggyback_nts_(
     }
 }
 
-void StatefulWriter::perform_nack_response()
+void StatefulWriter::schedule_nack_response_nts()
+{
+    ++repair_statistics_.nacks_received;
+
+    if (nack_response_pending_)
+    {
+        // The pending response will also serve this NACK
+        ++nacks_in_window_;
+        ++repair_statistics_.nacks_aggregated;
+    }
+    else
+    {
+        nack_response_pending_ = true;
+        nack_window_start_ = std::chrono::steady_clock::now();
+        nacks_in_window_ = 0;
+        nack_response_event_->restart_timer();
+    }
+}
+
+bool StatefulWriter::perform_nack_response()
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+
+    if (adaptive_reliability_.enabled && nacks_in_window_ > 0)
+    {
+        // Other readers are still reporting losses. Wait for them, so each change is repaired once for all.
+        auto max_window = std::chrono::microseconds(
+            TimeConv::Duration_t2MicroSecondsInt64(adaptive_reliability_.max_nack_aggregation));
+        if (std::chrono::steady_clock::now() - nack_window_start_ < max_window)
+        {
+            nacks_in_window_ = 0;
+            return true;
+        }
+    }
+
+    nack_response_pending_ = false;
+    nacks_in_window_ = 0;
+    ++repair_statistics_.nack_responses;
+
     bool must_wake_up_async_thread = false;
+    repaired_sequence_numbers_.clear();
 
     for (ReaderProxy* remote_reader : matched_readers_)
     {
-        if (remote_reader->perform_acknack_response() || remote_reader->are_there_gaps())
+        if (remote_reader->perform_acknack_response(&repaired_sequence_numbers_) || remote_reader->are_there_gaps())
         {
             must_wake_up_async_thread = true;
         }
     }
 
+    repair_statistics_.requested_changes += repaired_sequence_numbers_.size();
+    std::sort(repaired_sequence_numbers_.begin(), repaired_sequence_numbers_.end());
+    repair_statistics_.repaired_changes += std::distance(repaired_sequence_numbers_.begin(),
+                    std::unique(repaired_sequence_numbers_.begin(), repaired_sequence_numbers_.end()));
+
     if (must_wake_up_async_thread)
     {
         mp_RTPSParticipant->async_thread().wake_up(this);
     }
+
+    return false;
 }
 
 void StatefulWriter::perform_nack_supression(
@@ -1972,13 +2266,23 @@ bool StatefulWriter::process_acknack(
             {
                 if (remote_reader->check_and_set_acknack_count(ack_count))
                 {
+                    FASTDDS_STATISTICS_ADD(statistics_, ACKNACKS_RECEIVED, 1);
+#if HAVE_FASTDDS_STATISTICS
+                    uint64_t requested = 0;
+                    sn_set.for_each([&requested](SequenceNumber_t)
+                            {
+                                ++requested;
+                            });
+                    FASTDDS_STATISTICS_ADD(statistics_, DATA_RESENT, requested);
+#endif
+
                     // Sequence numbers before Base are set as Acknowledged.
                     remote_reader->acked_changes_set(sn_set.base());
                     if (sn_set.base() > SequenceNumber_t(0, 0))
                     {
                         if (remote_reader->requested_changes_set(sn_set) || remote_reader->are_there_gaps())
                         {
-                            nack_response_event_->restart_timer();
+                            schedule_nack_response_nts();
                         }
                         else if (!final_flag)
                         {
@@ -2036,9 +2340,10 @@ bool StatefulWriter::process_nack_frag(
         {
             if (remote_reader->guid() == reader_guid)
             {
+                FASTDDS_STATISTICS_ADD(statistics_, NACKFRAGS_RECEIVED, 1);
                 if (remote_reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
                 {
-                    nack_response_event_->restart_timer();
+                    schedule_nack_response_nts();
                 }
                 break;
             }
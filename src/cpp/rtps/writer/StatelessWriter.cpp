@@ -115,6 +115,12 @@ StatelessWriter::~StatelessWriter()
         controller->disable();
     }
 
+    if (batch_flush_event_ != nullptr)
+    {
+        delete(batch_flush_event_);
+        batch_flush_event_ = nullptr;
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -165,6 +171,7 @@ void StatelessWriter::update_reader_info(
     }
 
     update_cached_info_nts();
+    ReaderLocatorCluster::build_clusters(mp_RTPSParticipant, matched_readers_, reader_clusters_);
     if (addGuid)
     {
         compute_selected_guids();
@@ -202,41 +209,42 @@ void StatelessWriter::unsent_change_added_to_history(
 
     if (!fixed_locators_.empty() || matched_readers_.size() > 0)
     {
-        if (!isAsync())
+        if (!isAsync() && !batching_.enabled)
         {
             try
             {
                 if (m_separateSendingEnabled)
                 {
-                    std::vector<GUID_t> guids(1);
                     for (ReaderLocator& it : matched_readers_)
                     {
                         if (it.is_local_reader())
                         {
                             intraprocess_delivery(change, it);
                         }
-                        else
-                        {
-                            RTPSMessageGroup group(mp_RTPSParticipant, this, it, max_blocking_time);
+                    }
 
-                            uint32_t n_fragments = change->getFragmentCount();
-                            if (n_fragments > 0)
+                    // Remote readers sharing destination locators receive a single message
+                    for (ReaderLocatorCluster& cluster : reader_clusters_)
+                    {
+                        RTPSMessageGroup group(mp_RTPSParticipant, this, cluster, max_blocking_time);
+
+                        uint32_t n_fragments = change->getFragmentCount();
+                        if (n_fragments > 0)
+                        {
+                            for (uint32_t frag = 1; frag <= n_fragments; frag++)
                             {
-                                for (uint32_t frag = 1; frag <= n_fragments; frag++)
+                                if (!group.add_data_frag(*change, frag, is_inline_qos_expected_))
                                 {
-                                    if (!group.add_data_frag(*change, frag, is_inline_qos_expected_))
-                                    {
-                                        logError(RTPS_WRITER, "Error sending fragment (" << change->sequenceNumber <<
-                                                ", " << frag << ")");
-                                    }
+                                    logError(RTPS_WRITER, "Error sending fragment (" << change->sequenceNumber <<
+                                            ", " << frag << ")");
                                 }
                             }
-                            else
+                        }
+                        else
+                        {
+                            if (!group.add_data(*change, is_inline_qos_expected_))
                             {
-                                if (!group.add_data(*change, is_inline_qos_expected_))
-                                {
-                                    logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
-                                }
+                                logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                             }
                         }
                     }
@@ -290,7 +298,14 @@ void StatelessWriter::unsent_change_added_to_history(
         else
         {
             unsent_changes_.push_back(ChangeForReader_t(change));
-            mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+            if (batching_.enabled)
+            {
+                add_to_batch_nts(change);
+            }
+            else
+            {
+                mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+            }
         }
     }
     else
@@ -339,8 +354,8 @@ bool StatelessWriter::change_removed_by_history(
 bool StatelessWriter::is_acked_by_all(
         const CacheChange_t* change) const
 {
-    // Only asynchronous writers may have unacked (i.e. unsent changes)
-    if (isAsync())
+    // Only asynchronous and batching writers may have unacked (i.e. unsent changes)
+    if (isAsync() || batching_.enabled)
     {
         std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
@@ -808,16 +823,17 @@ void StatelessWriter::add_flow_controller(
 
 bool StatelessWriter::send(
         CDRMessage_t* message,
+        const std::vector<NetworkBuffer>& buffers,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
-    if (!RTPSWriter::send(message, max_blocking_time_point))
+    if (!RTPSWriter::send(message, buffers, max_blocking_time_point))
     {
         return false;
     }
 
     return ignore_fixed_locators_ ||
            fixed_locators_.empty() ||
-           mp_RTPSParticipant->sendSync(message, Locators(fixed_locators_.begin()), Locators(
+           mp_RTPSParticipant->sendSync(message, buffers, Locators(fixed_locators_.begin()), Locators(
                        fixed_locators_.end()), max_blocking_time_point);
 }
 
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <cerrno>
+#include <cstdlib>
 #include <cstring>
 #include <regex>
 #include <tinyxml2.h>
@@ -225,6 +227,84 @@ XMLP_ret XMLParser::getXMLSendBuffersAllocationAttributes(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLThreadSettings(
+        tinyxml2::XMLElement* elem,
+        fastdds::rtps::ThreadSettings& settings,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="threadSettingsType">
+            <xs:all minOccurs="0">
+                <xs:element name="scheduling_policy" type="int32Type" minOccurs="0"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0"/>
+                <xs:element name="affinity" type="uint64Type" minOccurs="0"/>
+                <xs:element name="stack_size" type="int32Type" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    int tmp;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, SCHEDULING_POLICY) == 0)
+        {
+            // scheduling_policy - int32Type
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.scheduling_policy = tmp;
+        }
+        else if (strcmp(name, PRIORITY) == 0)
+        {
+            // priority - int32Type
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.priority = tmp;
+        }
+        else if (strcmp(name, AFFINITY) == 0)
+        {
+            // affinity - uint64Type, decimal or hexadecimal mask
+            const char* text = p_aux0->GetText();
+            char* end = nullptr;
+            if (nullptr == text || '-' == text[0])
+            {
+                logError(XMLPARSER, "<" << name << "> getXMLThreadSettings XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            errno = 0;
+            unsigned long long mask = std::strtoull(text, &end, 0);
+            if (0 != errno || end == text || '\0' != *end)
+            {
+                logError(XMLPARSER, "<" << name << "> getXMLThreadSettings XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.affinity = static_cast<uint64_t>(mask);
+        }
+        else if (strcmp(name, STACK_SIZE) == 0)
+        {
+            // stack_size - int32Type
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.stack_size = tmp;
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'threadSettingsType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLDiscoverySettings(
         tinyxml2::XMLElement* elem,
         rtps::DiscoverySettings& settings,
@@ -2790,6 +2870,7 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(
                 <xs:enumeration value="PREALLOCATED_WITH_REALLOC"/>
                 <xs:enumeration value="DYNAMIC"/>
                 <xs:enumeration value="DYNAMIC_REUSABLE"/>
+                <xs:enumeration value="DYNAMIC_SLAB"/>
             </xs:restriction>
         </xs:simpleType>
      */
@@ -2815,6 +2896,10 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(
     {
         historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE;
     }
+    else if (strcmp(text, DYNAMIC_SLAB) == 0)
+    {
+        historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_SLAB_MEMORY_MODE;
+    }
     else
     {
         logError(XMLPARSER, "Node '" << KIND << "' bad content");
@@ -439,6 +439,7 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 <xs:element name="logical_port_increment" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="metadata_logical_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="listening_ports" type="portListType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -491,6 +492,14 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
             }
             std::dynamic_pointer_cast<rtps::TransportDescriptorInterface>(p_transport)->maxMessageSize = uSize;
         }
+        else if (strcmp(name, RECEPTION_THREADS) == 0)
+        {
+            // reception_threads - threadSettingsType
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, pDesc->reception_threads, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, MAX_INITIAL_PEERS_RANGE) == 0)
         {
             // maxInitialPeersRange - uint32Type
@@ -535,7 +544,8 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 || strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 || strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
-                strcmp(name, RTPS_DUMP_FILE) == 0)
+                strcmp(name, BUSY_POLL_US) == 0 || strcmp(name, BUFFER_SLAB_SIZE) == 0 ||
+                strcmp(name, HUGE_PAGES) == 0 || strcmp(name, RTPS_DUMP_FILE) == 0)
         {
             // Parsed outside of this method
         }
@@ -682,7 +692,7 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                     strcmp(name, TYPE) == 0 || strcmp(name, SEND_BUFFER_SIZE) == 0 ||
                     strcmp(name, RECEIVE_BUFFER_SIZE) == 0 || strcmp(name, TTL) == 0 ||
                     strcmp(name, MAX_MESSAGE_SIZE) == 0 || strcmp(name, MAX_INITIAL_PEERS_RANGE) == 0 ||
-                    strcmp(name, WHITE_LIST) == 0)
+                    strcmp(name, WHITE_LIST) == 0 || strcmp(name, RECEPTION_THREADS) == 0)
             {
                 // Parsed Outside of this method
             }
@@ -714,7 +724,11 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="segment_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="busy_poll_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="buffer_slab_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="huge_pages" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
         </xs:complexType>
      */
@@ -754,6 +768,31 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->healthy_check_timeout_ms(static_cast<uint32_t>(aux));
             }
+            else if (strcmp(name, BUSY_POLL_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->busy_poll_us(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, BUFFER_SLAB_SIZE) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->buffer_slab_size(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, HUGE_PAGES) == 0)
+            {
+                bool huge_pages = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &huge_pages, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->huge_pages(huge_pages);
+            }
             else if (strcmp(name, RTPS_DUMP_FILE) == 0)
             {
                 std::string str;
@@ -763,6 +802,14 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->rtps_dump_file(str);
             }
+            else if (strcmp(name, RECEPTION_THREADS) == 0)
+            {
+                // reception_threads - threadSettingsType
+                if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, transport_descriptor->reception_threads, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, MAX_MESSAGE_SIZE) == 0)
             {
                 // maxMessageSize - uint32Type
@@ -2707,6 +2754,7 @@ XMLP_ret XMLParser::parseLogConfig(
               </xs:sequence>
             </xs:complexType>
         </xs:sequence>
+        <xs:element name="thread_settings" type="threadSettingsType" minOccurs="0"/>
        </xs:complexType>
        </xs:element>
      */
@@ -2745,13 +2793,23 @@ XMLP_ret XMLParser::parseLogConfig(
                     return ret;
                 }
             }
+            else if (strcmp(tag, THREAD_SETTINGS) == 0)
+            {
+                fastdds::rtps::ThreadSettings thread_settings;
+                ret = getXMLThreadSettings(p_element, thread_settings, 0);
+                if (ret != XMLP_ret::XML_OK)
+                {
+                    return ret;
+                }
+                eprosima::fastdds::dds::Log::SetThreadSettings(thread_settings);
+            }
             else
             {
                 logError(XMLPARSER, "Not expected tag: '" << tag << "'");
                 ret = XMLP_ret::XML_ERROR;
             }
         }
-        p_element = p_element->NextSiblingElement(CONSUMER);
+        p_element = p_element->NextSiblingElement();
     }
     return ret;
 }
@@ -2957,6 +3015,8 @@ XMLP_ret XMLParser::fillDataNode(
                 <xs:element name="useBuiltinTransports" type="boolType" minOccurs="0"/>
                 <xs:element name="propertiesPolicy" type="propertyPolicyType" minOccurs="0"/>
                 <xs:element name="name" type="stringType" minOccurs="0"/>
+                <xs:element name="timed_events_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="async_writer_thread" type="threadSettingsType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -3120,6 +3180,24 @@ XMLP_ret XMLParser::fillDataNode(
             }
             participant_node.get()->rtps.setName(s.c_str());
         }
+        else if (strcmp(name, TIMED_EVENTS_THREAD) == 0)
+        {
+            // timed_events_thread - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.timed_events_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, ASYNC_WRITER_THREAD) == 0)
+        {
+            // async_writer_thread - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.async_writer_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'rtpsParticipantAttributesType'. Name: " << name);
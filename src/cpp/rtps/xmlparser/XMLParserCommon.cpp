@@ -62,9 +62,13 @@ const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
 const char* SEGMENT_OVERFLOW_POLICY = "segment_overflow_policy";
 const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
+const char* BUSY_POLL_US = "busy_poll_us";
+const char* BUFFER_SLAB_SIZE = "buffer_slab_size";
+const char* HUGE_PAGES = "huge_pages";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
+const char* RECEPTION_THREADS = "reception_threads";
 
 const char* OFF = "OFF";
 const char* USER_DATA_ONLY = "USER_DATA_ONLY";
@@ -106,6 +110,8 @@ const char* TOTAL_PARTICIPANTS = "total_participants";
 const char* TOTAL_READERS = "total_readers";
 const char* TOTAL_WRITERS = "total_writers";
 const char* SEND_BUFFERS = "send_buffers";
+const char* TIMED_EVENTS_THREAD = "timed_events_thread";
+const char* ASYNC_WRITER_THREAD = "async_writer_thread";
 const char* PREALLOCATED_NUMBER = "preallocated_number";
 const char* DYNAMIC_LC = "dynamic";
 const char* MAX_PROPERTIES = "max_properties";
@@ -138,6 +144,7 @@ const char* PREALLOCATED = "PREALLOCATED";
 const char* PREALLOCATED_WITH_REALLOC = "PREALLOCATED_WITH_REALLOC";
 const char* DYNAMIC = "DYNAMIC";
 const char* DYNAMIC_REUSABLE = "DYNAMIC_REUSABLE";
+const char* DYNAMIC_SLAB = "DYNAMIC_SLAB";
 const char* LOCATOR = "locator";
 const char* UDPv4_LOCATOR = "udpv4";
 const char* UDPv6_LOCATOR = "udpv6";
@@ -362,6 +369,13 @@ const char* BASE_TYPE = "baseType";
 const char* USE_DEFAULT = "use_default";
 const char* CONSUMER = "consumer";
 const char* CLASS = "class";
+const char* THREAD_SETTINGS = "thread_settings";
+
+// Thread settings
+const char* SCHEDULING_POLICY = "scheduling_policy";
+const char* PRIORITY = "priority";
+const char* AFFINITY = "affinity";
+const char* STACK_SIZE = "stack_size";
 
 // Allocation config
 const char* INITIAL = "initial";
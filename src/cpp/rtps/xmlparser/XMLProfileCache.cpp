@@ -0,0 +1,1159 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file XMLProfileCache.cpp
+ */
+
+#include "XMLProfileCache.hpp"
+
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <fastrtps/utils/System.h>
+#include <fastdds/dds/log/Log.hpp>
+
+#include <tinyxml2.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace xmlparser {
+
+using namespace rtps;
+
+//! Environment variable with the directory where the cache files are stored
+static const char* PROFILES_CACHE_ENV_VARIABLE = "FASTRTPS_PROFILES_CACHE_DIRECTORY";
+
+//! Identifies a profile cache file
+static const char PROFILES_CACHE_MAGIC[4] = {'F', 'P', 'C', 'F'};
+
+//! Version of the cache file format. Should be increased whenever the serialized attributes change.
+static constexpr uint32_t PROFILES_CACHE_VERSION = 2;
+
+static uint64_t hash_contents(
+        const std::string& contents)
+{
+    // FNV-1a, seeded with the format version so a new format never reuses old entries
+    uint64_t hash = 14695981039346656037ull ^ PROFILES_CACHE_VERSION;
+    for (unsigned char c : contents)
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+//! Serializes values on a memory buffer, using the local endianness.
+class CacheOutput
+{
+public:
+
+    template<typename T>
+    void write(
+            const T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only primitive types can be written directly");
+        const octet* data = reinterpret_cast<const octet*>(&value);
+        buffer_.insert(buffer_.end(), data, data + sizeof(T));
+    }
+
+    template<typename E>
+    void write_enum(
+            E value)
+    {
+        write(static_cast<int32_t>(value));
+    }
+
+    void write_size(
+            size_t value)
+    {
+        write(static_cast<uint64_t>(value));
+    }
+
+    void write_string(
+            const std::string& value)
+    {
+        write_size(value.size());
+        buffer_.insert(buffer_.end(), value.begin(), value.end());
+    }
+
+    void write_octets(
+            const octet* data,
+            size_t size)
+    {
+        buffer_.insert(buffer_.end(), data, data + size);
+    }
+
+    const std::vector<octet>& buffer() const
+    {
+        return buffer_;
+    }
+
+private:
+
+    std::vector<octet> buffer_;
+};
+
+//! Deserializes values from a memory buffer. Once a read fails, the following ones fail too.
+class CacheInput
+{
+public:
+
+    CacheInput(
+            const octet* data,
+            size_t size)
+        : data_(data)
+        , size_(size)
+    {
+    }
+
+    template<typename T>
+    bool read(
+            T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only primitive types can be read directly");
+        return read_octets(reinterpret_cast<octet*>(&value), sizeof(T));
+    }
+
+    template<typename E>
+    bool read_enum(
+            E& value)
+    {
+        int32_t aux = 0;
+        if (read(aux))
+        {
+            value = static_cast<E>(aux);
+        }
+        return ok_;
+    }
+
+    bool read_size(
+            size_t& value)
+    {
+        uint64_t aux = 0;
+        if (read(aux))
+        {
+            value = static_cast<size_t>(aux);
+        }
+        return ok_;
+    }
+
+    bool read_string(
+            std::string& value)
+    {
+        size_t size = 0;
+        if (read_size(size) && check(size))
+        {
+            value.assign(reinterpret_cast<const char*>(data_ + pos_), size);
+            pos_ += size;
+        }
+        return ok_;
+    }
+
+    bool read_octets(
+            octet* data,
+            size_t size)
+    {
+        if (check(size))
+        {
+            memcpy(data, data_ + pos_, size);
+            pos_ += size;
+        }
+        return ok_;
+    }
+
+    bool ok() const
+    {
+        return ok_;
+    }
+
+    bool at_end() const
+    {
+        return ok_ && pos_ == size_;
+    }
+
+private:
+
+    bool check(
+            size_t size)
+    {
+        ok_ = ok_ && size <= size_ - pos_;
+        return ok_;
+    }
+
+    const octet* data_;
+    size_t size_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+/*
+ * Serialization of the attributes the XML parser is able to fill. Every serialize function has its deserialize
+ * counterpart, which must read the fields in the same order.
+ */
+
+static void serialize(
+        CacheOutput& out,
+        const Duration_t& duration)
+{
+    out.write(duration.seconds);
+    out.write(duration.nanosec);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        Duration_t& duration)
+{
+    return in.read(duration.seconds) && in.read(duration.nanosec);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const LocatorList_t& locators)
+{
+    out.write_size(locators.size());
+    for (const Locator_t& locator : locators)
+    {
+        out.write(locator.kind);
+        out.write(locator.port);
+        out.write_octets(locator.address, sizeof(locator.address));
+    }
+}
+
+static bool deserialize(
+        CacheInput& in,
+        LocatorList_t& locators)
+{
+    size_t size = 0;
+    in.read_size(size);
+    for (size_t i = 0; i < size && in.ok(); ++i)
+    {
+        Locator_t locator;
+        if (in.read(locator.kind) && in.read(locator.port) &&
+                in.read_octets(locator.address, sizeof(locator.address)))
+        {
+            locators.push_back(locator);
+        }
+    }
+    return in.ok();
+}
+
+static void serialize(
+        CacheOutput& out,
+        const GuidPrefix_t& prefix)
+{
+    out.write_octets(prefix.value, prefix.size);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        GuidPrefix_t& prefix)
+{
+    return in.read_octets(prefix.value, prefix.size);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const ResourceLimitedContainerConfig& config)
+{
+    out.write_size(config.initial);
+    out.write_size(config.maximum);
+    out.write_size(config.increment);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        ResourceLimitedContainerConfig& config)
+{
+    return in.read_size(config.initial) && in.read_size(config.maximum) && in.read_size(config.increment);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const fastdds::rtps::ThreadSettings& settings)
+{
+    out.write(settings.scheduling_policy);
+    out.write(settings.priority);
+    out.write(settings.affinity);
+    out.write(settings.stack_size);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        fastdds::rtps::ThreadSettings& settings)
+{
+    return in.read(settings.scheduling_policy) && in.read(settings.priority) && in.read(settings.affinity) &&
+           in.read(settings.stack_size);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const PropertyPolicy& policy)
+{
+    out.write_size(policy.properties().size());
+    for (const Property& property : policy.properties())
+    {
+        out.write_string(property.name());
+        out.write_string(property.value());
+        out.write(property.propagate());
+    }
+    out.write_size(policy.binary_properties().size());
+    for (const BinaryProperty& property : policy.binary_properties())
+    {
+        out.write_string(property.name());
+        out.write_size(property.value().size());
+        out.write_octets(property.value().data(), property.value().size());
+        out.write(property.propagate());
+    }
+}
+
+static bool deserialize(
+        CacheInput& in,
+        PropertyPolicy& policy)
+{
+    size_t size = 0;
+    in.read_size(size);
+    for (size_t i = 0; i < size && in.ok(); ++i)
+    {
+        Property property;
+        bool propagate = false;
+        if (in.read_string(property.name()) && in.read_string(property.value()) && in.read(propagate))
+        {
+            property.propagate(propagate);
+            policy.properties().push_back(std::move(property));
+        }
+    }
+
+    in.read_size(size);
+    for (size_t i = 0; i < size && in.ok(); ++i)
+    {
+        BinaryProperty property;
+        size_t value_size = 0;
+        bool propagate = false;
+        if (in.read_string(property.name()) && in.read_size(value_size))
+        {
+            // Never trust a size before checking it against the remaining data
+            std::vector<octet> value;
+            while (value.size() < value_size && in.ok())
+            {
+                octet aux = 0;
+                in.read(aux);
+                value.push_back(aux);
+            }
+            if (in.read(propagate))
+            {
+                property.value(std::move(value));
+                property.propagate(propagate);
+                policy.binary_properties().push_back(std::move(property));
+            }
+        }
+    }
+    return in.ok();
+}
+
+static void serialize(
+        CacheOutput& out,
+        const ThroughputControllerDescriptor& controller)
+{
+    out.write(controller.bytesPerPeriod);
+    out.write(controller.periodMillisecs);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        ThroughputControllerDescriptor& controller)
+{
+    return in.read(controller.bytesPerPeriod) && in.read(controller.periodMillisecs);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const DiscoverySettings& settings)
+{
+    out.write_enum(settings.discoveryProtocol);
+    out.write(settings.use_SIMPLE_EndpointDiscoveryProtocol);
+    out.write(settings.use_STATIC_EndpointDiscoveryProtocol);
+    serialize(out, settings.leaseDuration);
+    serialize(out, settings.leaseDuration_announcementperiod);
+    out.write(settings.initial_announcements.count);
+    serialize(out, settings.initial_announcements.period);
+    out.write(settings.m_simpleEDP.use_PublicationWriterANDSubscriptionReader);
+    out.write(settings.m_simpleEDP.use_PublicationReaderANDSubscriptionWriter);
+#if HAVE_SECURITY
+    out.write(settings.m_simpleEDP.enable_builtin_secure_publications_writer_and_subscriptions_reader);
+    out.write(settings.m_simpleEDP.enable_builtin_secure_subscriptions_writer_and_publications_reader);
+#endif // if HAVE_SECURITY
+    serialize(out, settings.discoveryServer_client_syncperiod);
+    out.write_size(settings.m_DiscoveryServers.size());
+    for (const RemoteServerAttributes& server : settings.m_DiscoveryServers)
+    {
+        serialize(out, server.guidPrefix);
+        serialize(out, server.metatrafficUnicastLocatorList);
+        serialize(out, server.metatrafficMulticastLocatorList);
+    }
+    out.write_enum(settings.ignoreParticipantFlags);
+    out.write_string(settings.getStaticEndpointXMLFilename());
+}
+
+static bool deserialize(
+        CacheInput& in,
+        DiscoverySettings& settings)
+{
+    in.read_enum(settings.discoveryProtocol);
+    in.read(settings.use_SIMPLE_EndpointDiscoveryProtocol);
+    in.read(settings.use_STATIC_EndpointDiscoveryProtocol);
+    deserialize(in, settings.leaseDuration);
+    deserialize(in, settings.leaseDuration_announcementperiod);
+    in.read(settings.initial_announcements.count);
+    deserialize(in, settings.initial_announcements.period);
+    in.read(settings.m_simpleEDP.use_PublicationWriterANDSubscriptionReader);
+    in.read(settings.m_simpleEDP.use_PublicationReaderANDSubscriptionWriter);
+#if HAVE_SECURITY
+    in.read(settings.m_simpleEDP.enable_builtin_secure_publications_writer_and_subscriptions_reader);
+    in.read(settings.m_simpleEDP.enable_builtin_secure_subscriptions_writer_and_publications_reader);
+#endif // if HAVE_SECURITY
+    deserialize(in, settings.discoveryServer_client_syncperiod);
+
+    size_t size = 0;
+    in.read_size(size);
+    for (size_t i = 0; i < size && in.ok(); ++i)
+    {
+        RemoteServerAttributes server;
+        if (deserialize(in, server.guidPrefix) &&
+                deserialize(in, server.metatrafficUnicastLocatorList) &&
+                deserialize(in, server.metatrafficMulticastLocatorList))
+        {
+            settings.m_DiscoveryServers.push_back(server);
+        }
+    }
+
+    in.read_enum(settings.ignoreParticipantFlags);
+    std::string filename;
+    if (in.read_string(filename))
+    {
+        settings.setStaticEndpointXMLFilename(filename.c_str());
+    }
+    return in.ok();
+}
+
+static void serialize(
+        CacheOutput& out,
+        const BuiltinAttributes& builtin)
+{
+    serialize(out, builtin.discovery_config);
+    out.write(builtin.use_WriterLivelinessProtocol);
+    out.write(builtin.typelookup_config.use_client);
+    out.write(builtin.typelookup_config.use_server);
+    serialize(out, builtin.metatrafficUnicastLocatorList);
+    serialize(out, builtin.metatrafficMulticastLocatorList);
+    serialize(out, builtin.initialPeersList);
+    out.write_enum(builtin.readerHistoryMemoryPolicy);
+    out.write(builtin.readerPayloadSize);
+    out.write_enum(builtin.writerHistoryMemoryPolicy);
+    out.write(builtin.writerPayloadSize);
+    out.write(builtin.mutation_tries);
+    out.write(builtin.avoid_builtin_multicast);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        BuiltinAttributes& builtin)
+{
+    deserialize(in, builtin.discovery_config);
+    in.read(builtin.use_WriterLivelinessProtocol);
+    in.read(builtin.typelookup_config.use_client);
+    in.read(builtin.typelookup_config.use_server);
+    deserialize(in, builtin.metatrafficUnicastLocatorList);
+    deserialize(in, builtin.metatrafficMulticastLocatorList);
+    deserialize(in, builtin.initialPeersList);
+    in.read_enum(builtin.readerHistoryMemoryPolicy);
+    in.read(builtin.readerPayloadSize);
+    in.read_enum(builtin.writerHistoryMemoryPolicy);
+    in.read(builtin.writerPayloadSize);
+    in.read(builtin.mutation_tries);
+    return in.read(builtin.avoid_builtin_multicast);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const RTPSParticipantAllocationAttributes& allocation)
+{
+    out.write_size(allocation.locators.max_unicast_locators);
+    out.write_size(allocation.locators.max_multicast_locators);
+    serialize(out, allocation.participants);
+    serialize(out, allocation.readers);
+    serialize(out, allocation.writers);
+    out.write_size(allocation.send_buffers.preallocated_number);
+    out.write(allocation.send_buffers.dynamic);
+    out.write_size(allocation.data_limits.max_properties);
+    out.write_size(allocation.data_limits.max_user_data);
+    out.write_size(allocation.data_limits.max_partitions);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        RTPSParticipantAllocationAttributes& allocation)
+{
+    in.read_size(allocation.locators.max_unicast_locators);
+    in.read_size(allocation.locators.max_multicast_locators);
+    deserialize(in, allocation.participants);
+    deserialize(in, allocation.readers);
+    deserialize(in, allocation.writers);
+    in.read_size(allocation.send_buffers.preallocated_number);
+    in.read(allocation.send_buffers.dynamic);
+    in.read_size(allocation.data_limits.max_properties);
+    in.read_size(allocation.data_limits.max_user_data);
+    return in.read_size(allocation.data_limits.max_partitions);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const ParticipantAttributes& participant)
+{
+    const RTPSParticipantAttributes& rtps = participant.rtps;
+
+    out.write(participant.domainId);
+    out.write_string(rtps.getName());
+    serialize(out, rtps.defaultUnicastLocatorList);
+    serialize(out, rtps.defaultMulticastLocatorList);
+    out.write(rtps.sendSocketBufferSize);
+    out.write(rtps.listenSocketBufferSize);
+    serialize(out, rtps.prefix);
+    serialize(out, rtps.builtin);
+    out.write(rtps.port.portBase);
+    out.write(rtps.port.domainIDGain);
+    out.write(rtps.port.participantIDGain);
+    out.write(rtps.port.offsetd0);
+    out.write(rtps.port.offsetd1);
+    out.write(rtps.port.offsetd2);
+    out.write(rtps.port.offsetd3);
+    out.write_size(rtps.userData.size());
+    out.write_octets(rtps.userData.data(), rtps.userData.size());
+    out.write(rtps.participantID);
+    serialize(out, rtps.throughputController);
+    out.write(rtps.useBuiltinTransports);
+    serialize(out, rtps.allocation);
+    serialize(out, rtps.properties);
+    serialize(out, rtps.timed_events_thread);
+    serialize(out, rtps.async_writer_thread);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        ParticipantAttributes& participant)
+{
+    RTPSParticipantAttributes& rtps = participant.rtps;
+
+    in.read(participant.domainId);
+    std::string name;
+    if (in.read_string(name))
+    {
+        rtps.setName(name.c_str());
+    }
+    deserialize(in, rtps.defaultUnicastLocatorList);
+    deserialize(in, rtps.defaultMulticastLocatorList);
+    in.read(rtps.sendSocketBufferSize);
+    in.read(rtps.listenSocketBufferSize);
+    deserialize(in, rtps.prefix);
+    deserialize(in, rtps.builtin);
+    in.read(rtps.port.portBase);
+    in.read(rtps.port.domainIDGain);
+    in.read(rtps.port.participantIDGain);
+    in.read(rtps.port.offsetd0);
+    in.read(rtps.port.offsetd1);
+    in.read(rtps.port.offsetd2);
+    in.read(rtps.port.offsetd3);
+
+    size_t size = 0;
+    in.read_size(size);
+    while (rtps.userData.size() < size && in.ok())
+    {
+        octet aux = 0;
+        in.read(aux);
+        rtps.userData.push_back(aux);
+    }
+
+    in.read(rtps.participantID);
+    deserialize(in, rtps.throughputController);
+    in.read(rtps.useBuiltinTransports);
+    deserialize(in, rtps.allocation);
+    deserialize(in, rtps.properties);
+    deserialize(in, rtps.timed_events_thread);
+    return deserialize(in, rtps.async_writer_thread);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const TopicAttributes& topic)
+{
+    out.write_enum(topic.topicKind);
+    out.write_string(topic.topicName.to_string());
+    out.write_string(topic.topicDataType.to_string());
+    out.write_enum(topic.historyQos.kind);
+    out.write(topic.historyQos.depth);
+    out.write(topic.resourceLimitsQos.max_samples);
+    out.write(topic.resourceLimitsQos.max_instances);
+    out.write(topic.resourceLimitsQos.max_samples_per_instance);
+    out.write(topic.resourceLimitsQos.allocated_samples);
+    out.write(topic.auto_fill_type_object);
+    out.write(topic.auto_fill_type_information);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        TopicAttributes& topic)
+{
+    std::string aux;
+    in.read_enum(topic.topicKind);
+    if (in.read_string(aux))
+    {
+        topic.topicName = aux;
+    }
+    if (in.read_string(aux))
+    {
+        topic.topicDataType = aux;
+    }
+    in.read_enum(topic.historyQos.kind);
+    in.read(topic.historyQos.depth);
+    in.read(topic.resourceLimitsQos.max_samples);
+    in.read(topic.resourceLimitsQos.max_instances);
+    in.read(topic.resourceLimitsQos.max_samples_per_instance);
+    in.read(topic.resourceLimitsQos.allocated_samples);
+    in.read(topic.auto_fill_type_object);
+    return in.read(topic.auto_fill_type_information);
+}
+
+//! Policies shared by WriterQos and ReaderQos that can be set from XML
+template<typename Qos>
+static void serialize_common_qos(
+        CacheOutput& out,
+        const Qos& qos)
+{
+    out.write_enum(qos.m_durability.kind);
+    out.write_enum(qos.m_liveliness.kind);
+    serialize(out, qos.m_liveliness.lease_duration);
+    serialize(out, qos.m_liveliness.announcement_period);
+    out.write_enum(qos.m_reliability.kind);
+    serialize(out, qos.m_reliability.max_blocking_time);
+    std::vector<std::string> partitions = qos.m_partition.names();
+    out.write_size(partitions.size());
+    for (const std::string& partition : partitions)
+    {
+        out.write_string(partition);
+    }
+    serialize(out, qos.m_deadline.period);
+    serialize(out, qos.m_lifespan.duration);
+    out.write(qos.m_disablePositiveACKs.enabled);
+    serialize(out, qos.m_disablePositiveACKs.duration);
+    serialize(out, qos.m_latencyBudget.duration);
+}
+
+template<typename Qos>
+static bool deserialize_common_qos(
+        CacheInput& in,
+        Qos& qos)
+{
+    in.read_enum(qos.m_durability.kind);
+    in.read_enum(qos.m_liveliness.kind);
+    deserialize(in, qos.m_liveliness.lease_duration);
+    deserialize(in, qos.m_liveliness.announcement_period);
+    in.read_enum(qos.m_reliability.kind);
+    deserialize(in, qos.m_reliability.max_blocking_time);
+
+    size_t size = 0;
+    in.read_size(size);
+    std::vector<std::string> partitions;
+    while (partitions.size() < size && in.ok())
+    {
+        std::string partition;
+        in.read_string(partition);
+        partitions.push_back(partition);
+    }
+    if (!partitions.empty())
+    {
+        qos.m_partition.names(partitions);
+    }
+
+    deserialize(in, qos.m_deadline.period);
+    deserialize(in, qos.m_lifespan.duration);
+    in.read(qos.m_disablePositiveACKs.enabled);
+    deserialize(in, qos.m_disablePositiveACKs.duration);
+    return deserialize(in, qos.m_latencyBudget.duration);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const PublisherAttributes& publisher)
+{
+    serialize(out, publisher.topic);
+    serialize_common_qos(out, publisher.qos);
+    out.write_enum(publisher.qos.m_publishMode.kind);
+    serialize(out, publisher.times.initialHeartbeatDelay);
+    serialize(out, publisher.times.heartbeatPeriod);
+    serialize(out, publisher.times.nackResponseDelay);
+    serialize(out, publisher.times.nackSupressionDuration);
+    serialize(out, publisher.unicastLocatorList);
+    serialize(out, publisher.multicastLocatorList);
+    serialize(out, publisher.remoteLocatorList);
+    serialize(out, publisher.throughputController);
+    out.write_enum(publisher.historyMemoryPolicy);
+    serialize(out, publisher.properties);
+    serialize(out, publisher.matched_subscriber_allocation);
+    out.write(publisher.getUserDefinedID());
+    out.write(publisher.getEntityID());
+}
+
+static bool deserialize(
+        CacheInput& in,
+        PublisherAttributes& publisher)
+{
+    deserialize(in, publisher.topic);
+    deserialize_common_qos(in, publisher.qos);
+    in.read_enum(publisher.qos.m_publishMode.kind);
+    deserialize(in, publisher.times.initialHeartbeatDelay);
+    deserialize(in, publisher.times.heartbeatPeriod);
+    deserialize(in, publisher.times.nackResponseDelay);
+    deserialize(in, publisher.times.nackSupressionDuration);
+    deserialize(in, publisher.unicastLocatorList);
+    deserialize(in, publisher.multicastLocatorList);
+    deserialize(in, publisher.remoteLocatorList);
+    deserialize(in, publisher.throughputController);
+    in.read_enum(publisher.historyMemoryPolicy);
+    deserialize(in, publisher.properties);
+    deserialize(in, publisher.matched_subscriber_allocation);
+
+    // Identifiers are only set when the XML had them, as the setters do not accept the default value
+    int16_t user_defined_id = -1;
+    int16_t entity_id = -1;
+    if (in.read(user_defined_id) && user_defined_id >= 0)
+    {
+        publisher.setUserDefinedID(static_cast<uint8_t>(user_defined_id));
+    }
+    if (in.read(entity_id) && entity_id >= 0)
+    {
+        publisher.setEntityID(static_cast<uint8_t>(entity_id));
+    }
+    return in.ok();
+}
+
+static void serialize(
+        CacheOutput& out,
+        const SubscriberAttributes& subscriber)
+{
+    serialize(out, subscriber.topic);
+    serialize_common_qos(out, subscriber.qos);
+    serialize(out, subscriber.times.initialAcknackDelay);
+    serialize(out, subscriber.times.heartbeatResponseDelay);
+    serialize(out, subscriber.unicastLocatorList);
+    serialize(out, subscriber.multicastLocatorList);
+    serialize(out, subscriber.remoteLocatorList);
+    out.write(subscriber.expectsInlineQos);
+    out.write_enum(subscriber.historyMemoryPolicy);
+    serialize(out, subscriber.properties);
+    serialize(out, subscriber.matched_publisher_allocation);
+    out.write(subscriber.getUserDefinedID());
+    out.write(subscriber.getEntityID());
+}
+
+static bool deserialize(
+        CacheInput& in,
+        SubscriberAttributes& subscriber)
+{
+    deserialize(in, subscriber.topic);
+    deserialize_common_qos(in, subscriber.qos);
+    deserialize(in, subscriber.times.initialAcknackDelay);
+    deserialize(in, subscriber.times.heartbeatResponseDelay);
+    deserialize(in, subscriber.unicastLocatorList);
+    deserialize(in, subscriber.multicastLocatorList);
+    deserialize(in, subscriber.remoteLocatorList);
+    in.read(subscriber.expectsInlineQos);
+    in.read_enum(subscriber.historyMemoryPolicy);
+    deserialize(in, subscriber.properties);
+    deserialize(in, subscriber.matched_publisher_allocation);
+
+    int16_t user_defined_id = -1;
+    int16_t entity_id = -1;
+    if (in.read(user_defined_id) && user_defined_id >= 0)
+    {
+        subscriber.setUserDefinedID(static_cast<uint8_t>(user_defined_id));
+    }
+    if (in.read(entity_id) && entity_id >= 0)
+    {
+        subscriber.setEntityID(static_cast<uint8_t>(entity_id));
+    }
+    return in.ok();
+}
+
+//! RequesterAttributes and ReplierAttributes have the same fields
+template<typename Service>
+static void serialize_service(
+        CacheOutput& out,
+        const Service& service)
+{
+    out.write_string(service.service_name);
+    out.write_string(service.request_type);
+    out.write_string(service.reply_type);
+    out.write_string(service.request_topic_name);
+    out.write_string(service.reply_topic_name);
+    serialize(out, service.publisher);
+    serialize(out, service.subscriber);
+}
+
+template<typename Service>
+static bool deserialize_service(
+        CacheInput& in,
+        Service& service)
+{
+    in.read_string(service.service_name);
+    in.read_string(service.request_type);
+    in.read_string(service.reply_type);
+    in.read_string(service.request_topic_name);
+    in.read_string(service.reply_topic_name);
+    deserialize(in, service.publisher);
+    return deserialize(in, service.subscriber);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const RequesterAttributes& requester)
+{
+    serialize_service(out, requester);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        RequesterAttributes& requester)
+{
+    return deserialize_service(in, requester);
+}
+
+static void serialize(
+        CacheOutput& out,
+        const ReplierAttributes& replier)
+{
+    serialize_service(out, replier);
+}
+
+static bool deserialize(
+        CacheInput& in,
+        ReplierAttributes& replier)
+{
+    return deserialize_service(in, replier);
+}
+
+template<typename T>
+static void serialize_node(
+        CacheOutput& out,
+        BaseNode& node)
+{
+    DataNode<T>& data_node = dynamic_cast<DataNode<T>&>(node);
+    out.write_enum(node.getType());
+    out.write_size(data_node.getAttributes().size());
+    for (const auto& attribute : data_node.getAttributes())
+    {
+        out.write_string(attribute.first);
+        out.write_string(attribute.second);
+    }
+    serialize(out, *data_node.get());
+}
+
+template<typename T>
+static bool deserialize_node(
+        CacheInput& in,
+        NodeType type,
+        BaseNode& profiles)
+{
+    std::unique_ptr<DataNode<T>> node{new DataNode<T>{type, std::unique_ptr<T>(new T)}};
+
+    size_t size = 0;
+    in.read_size(size);
+    for (size_t i = 0; i < size && in.ok(); ++i)
+    {
+        std::string name;
+        std::string value;
+        if (in.read_string(name) && in.read_string(value))
+        {
+            node->addAttribute(name, value);
+        }
+    }
+
+    if (deserialize(in, *node->get()))
+    {
+        profiles.addChild(std::move(node));
+    }
+    return in.ok();
+}
+
+std::string XMLProfileCache::cache_directory()
+{
+    const char* directory = std::getenv(PROFILES_CACHE_ENV_VARIABLE);
+    return (nullptr != directory) ? directory : "";
+}
+
+bool XMLProfileCache::read_file(
+        const std::string& filename,
+        std::string& contents)
+{
+    FILE* file = std::fopen(filename.c_str(), "rb");
+    if (nullptr == file)
+    {
+        return false;
+    }
+
+    bool ret = false;
+    if (0 == std::fseek(file, 0, SEEK_END))
+    {
+        long size = std::ftell(file);
+        if (size >= 0 && 0 == std::fseek(file, 0, SEEK_SET))
+        {
+            contents.resize(static_cast<size_t>(size));
+            ret = contents.empty() || std::fread(&contents[0], 1, contents.size(), file) == contents.size();
+        }
+    }
+    std::fclose(file);
+    return ret;
+}
+
+std::string XMLProfileCache::cache_file(
+        const std::string& directory,
+        const std::string& contents)
+{
+    char name[40];
+    snprintf(name, sizeof(name), "fastrtps_profiles_%016llx.bin",
+            static_cast<unsigned long long>(hash_contents(contents)));
+    std::string path = directory;
+    if (!path.empty() && path.back() != '/' && path.back() != '\\')
+    {
+        path += '/';
+    }
+    return path + name;
+}
+
+static bool is_cacheable_profiles(
+        tinyxml2::XMLElement* profiles,
+        bool& has_library_settings)
+{
+    for (tinyxml2::XMLElement* element = profiles->FirstChildElement(); element != nullptr;
+            element = element->NextSiblingElement())
+    {
+        const char* tag = element->Value();
+        if (strcmp(tag, TRANSPORT_DESCRIPTORS) == 0 || strcmp(tag, TYPES) == 0)
+        {
+            return false;
+        }
+        else if (strcmp(tag, LIBRARY_SETTINGS) == 0)
+        {
+            has_library_settings = true;
+        }
+        else if (strcmp(tag, PARTICIPANT) == 0)
+        {
+            // User transports are references to descriptors that may come from other files
+            tinyxml2::XMLElement* rtps = element->FirstChildElement(RTPS);
+            if (nullptr != rtps && nullptr != rtps->FirstChildElement(USER_TRANS))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool XMLProfileCache::is_cacheable(
+        tinyxml2::XMLDocument& document,
+        bool& has_library_settings)
+{
+    has_library_settings = false;
+
+    tinyxml2::XMLElement* root = document.FirstChildElement(ROOT);
+    if (nullptr == root)
+    {
+        tinyxml2::XMLElement* profiles = document.FirstChildElement(PROFILES);
+        return nullptr != profiles && is_cacheable_profiles(profiles, has_library_settings);
+    }
+
+    for (tinyxml2::XMLElement* element = root->FirstChildElement(); element != nullptr;
+            element = element->NextSiblingElement())
+    {
+        const char* tag = element->Value();
+        if (strcmp(tag, PROFILES) == 0)
+        {
+            if (!is_cacheable_profiles(element, has_library_settings))
+            {
+                return false;
+            }
+        }
+        else if (strcmp(tag, LIBRARY_SETTINGS) == 0)
+        {
+            has_library_settings = true;
+        }
+        else if (strcmp(tag, TYPES) == 0 || strcmp(tag, LOG) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool XMLProfileCache::load(
+        const std::string& cache_file,
+        const std::string& contents,
+        up_base_node_t& profiles)
+{
+    std::string data;
+    if (!read_file(cache_file, data))
+    {
+        return false;
+    }
+
+    CacheInput in(reinterpret_cast<const octet*>(data.data()), data.size());
+    char magic[sizeof(PROFILES_CACHE_MAGIC)];
+    uint32_t version = 0;
+    uint64_t hash = 0;
+    uint64_t size = 0;
+    if (!in.read_octets(reinterpret_cast<octet*>(magic), sizeof(magic)) ||
+            memcmp(magic, PROFILES_CACHE_MAGIC, sizeof(magic)) != 0 ||
+            !in.read(version) || version != PROFILES_CACHE_VERSION ||
+            !in.read(hash) || hash != hash_contents(contents) ||
+            !in.read(size) || size != contents.size())
+    {
+        return false;
+    }
+
+    bool has_library_settings = false;
+    LibrarySettingsAttributes library_settings;
+    if (in.read(has_library_settings) && has_library_settings)
+    {
+        in.read_enum(library_settings.intraprocess_delivery);
+    }
+
+    up_base_node_t root{new BaseNode{NodeType::PROFILES}};
+    size_t count = 0;
+    in.read_size(count);
+    for (size_t i = 0; i < count && in.ok(); ++i)
+    {
+        NodeType type = NodeType::PROFILES;
+        in.read_enum(type);
+        switch (type)
+        {
+            case NodeType::PARTICIPANT:
+                deserialize_node<ParticipantAttributes>(in, type, *root);
+                break;
+            case NodeType::PUBLISHER:
+                deserialize_node<PublisherAttributes>(in, type, *root);
+                break;
+            case NodeType::SUBSCRIBER:
+                deserialize_node<SubscriberAttributes>(in, type, *root);
+                break;
+            case NodeType::TOPIC:
+                deserialize_node<TopicAttributes>(in, type, *root);
+                break;
+            case NodeType::REQUESTER:
+                deserialize_node<RequesterAttributes>(in, type, *root);
+                break;
+            case NodeType::REPLIER:
+                deserialize_node<ReplierAttributes>(in, type, *root);
+                break;
+            default:
+                return false;
+        }
+    }
+
+    if (!in.at_end())
+    {
+        logWarning(XMLPARSER, "Ignoring corrupt profiles cache file '" << cache_file << "'");
+        return false;
+    }
+
+    if (has_library_settings)
+    {
+        XMLProfileManager::library_settings(library_settings);
+    }
+    profiles = std::move(root);
+    return true;
+}
+
+bool XMLProfileCache::store(
+        const std::string& cache_file,
+        const std::string& contents,
+        BaseNode& profiles,
+        const LibrarySettingsAttributes* library_settings)
+{
+    CacheOutput out;
+    out.write_octets(reinterpret_cast<const octet*>(PROFILES_CACHE_MAGIC), sizeof(PROFILES_CACHE_MAGIC));
+    out.write(PROFILES_CACHE_VERSION);
+    out.write(hash_contents(contents));
+    out.write(static_cast<uint64_t>(contents.size()));
+    out.write(nullptr != library_settings);
+    if (nullptr != library_settings)
+    {
+        out.write_enum(library_settings->intraprocess_delivery);
+    }
+
+    out.write_size(profiles.getNumChildren());
+    for (auto& profile : profiles.getChildren())
+    {
+        switch (profile->getType())
+        {
+            case NodeType::PARTICIPANT:
+                serialize_node<ParticipantAttributes>(out, *profile);
+                break;
+            case NodeType::PUBLISHER:
+                serialize_node<PublisherAttributes>(out, *profile);
+                break;
+            case NodeType::SUBSCRIBER:
+                serialize_node<SubscriberAttributes>(out, *profile);
+                break;
+            case NodeType::TOPIC:
+                serialize_node<TopicAttributes>(out, *profile);
+                break;
+            case NodeType::REQUESTER:
+                serialize_node<RequesterAttributes>(out, *profile);
+                break;
+            case NodeType::REPLIER:
+                serialize_node<ReplierAttributes>(out, *profile);
+                break;
+            default:
+                return false;
+        }
+    }
+
+    // Write on a temporary file and move it to its final name, so concurrent processes never read a partial file
+    std::string temp_file = cache_file + "." + std::to_string(System::GetPID()) + ".tmp";
+    FILE* file = std::fopen(temp_file.c_str(), "wb");
+    if (nullptr == file)
+    {
+        logWarning(XMLPARSER, "Cannot write profiles cache file '" << temp_file << "'");
+        return false;
+    }
+
+    bool ret = std::fwrite(out.buffer().data(), 1, out.buffer().size(), file) == out.buffer().size();
+    ret = (0 == std::fclose(file)) && ret;
+    if (!ret || 0 != std::rename(temp_file.c_str(), cache_file.c_str()))
+    {
+        // Other process may have won the race to create the cache file
+        std::remove(temp_file.c_str());
+        return false;
+    }
+
+    logInfo(XMLPARSER, "Profiles cache file '" << cache_file << "' written");
+    return true;
+}
+
+} // namespace xmlparser
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,118 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file XMLProfileCache.hpp
+ */
+
+#ifndef _FASTRTPS_XMLPARSER_XMLPROFILECACHE_HPP_
+#define _FASTRTPS_XMLPARSER_XMLPROFILECACHE_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/attributes/LibrarySettingsAttributes.h>
+#include <fastrtps/xmlparser/XMLParser.h>
+#include <fastrtps/xmlparser/XMLTree.h>
+
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+namespace xmlparser {
+
+/**
+ * Binary cache of the profiles parsed from XML files.
+ *
+ * The cache is enabled by setting the environment variable FASTRTPS_PROFILES_CACHE_DIRECTORY to an existing
+ * directory. Each XML file is stored on a cache file named after the hash of its contents, so processes loading the
+ * same XML file share the cache entry, and modifying the file makes it miss.
+ *
+ * Only files whose parsing has no side effects other than creating profiles and setting the library settings are
+ * cached. Files with transport descriptors, dynamic types or log configuration are always parsed.
+ * @ingroup XMLPARSER_MODULE
+ */
+class XMLProfileCache
+{
+public:
+
+    /**
+     * Get the directory where the cache files are stored.
+     * @return The directory set on the environment, or an empty string if the cache is disabled.
+     */
+    static std::string cache_directory();
+
+    /**
+     * Read the contents of an XML file.
+     * @param filename Name of the file to read.
+     * @param contents String where the contents are stored.
+     * @return true if the file could be read.
+     */
+    static bool read_file(
+            const std::string& filename,
+            std::string& contents);
+
+    /**
+     * Get the name of the cache file for the given XML contents.
+     * @param directory Directory where the cache files are stored.
+     * @param contents Contents of the XML file.
+     * @return Name of the cache file.
+     */
+    static std::string cache_file(
+            const std::string& directory,
+            const std::string& contents);
+
+    /**
+     * Check whether a parsed document can be stored on the cache.
+     * @param document Document to check.
+     * @param has_library_settings Set to true when the document sets the library settings.
+     * @return true if loading the document only creates profiles and sets the library settings.
+     */
+    static bool is_cacheable(
+            tinyxml2::XMLDocument& document,
+            bool& has_library_settings);
+
+    /**
+     * Load the profiles of an XML file from its cache file.
+     * When the cache file has library settings, they are applied to the XMLProfileManager.
+     * @param cache_file Name of the cache file.
+     * @param contents Contents of the XML file.
+     * @param profiles Node where the profiles are loaded.
+     * @return true on a cache hit. false if the cache file does not exist, is corrupt or belongs to other contents.
+     */
+    static bool load(
+            const std::string& cache_file,
+            const std::string& contents,
+            up_base_node_t& profiles);
+
+    /**
+     * Store the profiles of an XML file on its cache file.
+     * Must be called before the profiles are extracted from the node.
+     * @param cache_file Name of the cache file.
+     * @param contents Contents of the XML file.
+     * @param profiles Node with the parsed profiles.
+     * @param library_settings Library settings set by the XML file, nullptr if the file does not set them.
+     * @return true if the cache file was written.
+     */
+    static bool store(
+            const std::string& cache_file,
+            const std::string& contents,
+            BaseNode& profiles,
+            const LibrarySettingsAttributes* library_settings);
+};
+
+} // namespace xmlparser
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTRTPS_XMLPARSER_XMLPROFILECACHE_HPP_
@@ -17,6 +17,8 @@
 #include <fastrtps/xmlparser/XMLTree.h>
 #include <fastdds/dds/log/Log.hpp>
 
+#include "XMLProfileCache.hpp"
+
 #include <cstdlib>
 #ifdef _WIN32
 #include <windows.h>
@@ -270,8 +272,41 @@ XMLP_ret XMLProfileManager::loadXMLFile(
         return XMLP_ret::XML_OK;
     }
 
+    // When the profiles cache is enabled, the file is read once to look for its cache entry and, on a miss, parsed
+    // from memory.
+    std::string contents;
+    std::string cache_file;
+    std::string cache_directory = XMLProfileCache::cache_directory();
+    if (!cache_directory.empty() && XMLProfileCache::read_file(filename, contents))
+    {
+        cache_file = XMLProfileCache::cache_file(cache_directory, contents);
+
+        up_base_node_t profiles_node;
+        if (XMLProfileCache::load(cache_file, contents, profiles_node))
+        {
+            logInfo(XMLPARSER, "File '" << filename << "' loaded from profiles cache '" << cache_file << "'");
+            return XMLProfileManager::extractProfiles(std::move(profiles_node), filename);
+        }
+    }
+
     up_base_node_t root_node;
-    XMLP_ret loaded_ret = XMLParser::loadXML(filename, root_node);
+    XMLP_ret loaded_ret = XMLP_ret::XML_ERROR;
+    bool cacheable = false;
+    bool has_library_settings = false;
+    if (cache_file.empty())
+    {
+        loaded_ret = XMLParser::loadXML(filename, root_node);
+    }
+    else
+    {
+        tinyxml2::XMLDocument xmlDoc;
+        if (tinyxml2::XMLError::XML_SUCCESS == xmlDoc.Parse(contents.c_str(), contents.size()))
+        {
+            cacheable = XMLProfileCache::is_cacheable(xmlDoc, has_library_settings);
+            loaded_ret = XMLParser::loadXML(xmlDoc, root_node);
+        }
+    }
+
     if (!root_node || loaded_ret != XMLP_ret::XML_OK)
     {
         if (filename != std::string(DEFAULT_FASTRTPS_PROFILES))
@@ -286,6 +321,11 @@ XMLP_ret XMLProfileManager::loadXMLFile(
 
     if (NodeType::PROFILES == root_node->getType())
     {
+        if (cacheable)
+        {
+            XMLProfileCache::store(cache_file, contents, *root_node,
+                    has_library_settings ? &library_settings_ : nullptr);
+        }
         return XMLProfileManager::extractProfiles(std::move(root_node), filename);
     }
 
@@ -300,6 +340,11 @@ XMLP_ret XMLProfileManager::loadXMLFile(
         {
             if (NodeType::PROFILES == child.get()->getType())
             {
+                if (cacheable)
+                {
+                    XMLProfileCache::store(cache_file, contents, *child,
+                            has_library_settings ? &library_settings_ : nullptr);
+                }
                 return XMLProfileManager::extractProfiles(std::move(child), filename);
             }
         }
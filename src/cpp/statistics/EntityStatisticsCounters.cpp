@@ -0,0 +1,113 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EntityStatisticsCounters.cpp
+ */
+
+#include <statistics/EntityStatisticsCounters.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+EntityStatisticsCounters::EntityStatisticsCounters(
+        const fastrtps::rtps::GUID_t& guid,
+        StatisticsEntityKind kind)
+    : guid_(guid)
+    , kind_(kind)
+    , latency_count_(0)
+    , latency_total_ns_(0)
+    , latency_max_ns_(0)
+{
+    for (std::atomic<uint64_t>& counter : counters_)
+    {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    for (std::atomic<uint64_t>& bucket : latency_buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void EntityStatisticsCounters::add_latency(
+        uint64_t latency_ns)
+{
+    uint64_t latency_us = latency_ns / 1000u;
+    size_t bucket = 0;
+    while (latency_us > 0 && bucket < LatencyHistogram::BUCKET_COUNT - 1)
+    {
+        latency_us >>= 1;
+        ++bucket;
+    }
+
+    latency_buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    latency_count_.fetch_add(1, std::memory_order_relaxed);
+    latency_total_ns_.fetch_add(latency_ns, std::memory_order_relaxed);
+
+    uint64_t current_max = latency_max_ns_.load(std::memory_order_relaxed);
+    while (current_max < latency_ns &&
+            !latency_max_ns_.compare_exchange_weak(current_max, latency_ns, std::memory_order_relaxed))
+    {
+    }
+}
+
+void EntityStatisticsCounters::add_latency(
+        const fastrtps::rtps::Time_t& source,
+        const fastrtps::rtps::Time_t& reception)
+{
+    int64_t latency_ns = reception.to_ns() - source.to_ns();
+    if (latency_ns >= 0)
+    {
+        add_latency(static_cast<uint64_t>(latency_ns));
+    }
+}
+
+void EntityStatisticsCounters::snapshot(
+        EntityStatistics& statistics) const
+{
+    statistics.guid = guid_;
+    statistics.kind = kind_;
+
+    statistics.messages_sent = get(StatisticsCounter::MESSAGES_SENT);
+    statistics.bytes_sent = get(StatisticsCounter::BYTES_SENT);
+    statistics.messages_received = get(StatisticsCounter::MESSAGES_RECEIVED);
+    statistics.bytes_received = get(StatisticsCounter::BYTES_RECEIVED);
+    statistics.messages_discarded = get(StatisticsCounter::MESSAGES_DISCARDED);
+    statistics.data_sent = get(StatisticsCounter::DATA_SENT);
+    statistics.data_frags_sent = get(StatisticsCounter::DATA_FRAGS_SENT);
+    statistics.data_resent = get(StatisticsCounter::DATA_RESENT);
+    statistics.heartbeats_sent = get(StatisticsCounter::HEARTBEATS_SENT);
+    statistics.gaps_sent = get(StatisticsCounter::GAPS_SENT);
+    statistics.acknacks_received = get(StatisticsCounter::ACKNACKS_RECEIVED);
+    statistics.nackfrags_received = get(StatisticsCounter::NACKFRAGS_RECEIVED);
+    statistics.data_received = get(StatisticsCounter::DATA_RECEIVED);
+    statistics.payload_bytes_received = get(StatisticsCounter::PAYLOAD_BYTES_RECEIVED);
+    statistics.data_rejected = get(StatisticsCounter::DATA_REJECTED);
+    statistics.heartbeats_received = get(StatisticsCounter::HEARTBEATS_RECEIVED);
+    statistics.acknacks_sent = get(StatisticsCounter::ACKNACKS_SENT);
+    statistics.nackfrags_sent = get(StatisticsCounter::NACKFRAGS_SENT);
+
+    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i)
+    {
+        statistics.latency.buckets[i] = latency_buckets_[i].load(std::memory_order_relaxed);
+    }
+    statistics.latency.count = latency_count_.load(std::memory_order_relaxed);
+    statistics.latency.total_ns = latency_total_ns_.load(std::memory_order_relaxed);
+    statistics.latency.max_ns = latency_max_ns_.load(std::memory_order_relaxed);
+}
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,150 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EntityStatisticsCounters.hpp
+ */
+
+#ifndef _FASTDDS_STATISTICS_ENTITYSTATISTICSCOUNTERS_HPP_
+#define _FASTDDS_STATISTICS_ENTITYSTATISTICSCOUNTERS_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/statistics/EntityStatistics.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Counters kept for each entity. Each one is mapped to a field of EntityStatistics.
+ */
+enum class StatisticsCounter : size_t
+{
+    MESSAGES_SENT,
+    BYTES_SENT,
+    MESSAGES_RECEIVED,
+    BYTES_RECEIVED,
+    MESSAGES_DISCARDED,
+    DATA_SENT,
+    DATA_FRAGS_SENT,
+    DATA_RESENT,
+    HEARTBEATS_SENT,
+    GAPS_SENT,
+    ACKNACKS_RECEIVED,
+    NACKFRAGS_RECEIVED,
+    DATA_RECEIVED,
+    PAYLOAD_BYTES_RECEIVED,
+    DATA_REJECTED,
+    HEARTBEATS_RECEIVED,
+    ACKNACKS_SENT,
+    NACKFRAGS_SENT,
+
+    COUNT
+};
+
+/**
+ * Performance counters of an entity.
+ * All the methods are lock-free, so they can be called from any thread without taking the mutex of the entity.
+ * Relaxed ordering is used, as each counter is independent from the others.
+ */
+class EntityStatisticsCounters
+{
+public:
+
+    EntityStatisticsCounters(
+            const fastrtps::rtps::GUID_t& guid,
+            StatisticsEntityKind kind);
+
+    // Non-copyable
+    EntityStatisticsCounters(
+            const EntityStatisticsCounters&) = delete;
+    EntityStatisticsCounters& operator =(
+            const EntityStatisticsCounters&) = delete;
+
+    const fastrtps::rtps::GUID_t& guid() const
+    {
+        return guid_;
+    }
+
+    StatisticsEntityKind kind() const
+    {
+        return kind_;
+    }
+
+    /**
+     * Increment a counter.
+     * @param counter Counter to increment.
+     * @param value Value to add to the counter.
+     */
+    void add(
+            StatisticsCounter counter,
+            uint64_t value = 1)
+    {
+        counters_[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * Add a latency to the histogram.
+     * @param latency_ns Latency in nanoseconds.
+     */
+    void add_latency(
+            uint64_t latency_ns);
+
+    /**
+     * Add to the histogram the latency between two timestamps. Negative latencies, caused by clocks not in sync,
+     * are ignored.
+     * @param source Time the sample was sent.
+     * @param reception Time the sample was received.
+     */
+    void add_latency(
+            const fastrtps::rtps::Time_t& source,
+            const fastrtps::rtps::Time_t& reception);
+
+    /**
+     * Copy the current value of the counters.
+     * @param statistics Snapshot to fill.
+     */
+    void snapshot(
+            EntityStatistics& statistics) const;
+
+private:
+
+    uint64_t get(
+            StatisticsCounter counter) const
+    {
+        return counters_[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+    }
+
+    const fastrtps::rtps::GUID_t guid_;
+    const StatisticsEntityKind kind_;
+
+    std::atomic<uint64_t> counters_[static_cast<size_t>(StatisticsCounter::COUNT)];
+
+    std::atomic<uint64_t> latency_buckets_[LatencyHistogram::BUCKET_COUNT];
+    std::atomic<uint64_t> latency_count_;
+    std::atomic<uint64_t> latency_total_ns_;
+    std::atomic<uint64_t> latency_max_ns_;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_STATISTICS_ENTITYSTATISTICSCOUNTERS_HPP_
@@ -0,0 +1,88 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsProbes.hpp
+ *
+ * Macros used to update the statistics counters.
+ * When the library is built without FASTDDS_STATISTICS, they expand to nothing and their arguments are not evaluated.
+ */
+
+#ifndef _FASTDDS_STATISTICS_STATISTICSPROBES_HPP_
+#define _FASTDDS_STATISTICS_STATISTICSPROBES_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/config.h>
+
+#if HAVE_FASTDDS_STATISTICS
+
+#include <statistics/EntityStatisticsCounters.hpp>
+
+/**
+ * Add a value to a counter.
+ * @param counters Pointer to the EntityStatisticsCounters of the entity. May be nullptr.
+ * @param counter Name of the StatisticsCounter to update.
+ * @param value Value to add.
+ */
+#define FASTDDS_STATISTICS_ADD(counters, counter, value) \
+    do { \
+        eprosima::fastdds::statistics::EntityStatisticsCounters* statistics_counters__ = (counters); \
+        if (nullptr != statistics_counters__) \
+        { \
+            statistics_counters__->add(eprosima::fastdds::statistics::StatisticsCounter::counter, (value)); \
+        } \
+    } while (0)
+
+/**
+ * Add the latency between two timestamps to the histogram of an entity.
+ * @param counters Pointer to the EntityStatisticsCounters of the entity. May be nullptr.
+ * @param source Time the sample was sent.
+ * @param reception Time the sample was received.
+ */
+#define FASTDDS_STATISTICS_LATENCY(counters, source, reception) \
+    do { \
+        eprosima::fastdds::statistics::EntityStatisticsCounters* statistics_counters__ = (counters); \
+        if (nullptr != statistics_counters__) \
+        { \
+            statistics_counters__->add_latency((source), (reception)); \
+        } \
+    } while (0)
+
+/**
+ * Account for a sample added to the history of a reader.
+ * @param counters Pointer to the EntityStatisticsCounters of the reader. May be nullptr.
+ * @param change Pointer to the CacheChange_t, with its reception timestamp already set.
+ */
+#define FASTDDS_STATISTICS_CHANGE_RECEIVED(counters, change) \
+    do { \
+        eprosima::fastdds::statistics::EntityStatisticsCounters* statistics_counters__ = (counters); \
+        if (nullptr != statistics_counters__) \
+        { \
+            statistics_counters__->add(eprosima::fastdds::statistics::StatisticsCounter::DATA_RECEIVED); \
+            statistics_counters__->add(eprosima::fastdds::statistics::StatisticsCounter::PAYLOAD_BYTES_RECEIVED, \
+                (change)->serializedPayload.length); \
+            statistics_counters__->add_latency((change)->sourceTimestamp, (change)->receptionTimestamp); \
+        } \
+    } while (0)
+
+#else
+
+#define FASTDDS_STATISTICS_ADD(counters, counter, value) do {} while (0)
+#define FASTDDS_STATISTICS_LATENCY(counters, source, reception) do {} while (0)
+#define FASTDDS_STATISTICS_CHANGE_RECEIVED(counters, change) do {} while (0)
+
+#endif // if HAVE_FASTDDS_STATISTICS
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_STATISTICS_STATISTICSPROBES_HPP_
@@ -0,0 +1,65 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsRegistry.cpp
+ */
+
+#include <statistics/StatisticsRegistry.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+EntityStatisticsCounters* StatisticsRegistry::register_entity(
+        const fastrtps::rtps::GUID_t& guid,
+        StatisticsEntityKind kind)
+{
+    std::unique_ptr<EntityStatisticsCounters> counters(new EntityStatisticsCounters(guid, kind));
+    EntityStatisticsCounters* ret_val = counters.get();
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    entities_.push_back(std::move(counters));
+    return ret_val;
+}
+
+void StatisticsRegistry::unregister_entity(
+        EntityStatisticsCounters* counters)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto it = entities_.begin(); it != entities_.end(); ++it)
+    {
+        if (it->get() == counters)
+        {
+            entities_.erase(it);
+            break;
+        }
+    }
+}
+
+void StatisticsRegistry::snapshot(
+        std::vector<EntityStatistics>& statistics) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    statistics.clear();
+    statistics.resize(entities_.size());
+    for (size_t i = 0; i < entities_.size(); ++i)
+    {
+        entities_[i]->snapshot(statistics[i]);
+    }
+}
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,77 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsRegistry.hpp
+ */
+
+#ifndef _FASTDDS_STATISTICS_STATISTICSREGISTRY_HPP_
+#define _FASTDDS_STATISTICS_STATISTICSREGISTRY_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <statistics/EntityStatisticsCounters.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Keeps the counters of all the entities of a participant.
+ * The mutex is only taken when entities are created or deleted, and when a snapshot is requested. Entities update
+ * their counters directly through the pointer returned by register_entity.
+ */
+class StatisticsRegistry
+{
+public:
+
+    /**
+     * Create the counters of an entity.
+     * @param guid GUID of the entity.
+     * @param kind Kind of the entity.
+     * @return Pointer to the counters, valid until unregister_entity is called.
+     */
+    EntityStatisticsCounters* register_entity(
+            const fastrtps::rtps::GUID_t& guid,
+            StatisticsEntityKind kind);
+
+    /**
+     * Delete the counters of an entity.
+     * @param counters Pointer returned by register_entity.
+     */
+    void unregister_entity(
+            EntityStatisticsCounters* counters);
+
+    /**
+     * Get the current value of the counters of all the entities.
+     * @param statistics Vector where the snapshots are stored. Previous contents are removed.
+     */
+    void snapshot(
+            std::vector<EntityStatistics>& statistics) const;
+
+private:
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<EntityStatisticsCounters>> entities_;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_STATISTICS_STATISTICSREGISTRY_HPP_
@@ -0,0 +1,194 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file lock_free_ring.hpp
+ */
+
+#ifndef _FASTRTPS_UTILS_LOCK_FREE_RING_H_
+#define _FASTRTPS_UTILS_LOCK_FREE_RING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * @brief LockFreeRing. A bounded, lock-free ring buffer.
+ *
+ * Multiple producers, multiple consumers. Every cell carries a sequence number that tells producers and
+ * consumers whether it is ready to be written or read, so push and pop only need one compare and swap on the
+ * shared position in the uncontended case, and never block.
+ *
+ * All the memory is allocated on construction. Capacity is rounded up to the next power of two.
+ *
+ * @tparam T Type of the stored elements. Should be cheap to copy (i.e. pointers or indexes).
+ */
+template<typename T>
+class LockFreeRing final
+{
+    static_assert(std::is_trivially_copyable<T>::value, "LockFreeRing only stores trivially copyable types");
+
+public:
+
+    /**
+     * @brief Construct a ring.
+     * @param min_capacity Minimum number of elements the ring should be able to hold.
+     */
+    explicit LockFreeRing(
+            size_t min_capacity)
+    {
+        size_t capacity = 2;
+        while (capacity < min_capacity)
+        {
+            capacity <<= 1;
+        }
+
+        mask_ = capacity - 1;
+        cells_.reset(new Cell[capacity]);
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos_.store(0, std::memory_order_relaxed);
+        dequeue_pos_.store(0, std::memory_order_relaxed);
+    }
+
+    // not-copyable
+    LockFreeRing(
+            const LockFreeRing&) = delete;
+
+    LockFreeRing& operator =(
+            const LockFreeRing&) = delete;
+
+    /**
+     * @brief Add an element to the ring.
+     * @param value Element to add.
+     * @return false when the ring is full.
+     */
+    bool push(
+            const T& value)
+    {
+        Cell* cell;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest element from the ring.
+     * @param [out] value Where the element is copied.
+     * @return false when the ring is empty.
+     */
+    bool pop(
+            T& value)
+    {
+        Cell* cell;
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        value = cell->data;
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return Maximum number of elements the ring can hold.
+     */
+    size_t capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    /**
+     * @return Number of elements on the ring. Only accurate when there are no concurrent operations.
+     */
+    size_t size_approx() const
+    {
+        size_t enqueued = enqueue_pos_.load(std::memory_order_relaxed);
+        size_t dequeued = dequeue_pos_.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+private:
+
+    //! Size of padding to keep positions on different cache lines.
+    static constexpr size_t cache_line_size = 64;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    char pad0_[cache_line_size];
+    std::atomic<size_t> enqueue_pos_;
+    char pad1_[cache_line_size];
+    std::atomic<size_t> dequeue_pos_;
+    char pad2_[cache_line_size];
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // _FASTRTPS_UTILS_LOCK_FREE_RING_H_
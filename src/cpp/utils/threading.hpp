@@ -0,0 +1,158 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_THREADING_HPP_
+#define UTILS_THREADING_HPP_
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastrtps/utils/thread.hpp>
+
+#include <string>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <climits>
+#include <pthread.h>
+#include <sched.h>
+#endif // if defined(_WIN32)
+
+namespace eprosima {
+
+/**
+ * Give a name to the calling thread and apply the settings to it.
+ * Settings that cannot be applied are reported with a warning.
+ * @param name Name of the thread. Truncated to 15 characters on Linux.
+ * @param settings Settings to apply.
+ */
+inline void apply_thread_settings_to_current_thread(
+        const std::string& name,
+        const fastdds::rtps::ThreadSettings& settings)
+{
+    static const fastdds::rtps::ThreadSettings default_settings;
+
+#if defined(_WIN32)
+    if (settings.priority != default_settings.priority)
+    {
+        if (0 == SetThreadPriority(GetCurrentThread(), settings.priority))
+        {
+            logWarning(SYSTEM, "Cannot set priority " << settings.priority << " of thread " << name);
+        }
+    }
+
+    if (settings.affinity != default_settings.affinity)
+    {
+        if (0 == SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(settings.affinity)))
+        {
+            logWarning(SYSTEM, "Cannot set affinity " << settings.affinity << " of thread " << name);
+        }
+    }
+#else
+#if defined(__linux__)
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#elif defined(__APPLE__)
+    pthread_setname_np(name.c_str());
+#endif // if defined(__linux__)
+
+    if (settings.scheduling_policy != default_settings.scheduling_policy ||
+            settings.priority != default_settings.priority)
+    {
+        int policy = 0;
+        sched_param param;
+        int result = pthread_getschedparam(pthread_self(), &policy, &param);
+        if (0 == result)
+        {
+            if (settings.scheduling_policy != default_settings.scheduling_policy)
+            {
+                policy = settings.scheduling_policy;
+            }
+            if (settings.priority != default_settings.priority)
+            {
+                param.sched_priority = settings.priority;
+            }
+            result = pthread_setschedparam(pthread_self(), policy, &param);
+        }
+
+        if (0 != result)
+        {
+            logWarning(SYSTEM, "Cannot set scheduling policy " << settings.scheduling_policy << " and priority " <<
+                    settings.priority << " of thread " << name << ". Error " << result);
+        }
+    }
+
+    if (settings.affinity != default_settings.affinity)
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (uint32_t cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (settings.affinity & (static_cast<uint64_t>(1) << cpu))
+            {
+                CPU_SET(cpu, &cpu_set);
+            }
+        }
+
+        int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        if (0 != result)
+        {
+            logWarning(SYSTEM, "Cannot set affinity " << settings.affinity << " of thread " << name << ". Error " <<
+                    result);
+        }
+#else
+        logWarning(SYSTEM, "Thread affinity is not supported on this platform. Ignored for thread " << name);
+#endif // if defined(__linux__)
+    }
+#endif // if defined(_WIN32)
+}
+
+/**
+ * Start a thread with the given settings.
+ * The stack size is set on the attributes the thread is created with. The thread gets its name and applies the rest
+ * of the settings before calling the functor. Problems are reported from the new thread, so this can be called while
+ * holding the log mutex.
+ * @param func Functor run by the thread.
+ * @param settings Settings of the thread.
+ * @param name Name of the thread. Truncated to 15 characters on Linux.
+ * @return the started thread.
+ */
+template<typename Functor>
+eprosima::thread create_thread(
+        Functor func,
+        const fastdds::rtps::ThreadSettings& settings,
+        const std::string& name)
+{
+#if defined(_WIN32)
+    bool stack_size_applied = settings.stack_size <= 0;
+#else
+    bool stack_size_applied = (settings.stack_size <= 0) ||
+            (static_cast<size_t>(settings.stack_size) >= static_cast<size_t>(PTHREAD_STACK_MIN));
+#endif // if defined(_WIN32)
+
+    return eprosima::thread(stack_size_applied ? settings.stack_size : -1,
+                   [func, settings, name, stack_size_applied]() mutable
+                   {
+                       if (!stack_size_applied)
+                       {
+                           logWarning(SYSTEM, "Cannot set stack size " << settings.stack_size << " of thread " << name);
+                       }
+                       apply_thread_settings_to_current_thread(name, settings);
+                       func();
+                   });
+}
+
+} // namespace eprosima
+
+#endif // UTILS_THREADING_HPP_
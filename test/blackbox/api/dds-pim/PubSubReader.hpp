@@ -1088,6 +1088,11 @@ public:
         return false;
     }
 
+    eprosima::fastdds::dds::DataReader& get_native_reader() const
+    {
+        return *datareader_;
+    }
+
     unsigned int missed_deadlines() const
     {
         return listener_.missed_deadlines();
@@ -755,6 +755,18 @@ public:
         return *this;
     }
 
+    PubSubWriter& batching(
+            uint32_t max_samples,
+            uint32_t max_bytes,
+            const eprosima::fastrtps::Duration_t& max_flush_delay)
+    {
+        datawriter_qos_.batching().enabled = true;
+        datawriter_qos_.batching().max_samples = max_samples;
+        datawriter_qos_.batching().max_bytes = max_bytes;
+        datawriter_qos_.batching().max_flush_delay = max_flush_delay;
+        return *this;
+    }
+
     PubSubWriter& history_kind(
             const eprosima::fastrtps::HistoryQosPolicyKind kind)
     {
@@ -0,0 +1,143 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+class DDSBatching : public testing::TestWithParam<bool>
+{
+public:
+
+    void SetUp() override
+    {
+        LibrarySettingsAttributes library_settings;
+        if (GetParam())
+        {
+            library_settings.intraprocess_delivery = IntraprocessDeliveryType::INTRAPROCESS_FULL;
+            xmlparser::XMLProfileManager::library_settings(library_settings);
+        }
+    }
+
+    void TearDown() override
+    {
+        LibrarySettingsAttributes library_settings;
+        if (GetParam())
+        {
+            library_settings.intraprocess_delivery = IntraprocessDeliveryType::INTRAPROCESS_OFF;
+            xmlparser::XMLProfileManager::library_settings(library_settings);
+        }
+    }
+
+};
+
+// Samples that do not fill a batch are sent when max_flush_delay expires.
+TEST_P(DDSBatching, BestEffortFlushDelay)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).
+            batching(4, 0, Duration_t(0, 10 * 1000 * 1000)).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    reader.startReception(data);
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+}
+
+// Without flush delay, the last incomplete batch is sent when waiting for acknowledgments.
+// The reader is best-effort, so the samples kept on the batch would not be repaired if they were not flushed.
+TEST_P(DDSBatching, ReliableFlushOnWaitForAcks)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+            batching(4, 0, c_TimeInfinite).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    reader.startReception(data);
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(3)));
+    EXPECT_EQ(reader.block_for_all(std::chrono::seconds(3)), 10u);
+}
+
+// A batch bigger than what a single send handles is sent completely, without waiting for the next batch.
+TEST_P(DDSBatching, BestEffortBatchAboveMessageSize)
+{
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(20).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).
+            socket_buffer_size(1048576).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    // 12 samples of 16KB, well above the 64KB a single send handles
+    writer.history_depth(20).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).
+            batching(12, 0, c_TimeInfinite).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data16kb_data_generator(12);
+    reader.startReception(data);
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    EXPECT_EQ(reader.block_for_all(std::chrono::seconds(3)), 12u);
+}
+
+INSTANTIATE_TEST_CASE_P(DDSBatching,
+        DDSBatching,
+        testing::Values(false, true),
+        [](const testing::TestParamInfo<DDSBatching::ParamType>& info)
+        {
+            if (info.param)
+            {
+                return "Intraprocess";
+            }
+            return "NonIntraprocess";
+        });
@@ -17,10 +17,14 @@
 #include "PubSubParticipant.hpp"
 #include "PubSubReader.hpp"
 #include "PubSubWriter.hpp"
+#include <fastdds/dds/core/conditions/StatusCondition.hpp>
+#include <fastdds/dds/core/conditions/WaitSet.hpp>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
@@ -137,6 +141,66 @@ TEST_P(DDSDataReader, LivelinessChangedStatusGet)
 
 }
 
+/*
+ * Takes one sample each time the data_available status triggers, while the writer is still sending. The status must
+ * stay triggered while there are unread samples, including the ones received during the take.
+ */
+TEST_P(DDSDataReader, DataAvailableWithConcurrentTakes)
+{
+    static constexpr size_t num_samples = 200u;
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    reader.reliability(RELIABLE_RELIABILITY_QOS)
+    .history_kind(KEEP_ALL_HISTORY_QOS);
+    reader.init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    writer.reliability(RELIABLE_RELIABILITY_QOS)
+    .history_kind(KEEP_ALL_HISTORY_QOS);
+    writer.init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    eprosima::fastdds::dds::StatusCondition& condition = reader.get_native_reader().get_statuscondition();
+    ASSERT_EQ(condition.set_enabled_statuses(eprosima::fastdds::dds::StatusMask::data_available()),
+            ReturnCode_t::RETCODE_OK);
+    eprosima::fastdds::dds::WaitSet wait_set;
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+
+    std::thread writing_thread([&writer]()
+            {
+                auto data = default_helloworld_data_generator(num_samples);
+                for (HelloWorld& sample : data)
+                {
+                    writer.send_sample(sample);
+                }
+            });
+
+    size_t num_taken = 0;
+    while (num_taken < num_samples)
+    {
+        eprosima::fastdds::dds::ConditionSeq active_conditions;
+        if (ReturnCode_t::RETCODE_OK != wait_set.wait(active_conditions, Duration_t(5, 0)))
+        {
+            break;
+        }
+
+        HelloWorld sample;
+        if (reader.takeNextData(&sample))
+        {
+            ++num_taken;
+        }
+    }
+
+    writing_thread.join();
+    EXPECT_EQ(num_taken, num_samples);
+
+    ASSERT_EQ(wait_set.detach_condition(condition), ReturnCode_t::RETCODE_OK);
+}
+
 INSTANTIATE_TEST_CASE_P(DDSDataReader,
         DDSDataReader,
         testing::Values(false, true),
@@ -58,19 +58,22 @@ public:
      */
     ReaderLocator(
             RTPSWriter* /*owner*/,
-            size_t /*max_unicast_locators*/,
-            size_t /*max_multicast_locators*/)
+            size_t max_unicast_locators,
+            size_t max_multicast_locators)
+        : locator_info_(max_unicast_locators, max_multicast_locators)
+        , guid_prefix_as_vector_(1u)
+        , guid_as_vector_(1u)
     {
     }
 
     LocatorSelectorEntry* locator_selector_entry()
     {
-        return nullptr;
+        return &locator_info_;
     }
 
     const GUID_t& remote_guid() const
     {
-        return remote_guid_;
+        return locator_info_.remote_guid;
     }
 
     /**
@@ -84,12 +87,22 @@ public:
      * @return false when this object was already started, true otherwise.
      */
     bool start(
-            const GUID_t& /*remote_guid*/,
-            const ResourceLimitedVector<Locator_t>& /*unicast_locators*/,
-            const ResourceLimitedVector<Locator_t>& /*multicast_locators*/,
+            const GUID_t& remote_guid,
+            const ResourceLimitedVector<Locator_t>& unicast_locators,
+            const ResourceLimitedVector<Locator_t>& multicast_locators,
             bool /*expects_inline_qos*/)
     {
-        return true;
+        if (locator_info_.remote_guid == c_Guid_Unknown)
+        {
+            locator_info_.remote_guid = remote_guid;
+            locator_info_.unicast = unicast_locators;
+            locator_info_.multicast = multicast_locators;
+            guid_as_vector_.at(0) = remote_guid;
+            guid_prefix_as_vector_.at(0) = remote_guid.guidPrefix;
+            return true;
+        }
+
+        return false;
     }
 
     /**
@@ -117,9 +130,19 @@ public:
      * @return true if this object was started for remote_guid, false otherwise.
      */
     bool stop(
-            const GUID_t& /*remote_guid*/)
+            const GUID_t& remote_guid)
     {
-        return true;
+        if (locator_info_.remote_guid == remote_guid)
+        {
+            locator_info_.unicast.clear();
+            locator_info_.multicast.clear();
+            locator_info_.remote_guid = c_Guid_Unknown;
+            guid_as_vector_.at(0) = c_Guid_Unknown;
+            guid_prefix_as_vector_.at(0) = c_GuidPrefix_Unknown;
+            return true;
+        }
+
+        return false;
     }
 
     /**
@@ -141,7 +164,7 @@ public:
      */
     GuidPrefix_t destination_guid_prefix() const override
     {
-        return remote_guid_.guidPrefix;
+        return locator_info_.remote_guid.guidPrefix;
     }
 
     /**
@@ -168,10 +191,12 @@ public:
      * Send a message through this interface.
      *
      * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers Gather list describing the message.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
             CDRMessage_t* /*message*/,
+            const std::vector<NetworkBuffer>& /*buffers*/,
             std::chrono::steady_clock::time_point& /*max_blocking_time_point*/) const override
     {
         return true;
@@ -189,7 +214,7 @@ public:
 
 private:
 
-    GUID_t remote_guid_;
+    LocatorSelectorEntry locator_info_;
     std::vector<GuidPrefix_t> guid_prefix_as_vector_;
     std::vector<GUID_t> guid_as_vector_;
 };
@@ -37,6 +37,7 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
 
     RTPS_DllAPI SharedMemTransportDescriptor()
     : TransportDescriptorInterface(0, 0)
+    , busy_poll_us_(0)
     {
 
     }
@@ -99,6 +100,39 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
         healthy_check_timeout_ms_ = healthy_check_timeout_ms;
     }
 
+    RTPS_DllAPI uint32_t busy_poll_us() const
+    {
+        return busy_poll_us_;
+    }
+
+    RTPS_DllAPI void busy_poll_us(
+            uint32_t busy_poll_us)
+    {
+        busy_poll_us_ = busy_poll_us;
+    }
+
+    RTPS_DllAPI uint32_t buffer_slab_size() const
+    {
+        return buffer_slab_size_;
+    }
+
+    RTPS_DllAPI void buffer_slab_size(
+            uint32_t buffer_slab_size)
+    {
+        buffer_slab_size_ = buffer_slab_size;
+    }
+
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
     RTPS_DllAPI std::string rtps_dump_file() const
     {
         return rtps_dump_file_;
@@ -115,6 +149,9 @@ private:
     uint32_t segment_size_;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
+    uint32_t busy_poll_us_;
+    uint32_t buffer_slab_size_;
+    bool huge_pages_;
     std::string rtps_dump_file_;
 
 }SharedMemTransportDescriptor;
@@ -18,6 +18,7 @@
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/attributes/ReaderAttributes.h>
 #include <fastrtps/rtps/common/Guid.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -99,6 +100,7 @@ public:
 
     bool send_sync_nts(
             CDRMessage_t* /*message*/,
+            const std::vector<NetworkBuffer>& /*buffers*/,
             const LocatorsIterator& /*destination_locators_begin*/,
             const LocatorsIterator& /*destination_locators_end*/,
             std::chrono::steady_clock::time_point& /*max_blocking_time_point*/)
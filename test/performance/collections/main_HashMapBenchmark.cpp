@@ -0,0 +1,261 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_HashMapBenchmark.cpp
+ *
+ * Compares ResourceLimitedHashMap with std::map and std::unordered_map on the operations performed by the
+ * discovery tables: insertion, successful and failed lookups, iteration and removal.
+ */
+
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastrtps/utils/collections/ResourceLimitedHashMap.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+struct EntityIdLess
+{
+    bool operator ()(
+            const EntityId_t& lhs,
+            const EntityId_t& rhs) const
+    {
+        return memcmp(lhs.value, rhs.value, EntityId_t::size) < 0;
+    }
+
+};
+
+struct GuidPrefixLess
+{
+    bool operator ()(
+            const GuidPrefix_t& lhs,
+            const GuidPrefix_t& rhs) const
+    {
+        return memcmp(lhs.value, rhs.value, GuidPrefix_t::size) < 0;
+    }
+
+};
+
+struct Results
+{
+    double insert = 0;
+    double hit = 0;
+    double miss = 0;
+    double iterate = 0;
+    double erase = 0;
+};
+
+// Prevents the compiler from removing the benchmarked loops
+static volatile uintptr_t sink;
+
+template<typename Key>
+static void generate_key(
+        std::mt19937& gen,
+        Key& key)
+{
+    for (auto& octet : key.value)
+    {
+        octet = static_cast<eprosima::fastrtps::rtps::octet>(gen());
+    }
+}
+
+template<typename Map>
+static void insert_element(
+        Map& map,
+        const typename Map::key_type& key,
+        void* value)
+{
+    map.emplace(key, value);
+}
+
+template<typename Key>
+static void insert_element(
+        ResourceLimitedHashMap<Key, void*>& map,
+        const Key& key,
+        void* value)
+{
+    map.try_emplace(key, value);
+}
+
+template<typename Map, typename Key>
+static void run_benchmark(
+        const std::vector<Key>& keys,
+        const std::vector<Key>& missing,
+        uint32_t iterations,
+        std::function<Map()> factory,
+        Results& results)
+{
+    using clock = std::chrono::steady_clock;
+    using ns = std::chrono::duration<double, std::nano>;
+
+    for (uint32_t it = 0; it < iterations; ++it)
+    {
+        Map map = factory();
+        uintptr_t acc = 0;
+
+        auto t0 = clock::now();
+        for (const Key& key : keys)
+        {
+            insert_element(map, key, &acc);
+        }
+        auto t1 = clock::now();
+        for (const Key& key : keys)
+        {
+            acc += reinterpret_cast<uintptr_t>(map.find(key)->second);
+        }
+        auto t2 = clock::now();
+        for (const Key& key : missing)
+        {
+            acc += map.find(key) == map.end() ? 1u : 0u;
+        }
+        auto t3 = clock::now();
+        for (const auto& pair : map)
+        {
+            acc += reinterpret_cast<uintptr_t>(pair.second);
+        }
+        auto t4 = clock::now();
+        for (const Key& key : keys)
+        {
+            acc += map.erase(key);
+        }
+        auto t5 = clock::now();
+
+        sink = acc;
+        double count = static_cast<double>(keys.size()) * iterations;
+        results.insert += ns(t1 - t0).count() / count;
+        results.hit += ns(t2 - t1).count() / count;
+        results.miss += ns(t3 - t2).count() / count;
+        results.iterate += ns(t4 - t3).count() / count;
+        results.erase += ns(t5 - t4).count() / count;
+    }
+}
+
+static void print_results(
+        const char* name,
+        const Results& results)
+{
+    std::cout << std::setw(32) << name
+              << std::setw(10) << results.insert
+              << std::setw(10) << results.hit
+              << std::setw(10) << results.miss
+              << std::setw(10) << results.iterate
+              << std::setw(10) << results.erase << std::endl;
+}
+
+template<typename Key, typename Less>
+static void run_all(
+        const char* key_name,
+        uint32_t size,
+        uint32_t iterations)
+{
+    std::mt19937 gen(size);
+    std::vector<Key> keys(size);
+    std::vector<Key> missing(size);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        generate_key(gen, keys[i]);
+        generate_key(gen, missing[i]);
+    }
+
+    std::cout << std::endl << key_name << " keys, " << size << " elements (ns per element)" << std::endl;
+    std::cout << std::setw(32) << "Container" << std::setw(10) << "Insert" << std::setw(10) << "Hit"
+              << std::setw(10) << "Miss" << std::setw(10) << "Iterate" << std::setw(10) << "Erase" << std::endl;
+
+    Results std_map;
+    run_benchmark<std::map<Key, void*, Less>, Key>(keys, missing, iterations,
+            []()
+            {
+                return std::map<Key, void*, Less>();
+            }, std_map);
+    print_results("std::map", std_map);
+
+    Results std_unordered_map;
+    run_benchmark<std::unordered_map<Key, void*>, Key>(keys, missing, iterations,
+            [size]()
+            {
+                std::unordered_map<Key, void*> map;
+                map.reserve(size);
+                return map;
+            }, std_unordered_map);
+    print_results("std::unordered_map", std_unordered_map);
+
+    Results dynamic;
+    run_benchmark<ResourceLimitedHashMap<Key, void*>, Key>(keys, missing, iterations,
+            []()
+            {
+                return ResourceLimitedHashMap<Key, void*>(
+                    ResourceLimitedContainerConfig::dynamic_allocation_configuration(16u));
+            }, dynamic);
+    print_results("ResourceLimitedHashMap", dynamic);
+
+    Results preallocated;
+    run_benchmark<ResourceLimitedHashMap<Key, void*>, Key>(keys, missing, iterations,
+            [size]()
+            {
+                return ResourceLimitedHashMap<Key, void*>(
+                    ResourceLimitedContainerConfig::fixed_size_configuration(size));
+            }, preallocated);
+    print_results("ResourceLimitedHashMap (fixed)", preallocated);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    std::vector<uint32_t> sizes = { 8, 64, 1024 };
+    uint32_t iterations = 1000;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            iterations = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+        {
+            sizes = { static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)) };
+        }
+        else
+        {
+            std::cout << "Usage: HashMapBenchmark [--iterations <n>] [--size <elements>]" << std::endl;
+            return -1;
+        }
+    }
+
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (uint32_t size : sizes)
+    {
+        run_all<EntityId_t, EntityIdLess>("EntityId_t", size, iterations);
+        run_all<GuidPrefix_t, GuidPrefixLess>("GuidPrefix_t", size, iterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,298 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryBenchmark.cpp
+ *
+ * Measures the time needed for a set of participants, each one with the same number of readers and writers, to
+ * discover all the remote endpoints, and the time needed to process the removal of the endpoints of a participant.
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/participant/RTPSParticipantListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/ReaderQos.h>
+#include <fastrtps/qos/WriterQos.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static std::mutex g_mutex;
+static std::condition_variable g_cv;
+
+class BenchmarkParticipant : public RTPSParticipantListener
+{
+public:
+
+    ~BenchmarkParticipant()
+    {
+        if (participant_ != nullptr)
+        {
+            RTPSDomain::removeRTPSParticipant(participant_);
+        }
+    }
+
+    bool init(
+            uint32_t domain,
+            uint32_t endpoints)
+    {
+        RTPSParticipantAttributes attributes;
+        attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+        participant_ = RTPSDomain::createParticipant(domain, attributes, this);
+        if (participant_ == nullptr)
+        {
+            return false;
+        }
+
+        HistoryAttributes history_attributes;
+        history_attributes.payloadMaxSize = 255;
+        history_attributes.initialReservedCaches = 1;
+
+        for (uint32_t i = 0; i < endpoints; ++i)
+        {
+            TopicAttributes topic;
+            topic.topicKind = NO_KEY;
+            topic.topicDataType = "DiscoveryBenchmarkType";
+            topic.topicName = "DiscoveryBenchmarkTopic_" + std::to_string(i);
+
+            writer_histories_.emplace_back(new WriterHistory(history_attributes));
+            WriterAttributes writer_attributes;
+            RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant_, writer_attributes,
+                            writer_histories_.back().get());
+            if (writer == nullptr || !participant_->registerWriter(writer, topic, WriterQos()))
+            {
+                return false;
+            }
+            writers_.push_back(writer);
+
+            reader_histories_.emplace_back(new ReaderHistory(history_attributes));
+            ReaderAttributes reader_attributes;
+            RTPSReader* reader = RTPSDomain::createRTPSReader(participant_, reader_attributes,
+                            reader_histories_.back().get());
+            if (reader == nullptr || !participant_->registerReader(reader, topic, ReaderQos()))
+            {
+                return false;
+            }
+            readers_.push_back(reader);
+        }
+
+        return true;
+    }
+
+    void remove_endpoints()
+    {
+        for (RTPSWriter* writer : writers_)
+        {
+            RTPSDomain::removeRTPSWriter(writer);
+        }
+        writers_.clear();
+
+        for (RTPSReader* reader : readers_)
+        {
+            RTPSDomain::removeRTPSReader(reader);
+        }
+        readers_.clear();
+    }
+
+    void onReaderDiscovery(
+            RTPSParticipant* participant,
+            ReaderDiscoveryInfo&& info) override
+    {
+        // Local endpoints are also notified
+        if (info.info.guid().guidPrefix == participant->getGuid().guidPrefix)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(g_mutex);
+        if (ReaderDiscoveryInfo::DISCOVERED_READER == info.status)
+        {
+            ++discovered_readers_;
+        }
+        else if (ReaderDiscoveryInfo::REMOVED_READER == info.status)
+        {
+            --discovered_readers_;
+        }
+        g_cv.notify_all();
+    }
+
+    void onWriterDiscovery(
+            RTPSParticipant* participant,
+            WriterDiscoveryInfo&& info) override
+    {
+        if (info.info.guid().guidPrefix == participant->getGuid().guidPrefix)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(g_mutex);
+        if (WriterDiscoveryInfo::DISCOVERED_WRITER == info.status)
+        {
+            ++discovered_writers_;
+        }
+        else if (WriterDiscoveryInfo::REMOVED_WRITER == info.status)
+        {
+            --discovered_writers_;
+        }
+        g_cv.notify_all();
+    }
+
+    //! Should be called with g_mutex taken
+    bool has_discovered(
+            uint32_t endpoints) const
+    {
+        return discovered_readers_ == endpoints && discovered_writers_ == endpoints;
+    }
+
+private:
+
+    RTPSParticipant* participant_ = nullptr;
+    std::vector<std::unique_ptr<WriterHistory>> writer_histories_;
+    std::vector<std::unique_ptr<ReaderHistory>> reader_histories_;
+    std::vector<RTPSWriter*> writers_;
+    std::vector<RTPSReader*> readers_;
+    uint32_t discovered_readers_ = 0;
+    uint32_t discovered_writers_ = 0;
+};
+
+static bool wait_for(
+        const std::vector<std::unique_ptr<BenchmarkParticipant>>& participants,
+        size_t first,
+        uint32_t endpoints,
+        uint32_t timeout_s)
+{
+    std::unique_lock<std::mutex> lock(g_mutex);
+    return g_cv.wait_for(lock, std::chrono::seconds(timeout_s), [&]()
+                   {
+                       for (size_t i = first; i < participants.size(); ++i)
+                       {
+                           if (!participants[i]->has_discovered(endpoints))
+                           {
+                               return false;
+                           }
+                       }
+                       return true;
+                   });
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_participants = 10;
+    uint32_t num_endpoints = 20;
+    uint32_t domain = 0;
+    uint32_t timeout_s = 60;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--participants") == 0 && i + 1 < argc)
+        {
+            num_participants = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--endpoints") == 0 && i + 1 < argc)
+        {
+            num_endpoints = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--domain") == 0 && i + 1 < argc)
+        {
+            domain = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--timeout") == 0 && i + 1 < argc)
+        {
+            timeout_s = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            std::cout << "Usage: DiscoveryBenchmark [--participants <n>] [--endpoints <n>] [--domain <id>] "
+                      << "[--timeout <seconds>]" << std::endl;
+            return -1;
+        }
+    }
+
+    if (num_participants < 2)
+    {
+        num_participants = 2;
+    }
+
+    int ret_val = 0;
+    std::vector<std::unique_ptr<BenchmarkParticipant>> participants;
+    uint32_t remote_endpoints = (num_participants - 1) * num_endpoints;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        participants.emplace_back(new BenchmarkParticipant());
+        if (!participants.back()->init(domain, num_endpoints))
+        {
+            std::cout << "Error creating participant " << i << std::endl;
+            return -1;
+        }
+    }
+    auto created = std::chrono::steady_clock::now();
+
+    if (!wait_for(participants, 0, remote_endpoints, timeout_s))
+    {
+        std::cout << "Timeout waiting for discovery" << std::endl;
+        ret_val = -1;
+    }
+    auto discovered = std::chrono::steady_clock::now();
+
+    // Removing the endpoints of one participant exercises the proxy removal path on the others.
+    participants.front()->remove_endpoints();
+    if (ret_val == 0 && !wait_for(participants, 1, remote_endpoints - num_endpoints, timeout_s))
+    {
+        std::cout << "Timeout waiting for endpoint removal" << std::endl;
+        ret_val = -1;
+    }
+    auto removed = std::chrono::steady_clock::now();
+
+    if (ret_val == 0)
+    {
+        using ms = std::chrono::duration<double, std::milli>;
+        std::cout << num_participants << " participants, " << num_endpoints << " readers and "
+                  << num_endpoints << " writers per participant" << std::endl;
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << std::setw(24) << "Creation (ms)" << std::setw(12) << ms(created - start).count() << std::endl;
+        std::cout << std::setw(24) << "Full discovery (ms)" << std::setw(12)
+                  << ms(discovered - start).count() << std::endl;
+        std::cout << std::setw(24) << "Endpoint removal (ms)" << std::setw(12)
+                  << ms(removed - discovered).count() << std::endl;
+    }
+
+    participants.clear();
+    eprosima::fastdds::dds::Log::KillThread();
+
+    return ret_val;
+}
@@ -0,0 +1,165 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DynamicTypesBenchmark.cpp
+ *
+ * Compares the cost of serializing, deserializing and sizing a sample of a static IDL generated type against the
+ * same type handled through DynamicPubSubType.
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include "Test.h"
+#include "TestPubSubTypes.h"
+#include "TestTypeObject.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::types;
+
+static double measure(
+        uint32_t samples,
+        const std::function<bool()>& operation)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        if (!operation())
+        {
+            std::cout << "Operation failed" << std::endl;
+            exit(-1);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / samples;
+}
+
+static void print_result(
+        const char* operation,
+        double static_ns,
+        double dynamic_ns)
+{
+    std::cout << std::setw(14) << operation
+              << std::setw(14) << std::fixed << std::setprecision(1) << static_ns
+              << std::setw(14) << dynamic_ns
+              << std::setw(10) << std::setprecision(2) << (dynamic_ns / static_ns) << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t samples = 100000;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+        {
+            samples = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            std::cout << "Usage: DynamicTypesBenchmark [--samples <n>]" << std::endl;
+            return -1;
+        }
+    }
+
+    if (samples == 0)
+    {
+        samples = 1;
+    }
+
+    // Static type. Constructing it registers the type objects of Test.idl.
+    BasicStruct static_data;
+    static_data.my_int32(-12000000);
+    static_data.my_uint64(1200000000);
+    static_data.my_float64(8.888);
+    static_data.my_string("Benchmarking dynamic types");
+    static_data.my_wstring(L"Wide string");
+    BasicStructPubSubType static_type;
+
+    // Dynamic type equivalent, built as a remote type discovered through TypeLookupManager would be.
+    const TypeIdentifier* identifier = GetBasicStructIdentifier(true);
+    const TypeObject* object = GetBasicStructObject(true);
+    DynamicType_ptr dyn_type = TypeObjectFactory::get_instance()->build_dynamic_type("BasicStruct", identifier, object);
+    if (!dyn_type)
+    {
+        std::cout << "Error building the dynamic type" << std::endl;
+        return -1;
+    }
+
+    DynamicPubSubType dynamic_type(dyn_type);
+    DynamicData* dynamic_data = DynamicDataFactory::get_instance()->create_data(dyn_type);
+
+    uint32_t payload_size = static_type.getSerializedSizeProvider(&static_data)();
+    SerializedPayload_t static_payload(payload_size);
+    static_type.serialize(&static_data, &static_payload);
+
+    // Fill the dynamic sample from the static one so both payloads are equivalent.
+    dynamic_type.deserialize(&static_payload, dynamic_data);
+    SerializedPayload_t dynamic_payload(dynamic_type.getSerializedSizeProvider(dynamic_data)());
+
+    double static_size = measure(samples, [&]()
+                    {
+                        return static_type.getSerializedSizeProvider(&static_data)() == payload_size;
+                    });
+    double dynamic_size = measure(samples, [&]()
+                    {
+                        return dynamic_type.getSerializedSizeProvider(dynamic_data)() == payload_size;
+                    });
+    double static_ser = measure(samples, [&]()
+                    {
+                        return static_type.serialize(&static_data, &static_payload);
+                    });
+    double dynamic_ser = measure(samples, [&]()
+                    {
+                        return dynamic_type.serialize(dynamic_data, &dynamic_payload);
+                    });
+    double static_deser = measure(samples, [&]()
+                    {
+                        return static_type.deserialize(&static_payload, &static_data);
+                    });
+    double dynamic_deser = measure(samples, [&]()
+                    {
+                        return dynamic_type.deserialize(&dynamic_payload, dynamic_data);
+                    });
+
+    std::cout << "BasicStruct (" << payload_size << " bytes), " << samples << " samples" << std::endl;
+    std::cout << std::setw(14) << "Operation" << std::setw(14) << "Static (ns)" << std::setw(14) << "Dynamic (ns)"
+              << std::setw(10) << "Ratio" << std::endl;
+    print_result("Size", static_size, dynamic_size);
+    print_result("Serialize", static_ser, dynamic_ser);
+    print_result("Deserialize", static_deser, dynamic_deser);
+
+    DynamicDataFactory::get_instance()->delete_data(dynamic_data);
+    dyn_type = nullptr;
+    DynamicDataFactory::delete_instance();
+    DynamicTypeBuilderFactory::delete_instance();
+    TypeObjectFactory::delete_instance();
+    eprosima::fastdds::dds::Log::KillThread();
+
+    return 0;
+}
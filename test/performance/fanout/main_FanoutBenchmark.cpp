@@ -0,0 +1,394 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_FanoutBenchmark.cpp
+ *
+ * Measures the cost of writing on a best-effort writer matched with many remote readers, spread over a set of
+ * participants. Separate sending is enabled by default, so the writer sends each sample once per set of readers
+ * sharing destination locators. Readers can be made to share a multicast group with --multicast.
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/MatchingInfo.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/ReaderListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/WriterListener.h>
+#include <fastrtps/attributes/LibrarySettingsAttributes.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/ReaderQos.h>
+#include <fastrtps/qos/WriterQos.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static std::mutex g_mutex;
+static std::condition_variable g_cv;
+static std::atomic<uint64_t> g_received(0);
+
+static const char* const TOPIC_NAME = "FanoutBenchmarkTopic";
+static const char* const TYPE_NAME = "FanoutBenchmarkType";
+
+class BenchmarkReaders : public ReaderListener
+{
+public:
+
+    ~BenchmarkReaders()
+    {
+        if (participant_ != nullptr)
+        {
+            RTPSDomain::removeRTPSParticipant(participant_);
+        }
+    }
+
+    bool init(
+            uint32_t domain,
+            uint32_t readers,
+            uint32_t payload_size,
+            const std::string& multicast_address)
+    {
+        RTPSParticipantAttributes attributes;
+        attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+        participant_ = RTPSDomain::createParticipant(domain, attributes);
+        if (participant_ == nullptr)
+        {
+            return false;
+        }
+
+        HistoryAttributes history_attributes;
+        history_attributes.payloadMaxSize = payload_size;
+        history_attributes.initialReservedCaches = 10;
+
+        TopicAttributes topic;
+        topic.topicKind = NO_KEY;
+        topic.topicDataType = TYPE_NAME;
+        topic.topicName = TOPIC_NAME;
+
+        ReaderQos qos;
+        qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+
+        for (uint32_t i = 0; i < readers; ++i)
+        {
+            histories_.emplace_back(new ReaderHistory(history_attributes));
+            ReaderAttributes reader_attributes;
+            reader_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+            reader_attributes.endpoint.topicKind = NO_KEY;
+            if (!multicast_address.empty())
+            {
+                Locator_t locator;
+                IPLocator::setIPv4(locator, multicast_address);
+                locator.port = 7900 + domain;
+                reader_attributes.endpoint.multicastLocatorList.push_back(locator);
+            }
+
+            RTPSReader* reader = RTPSDomain::createRTPSReader(participant_, reader_attributes,
+                            histories_.back().get(), this);
+            if (reader == nullptr || !participant_->registerReader(reader, topic, qos))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void onNewCacheChangeAdded(
+            RTPSReader* reader,
+            const CacheChange_t* const change) override
+    {
+        reader->getHistory()->remove_change(const_cast<CacheChange_t*>(change));
+        ++g_received;
+    }
+
+private:
+
+    RTPSParticipant* participant_ = nullptr;
+    std::vector<std::unique_ptr<ReaderHistory>> histories_;
+};
+
+class BenchmarkWriter : public WriterListener
+{
+public:
+
+    ~BenchmarkWriter()
+    {
+        if (participant_ != nullptr)
+        {
+            RTPSDomain::removeRTPSParticipant(participant_);
+        }
+    }
+
+    bool init(
+            uint32_t domain,
+            uint32_t payload_size,
+            bool separate_sending)
+    {
+        RTPSParticipantAttributes attributes;
+        attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+        participant_ = RTPSDomain::createParticipant(domain, attributes);
+        if (participant_ == nullptr)
+        {
+            return false;
+        }
+
+        HistoryAttributes history_attributes;
+        history_attributes.payloadMaxSize = payload_size;
+        history_attributes.initialReservedCaches = 2;
+        history_ = std::unique_ptr<WriterHistory>(new WriterHistory(history_attributes));
+
+        WriterAttributes writer_attributes;
+        writer_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+        writer_attributes.endpoint.topicKind = NO_KEY;
+        writer_ = RTPSDomain::createRTPSWriter(participant_, writer_attributes, history_.get(), this);
+        if (writer_ == nullptr)
+        {
+            return false;
+        }
+        writer_->set_separate_sending(separate_sending);
+
+        TopicAttributes topic;
+        topic.topicKind = NO_KEY;
+        topic.topicDataType = TYPE_NAME;
+        topic.topicName = TOPIC_NAME;
+
+        WriterQos qos;
+        qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+        return participant_->registerWriter(writer_, topic, qos);
+    }
+
+    //! @return the time spent adding the change to the history, which includes sending it
+    std::chrono::steady_clock::duration write(
+            uint32_t payload_size)
+    {
+        CacheChange_t* change = writer_->new_change([payload_size]() -> uint32_t
+                        {
+                            return payload_size;
+                        }, ALIVE);
+        if (change == nullptr)
+        {
+            return std::chrono::steady_clock::duration::zero();
+        }
+
+        memset(change->serializedPayload.data, 'F', payload_size);
+        change->serializedPayload.length = payload_size;
+
+        auto start = std::chrono::steady_clock::now();
+        history_->add_change(change);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        history_->remove_min_change();
+        return elapsed;
+    }
+
+    void onWriterMatched(
+            RTPSWriter*,
+            MatchingInfo& info) override
+    {
+        std::lock_guard<std::mutex> guard(g_mutex);
+        if (MATCHED_MATCHING == info.status)
+        {
+            ++matched_;
+        }
+        else
+        {
+            --matched_;
+        }
+        g_cv.notify_all();
+    }
+
+    bool wait_matched(
+            uint32_t readers,
+            uint32_t timeout_s)
+    {
+        std::unique_lock<std::mutex> lock(g_mutex);
+        return g_cv.wait_for(lock, std::chrono::seconds(timeout_s), [&]()
+                       {
+                           return matched_ >= readers;
+                       });
+    }
+
+private:
+
+    RTPSParticipant* participant_ = nullptr;
+    std::unique_ptr<WriterHistory> history_;
+    RTPSWriter* writer_ = nullptr;
+    uint32_t matched_ = 0;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_readers = 200;
+    uint32_t num_participants = 10;
+    uint32_t num_samples = 1000;
+    uint32_t payload_size = 1024;
+    uint32_t period_us = 1000;
+    uint32_t domain = 0;
+    uint32_t timeout_s = 60;
+    bool separate_sending = true;
+    std::string multicast_address;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--readers") == 0 && i + 1 < argc)
+        {
+            num_readers = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--participants") == 0 && i + 1 < argc)
+        {
+            num_participants = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+        {
+            num_samples = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+        {
+            payload_size = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--period") == 0 && i + 1 < argc)
+        {
+            period_us = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--multicast") == 0 && i + 1 < argc)
+        {
+            multicast_address = argv[++i];
+        }
+        else if (strcmp(argv[i], "--no-separate-sending") == 0)
+        {
+            separate_sending = false;
+        }
+        else if (strcmp(argv[i], "--domain") == 0 && i + 1 < argc)
+        {
+            domain = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--timeout") == 0 && i + 1 < argc)
+        {
+            timeout_s = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            std::cout << "Usage: FanoutBenchmark [--readers <n>] [--participants <n>] [--samples <n>] "
+                      << "[--size <bytes>] [--period <us>] [--multicast <ipv4>] [--no-separate-sending] "
+                      << "[--domain <id>] [--timeout <seconds>]" << std::endl;
+            return -1;
+        }
+    }
+
+    num_participants = std::max(1u, std::min(num_participants, num_readers));
+
+    // Every reader should be reached through the transports
+    LibrarySettingsAttributes library_settings;
+    library_settings.intraprocess_delivery = INTRAPROCESS_OFF;
+    xmlparser::XMLProfileManager::library_settings(library_settings);
+
+    int ret_val = 0;
+    std::vector<std::unique_ptr<BenchmarkReaders>> readers;
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        uint32_t count = num_readers / num_participants + (i < num_readers % num_participants ? 1 : 0);
+        readers.emplace_back(new BenchmarkReaders());
+        if (!readers.back()->init(domain, count, payload_size, multicast_address))
+        {
+            std::cout << "Error creating reader participant " << i << std::endl;
+            return -1;
+        }
+    }
+
+    std::unique_ptr<BenchmarkWriter> writer(new BenchmarkWriter());
+    if (!writer->init(domain, payload_size, separate_sending))
+    {
+        std::cout << "Error creating writer" << std::endl;
+        return -1;
+    }
+
+    if (!writer->wait_matched(num_readers, timeout_s))
+    {
+        std::cout << "Timeout waiting for the readers to be matched" << std::endl;
+        ret_val = -1;
+    }
+
+    std::vector<double> write_us;
+    if (ret_val == 0)
+    {
+        write_us.reserve(num_samples);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0; n < num_samples; ++n)
+        {
+            auto elapsed = writer->write(payload_size);
+            write_us.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+            std::this_thread::sleep_until(start + std::chrono::microseconds(period_us) * (n + 1));
+        }
+
+        // Let the last samples arrive
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        std::sort(write_us.begin(), write_us.end());
+        double mean = 0;
+        for (double value : write_us)
+        {
+            mean += value;
+        }
+        mean /= write_us.empty() ? 1 : write_us.size();
+
+        uint64_t expected = static_cast<uint64_t>(num_samples) * num_readers;
+        std::cout << num_readers << " readers on " << num_participants << " participants, " << num_samples
+                  << " samples of " << payload_size << " bytes, separate sending "
+                  << (separate_sending ? "on" : "off")
+                  << (multicast_address.empty() ? "" : ", multicast " + multicast_address) << std::endl;
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << std::setw(24) << "Write mean (us)" << std::setw(12) << mean << std::endl;
+        if (!write_us.empty())
+        {
+            std::cout << std::setw(24) << "Write 50% (us)" << std::setw(12)
+                      << write_us[write_us.size() / 2] << std::endl;
+            std::cout << std::setw(24) << "Write 99% (us)" << std::setw(12)
+                      << write_us[(write_us.size() * 99) / 100] << std::endl;
+        }
+        std::cout << std::setw(24) << "Received (%)" << std::setw(12)
+                  << (100.0 * g_received.load()) / expected << std::endl;
+    }
+
+    writer.reset();
+    readers.clear();
+    eprosima::fastdds::dds::Log::KillThread();
+
+    return ret_val;
+}
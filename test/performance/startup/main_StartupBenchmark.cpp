@@ -0,0 +1,211 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_StartupBenchmark.cpp
+ *
+ * Measures the time from the creation of a participant until its first user sample is handed to the transports,
+ * split in participant creation, writer creation and first write.
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/WriterQos.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using ms = std::chrono::duration<double, std::milli>;
+
+struct StartupTimes
+{
+    double participant;
+    double writer;
+    double first_write;
+};
+
+static bool run_iteration(
+        uint32_t domain,
+        bool lazy,
+        StartupTimes& times)
+{
+    const uint32_t payload_size = 255;
+    bool ret_val = false;
+
+    auto start = std::chrono::steady_clock::now();
+
+    RTPSParticipantAttributes attributes;
+    attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+    attributes.builtin.lazy_builtin_allocation = lazy;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(domain, attributes);
+    if (participant == nullptr)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return false;
+    }
+    auto participant_created = std::chrono::steady_clock::now();
+
+    HistoryAttributes history_attributes;
+    history_attributes.payloadMaxSize = payload_size;
+    history_attributes.initialReservedCaches = 1;
+    WriterHistory history(history_attributes);
+
+    TopicAttributes topic;
+    topic.topicKind = NO_KEY;
+    topic.topicDataType = "StartupBenchmarkType";
+    topic.topicName = "StartupBenchmarkTopic";
+
+    WriterAttributes writer_attributes;
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, writer_attributes, &history);
+    if (writer != nullptr && participant->registerWriter(writer, topic, WriterQos()))
+    {
+        auto writer_created = std::chrono::steady_clock::now();
+
+        CacheChange_t* change = writer->new_change([payload_size]() -> uint32_t
+                        {
+                            return payload_size;
+                        }, ALIVE);
+        if (change != nullptr)
+        {
+            memset(change->serializedPayload.data, 0, payload_size);
+            change->serializedPayload.length = payload_size;
+            ret_val = history.add_change(change);
+        }
+        auto first_write = std::chrono::steady_clock::now();
+
+        times.participant = ms(participant_created - start).count();
+        times.writer = ms(writer_created - participant_created).count();
+        times.first_write = ms(first_write - writer_created).count();
+    }
+
+    if (!ret_val)
+    {
+        std::cout << "Error creating writer or writing first sample" << std::endl;
+    }
+
+    if (writer != nullptr)
+    {
+        RTPSDomain::removeRTPSWriter(writer);
+    }
+    RTPSDomain::removeRTPSParticipant(participant);
+    return ret_val;
+}
+
+static void print_stats(
+        const char* name,
+        std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    double sum = 0;
+    for (double value : values)
+    {
+        sum += value;
+    }
+
+    std::cout << std::setw(20) << name
+              << std::setw(12) << values.front()
+              << std::setw(12) << values[values.size() / 2]
+              << std::setw(12) << sum / values.size()
+              << std::setw(12) << values.back() << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 20;
+    uint32_t domain = 0;
+    bool lazy = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            iterations = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--domain") == 0 && i + 1 < argc)
+        {
+            domain = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--lazy") == 0)
+        {
+            lazy = true;
+        }
+        else
+        {
+            std::cout << "Usage: StartupBenchmark [--iterations <n>] [--domain <id>] [--lazy]" << std::endl;
+            return -1;
+        }
+    }
+
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+
+    // The first iteration includes the one-time initialization of the library, and is reported on its own.
+    std::vector<StartupTimes> results;
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        StartupTimes times;
+        if (!run_iteration(domain, lazy, times))
+        {
+            eprosima::fastdds::dds::Log::KillThread();
+            return -1;
+        }
+        results.push_back(times);
+    }
+
+    std::vector<double> participant;
+    std::vector<double> writer;
+    std::vector<double> first_write;
+    std::vector<double> total;
+    for (const StartupTimes& times : results)
+    {
+        participant.push_back(times.participant);
+        writer.push_back(times.writer);
+        first_write.push_back(times.first_write);
+        total.push_back(times.participant + times.writer + times.first_write);
+    }
+
+    std::cout << iterations << " iterations, " << (lazy ? "lazy" : "preallocated")
+              << " builtin allocation" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Cold start (ms): " << total.front() << std::endl;
+    std::cout << std::setw(20) << "Phase (ms)" << std::setw(12) << "Min" << std::setw(12) << "Median"
+              << std::setw(12) << "Mean" << std::setw(12) << "Max" << std::endl;
+    print_stats("Participant", participant);
+    print_stats("Writer", writer);
+    print_stats("First write", first_write);
+    print_stats("Total", total);
+
+    eprosima::fastdds::dds::Log::KillThread();
+
+    return 0;
+}
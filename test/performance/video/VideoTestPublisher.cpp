@@ -394,6 +394,7 @@ bool VideoTestPublisher::test(uint32_t datasize)
     // --------------------------------------------------------------
     // Get new sample
     mp_video_out = new VideoType();
+    PageFaults faults = PageFaults::current();
     // Start "playing" on the pipeline
     gst_element_set_state(pipeline, GST_STATE_PLAYING);
 
@@ -406,6 +407,7 @@ bool VideoTestPublisher::test(uint32_t datasize)
 
     // Paused the sending
     gst_element_set_state(pipeline, GST_STATE_PAUSED);
+    faults.print_since("Publisher");
 
     // Send STOP command to subscriber
     command.m_command = STOP;
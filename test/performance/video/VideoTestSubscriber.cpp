@@ -381,6 +381,7 @@ bool VideoTestSubscriber::test()
 
     cout << "TEST STARTED" << endl;
 
+    PageFaults faults = PageFaults::current();
     t_start_ = std::chrono::steady_clock::now();
     t_drop_start_ = t_start_;
     m_status = 0;
@@ -401,6 +402,7 @@ bool VideoTestSubscriber::test()
     lock.unlock();
 
     cout << "TEST FINISHED" << endl;
+    faults.print_since("Subscriber");
     std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
     analyzeTimes();
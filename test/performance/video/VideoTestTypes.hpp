@@ -22,6 +22,12 @@
 
 #include "fastrtps/fastrtps_all.h"
 
+#include <cstdio>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif // ifndef _WIN32
+
 class VideoType
 {
     public:
@@ -121,5 +127,40 @@ class TestCommandDataType : public eprosima::fastrtps::TopicDataType
         }
 };
 
+//! Page faults taken by the process, used to check that no memory is mapped on the data path
+class PageFaults
+{
+    public:
+
+        uint64_t minor;
+        uint64_t major;
+
+        PageFaults(): minor(0), major(0)
+        {}
+
+        //! @return the page faults taken by the process so far. Zero where not supported.
+        static PageFaults current()
+        {
+            PageFaults faults;
+#ifndef _WIN32
+            struct rusage usage;
+            if (0 == getrusage(RUSAGE_SELF, &usage))
+            {
+                faults.minor = static_cast<uint64_t>(usage.ru_minflt);
+                faults.major = static_cast<uint64_t>(usage.ru_majflt);
+            }
+#endif // ifndef _WIN32
+            return faults;
+        }
+
+        //! Print the page faults taken since this snapshot
+        void print_since(const char* side) const
+        {
+            PageFaults now = current();
+            printf("%s page faults during test: %llu minor, %llu major\n", side,
+                static_cast<unsigned long long>(now.minor - minor),
+                static_cast<unsigned long long>(now.major - major));
+        }
+};
 
 #endif /* VIDEOTESTTYPES_H_ */
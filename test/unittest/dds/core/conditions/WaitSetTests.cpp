@@ -0,0 +1,215 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/dds/core/conditions/GuardCondition.hpp>
+#include <fastdds/dds/core/conditions/WaitSet.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastrtps::Duration_t;
+
+static const Duration_t short_timeout(0, 50000000);
+static const Duration_t long_timeout(10, 0);
+
+static bool contains(
+        const ConditionSeq& conditions,
+        const Condition* condition)
+{
+    return std::find(conditions.begin(), conditions.end(), condition) != conditions.end();
+}
+
+//! Condition whose trigger value takes a while to be checked
+class SlowCondition : public Condition
+{
+public:
+
+    bool get_trigger_value() const override
+    {
+        is_checking.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        is_checking.store(false);
+        return false;
+    }
+
+    mutable std::atomic<bool> is_checking{false};
+};
+
+TEST(WaitSetTests, attach_detach)
+{
+    WaitSet wait_set;
+    GuardCondition condition;
+    ConditionSeq conditions;
+
+    ASSERT_EQ(wait_set.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(conditions.empty());
+
+    // Attaching twice has no effect
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(conditions.size(), 1u);
+    ASSERT_EQ(conditions[0], &condition);
+
+    ASSERT_EQ(wait_set.detach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.detach_condition(condition), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+    ASSERT_EQ(wait_set.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(conditions.empty());
+}
+
+TEST(WaitSetTests, wait_timeout)
+{
+    WaitSet wait_set;
+    GuardCondition condition;
+    ConditionSeq active_conditions;
+
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_TIMEOUT);
+
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_TIMEOUT);
+    ASSERT_TRUE(active_conditions.empty());
+}
+
+TEST(WaitSetTests, guard_condition)
+{
+    WaitSet wait_set;
+    GuardCondition condition;
+    ConditionSeq active_conditions;
+
+    // A condition already active when attached is returned straight away
+    ASSERT_EQ(condition.set_trigger_value(true), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(active_conditions[0], &condition);
+
+    // It keeps being returned while it is active
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+
+    ASSERT_EQ(condition.set_trigger_value(false), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_TIMEOUT);
+    ASSERT_TRUE(active_conditions.empty());
+
+    // Triggered from another thread while waiting
+    std::thread trigger_thread([&condition]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                condition.set_trigger_value(true);
+            });
+    ASSERT_EQ(wait_set.wait(active_conditions, long_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+    trigger_thread.join();
+
+    // A detached condition is not returned
+    ASSERT_EQ(wait_set.detach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_TIMEOUT);
+}
+
+TEST(WaitSetTests, many_conditions)
+{
+    constexpr size_t num_conditions = 1000;
+
+    WaitSet wait_set;
+    std::vector<std::unique_ptr<GuardCondition> > conditions;
+    for (size_t i = 0; i < num_conditions; ++i)
+    {
+        conditions.emplace_back(new GuardCondition());
+        ASSERT_EQ(wait_set.attach_condition(*conditions.back()), ReturnCode_t::RETCODE_OK);
+    }
+
+    ConditionSeq active_conditions;
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_TIMEOUT);
+
+    // Only the triggered conditions are returned
+    conditions[10]->set_trigger_value(true);
+    conditions[500]->set_trigger_value(true);
+    conditions[999]->set_trigger_value(true);
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 3u);
+    ASSERT_TRUE(contains(active_conditions, conditions[10].get()));
+    ASSERT_TRUE(contains(active_conditions, conditions[500].get()));
+    ASSERT_TRUE(contains(active_conditions, conditions[999].get()));
+
+    conditions[500]->set_trigger_value(false);
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 2u);
+    ASSERT_FALSE(contains(active_conditions, conditions[500].get()));
+
+    // Conditions destroyed while attached are removed from the WaitSet
+    conditions.clear();
+    ASSERT_EQ(wait_set.get_conditions(active_conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(active_conditions.empty());
+}
+
+TEST(WaitSetTests, several_wait_sets)
+{
+    WaitSet wait_set_1;
+    WaitSet wait_set_2;
+    GuardCondition condition;
+    ConditionSeq active_conditions;
+
+    ASSERT_EQ(wait_set_1.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set_2.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+
+    condition.set_trigger_value(true);
+    ASSERT_EQ(wait_set_1.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(wait_set_2.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+
+    ASSERT_EQ(wait_set_1.detach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set_2.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+}
+
+TEST(WaitSetTests, detach_while_checking)
+{
+    WaitSet wait_set;
+    std::unique_ptr<SlowCondition> condition(new SlowCondition());
+    ConditionSeq active_conditions;
+
+    // The condition is checked by the first wait, as it is queued when attached
+    ASSERT_EQ(wait_set.attach_condition(*condition), ReturnCode_t::RETCODE_OK);
+    std::thread waiting_thread([&wait_set, &active_conditions]()
+            {
+                wait_set.wait(active_conditions, Duration_t(0, 500000000));
+            });
+
+    while (!condition->is_checking.load())
+    {
+        std::this_thread::yield();
+    }
+
+    // Detaching waits for the check to finish, so the condition can be safely destroyed afterwards
+    ASSERT_EQ(wait_set.detach_condition(*condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_FALSE(condition->is_checking.load());
+    condition.reset();
+
+    waiting_thread.join();
+    ASSERT_TRUE(active_conditions.empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -115,6 +115,31 @@ public:
 
 };
 
+class TopicDataTypeKeyedMock : public TopicDataTypeMock
+{
+public:
+
+    TopicDataTypeKeyedMock()
+        : TopicDataTypeMock()
+    {
+        m_isGetKeyDefined = true;
+        setName("keyedfootype");
+    }
+
+    bool getKey(
+            void* data,
+            fastrtps::rtps::InstanceHandle_t* ihandle,
+            bool /*force_md5*/) override
+    {
+        ++get_key_calls;
+        const std::string& message = static_cast<FooType*>(data)->message();
+        ihandle->value[0] = static_cast<fastrtps::rtps::octet>(message.size());
+        return true;
+    }
+
+    uint32_t get_key_calls = 0;
+};
+
 TEST(DataWriterTests, ChangeDataWriterQos)
 {
     DomainParticipant* participant =
@@ -146,6 +171,12 @@ TEST(DataWriterTests, ChangeDataWriterQos)
     ASSERT_EQ(qos, wqos);
     ASSERT_EQ(wqos.deadline().period, 260);
 
+    // Batching cannot be changed on an enabled writer
+    qos.batching().enabled = true;
+    ASSERT_TRUE(datawriter->set_qos(qos) == ReturnCode_t::RETCODE_IMMUTABLE_POLICY);
+    datawriter->get_qos(wqos);
+    ASSERT_FALSE(wqos.batching().enabled);
+
     ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
     ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
     ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
@@ -204,6 +235,50 @@ TEST(DataWriterTests, Write)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(DataWriterTests, WriteWithRegisteredHandle)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TopicDataTypeKeyedMock* type_mock = new TopicDataTypeKeyedMock();
+    TypeSupport type(type_mock);
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("keyedfootopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(datawriter, nullptr);
+
+    FooType data;
+    data.message("HelloWorld");
+    fastrtps::rtps::InstanceHandle_t handle = datawriter->register_instance(&data);
+    ASSERT_TRUE(handle.isDefined());
+
+    uint32_t get_key_calls = type_mock->get_key_calls;
+    ASSERT_TRUE(datawriter->write(&data, handle) == ReturnCode_t::RETCODE_OK);
+#if defined(NDEBUG)
+    // The handle of a registered instance is used without computing the key again.
+    ASSERT_EQ(get_key_calls, type_mock->get_key_calls);
+#else
+    ASSERT_EQ(get_key_calls + 1, type_mock->get_key_calls);
+#endif // if defined(NDEBUG)
+
+    // A handle of an instance that is not registered is still checked against the data.
+    fastrtps::rtps::InstanceHandle_t other_handle = handle;
+    ++other_handle.value[0];
+    ASSERT_TRUE(datawriter->write(&data, other_handle) == ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
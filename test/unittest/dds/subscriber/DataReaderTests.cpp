@@ -24,6 +24,8 @@
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastdds/dds/core/conditions/WaitSet.hpp>
 #include <dds/sub/Subscriber.hpp>
 #include <dds/sub/DataReader.hpp>
 #include <dds/sub/qos/DataReaderQos.hpp>
@@ -157,6 +159,65 @@ TEST(DataReaderTests, ReadData)
 }
 
 
+TEST(DataReaderTests, ReadCondition)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataReader* data_reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+    ASSERT_NE(data_reader, nullptr);
+
+    ReadCondition* condition = data_reader->create_readcondition(NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE,
+                    ANY_INSTANCE_STATE);
+    ASSERT_NE(condition, nullptr);
+    ASSERT_EQ(condition->get_datareader(), data_reader);
+    ASSERT_EQ(condition->get_sample_state_mask(), NOT_READ_SAMPLE_STATE);
+    ASSERT_EQ(condition->get_view_state_mask(), ANY_VIEW_STATE);
+    ASSERT_EQ(condition->get_instance_state_mask(), ANY_INSTANCE_STATE);
+
+    // No data has been received
+    ASSERT_FALSE(condition->get_trigger_value());
+    ASSERT_FALSE(data_reader->get_statuscondition().get_trigger_value());
+
+    WaitSet wait_set;
+    ASSERT_EQ(wait_set.attach_condition(*condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.attach_condition(data_reader->get_statuscondition()), ReturnCode_t::RETCODE_OK);
+
+    ConditionSeq active_conditions;
+    ASSERT_EQ(wait_set.wait(active_conditions, fastrtps::Duration_t(0, 100000000)), ReturnCode_t::RETCODE_TIMEOUT);
+    ASSERT_TRUE(active_conditions.empty());
+
+    // An attached condition cannot be deleted
+    ASSERT_EQ(data_reader->delete_readcondition(condition), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+
+    // Reading a status clears it
+    SubscriptionMatchedStatus matched_status;
+    ASSERT_EQ(data_reader->get_subscription_matched_status(matched_status), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(matched_status.current_count, 0);
+    ASSERT_FALSE(data_reader->get_status_changes().is_active(StatusMask::subscription_matched()));
+
+    ASSERT_EQ(wait_set.detach_condition(*condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data_reader->delete_readcondition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data_reader->delete_readcondition(condition), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+    ASSERT_EQ(wait_set.detach_condition(data_reader->get_statuscondition()), ReturnCode_t::RETCODE_OK);
+
+    ASSERT_EQ(subscriber->delete_datareader(data_reader), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
+
 
 void set_listener_test (
         DataReader* reader,
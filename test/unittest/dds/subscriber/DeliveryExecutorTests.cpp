@@ -0,0 +1,241 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/subscriber/DeliveryExecutor.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+
+class CountingTask : public DeliveryExecutor::Task
+{
+public:
+
+    void run() override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        ++count_;
+        cv_.notify_all();
+    }
+
+    bool wait_for(
+            uint32_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(10), [&]()
+                       {
+                           return count_ >= count;
+                       });
+    }
+
+    uint32_t count()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return count_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t count_ = 0;
+};
+
+class BlockingTask : public DeliveryExecutor::Task
+{
+public:
+
+    void run() override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        running_ = true;
+        cv_.notify_all();
+        cv_.wait(lock, [&]()
+                {
+                    return released_;
+                });
+    }
+
+    void wait_running()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]()
+                {
+                    return running_;
+                });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        released_ = true;
+        cv_.notify_all();
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool running_ = false;
+    bool released_ = false;
+};
+
+//! Destroys its own executor, as a listener deleting its reader would do
+class SelfDestroyingTask : public DeliveryExecutor::Task
+{
+public:
+
+    explicit SelfDestroyingTask(
+            DeliveryExecutor* executor)
+        : executor_(executor)
+    {
+    }
+
+    void run() override
+    {
+        delete executor_;
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        done_ = true;
+        cv_.notify_all();
+    }
+
+    bool wait_done()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(10), [&]()
+                       {
+                           return done_;
+                       });
+    }
+
+private:
+
+    DeliveryExecutor* executor_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool done_ = false;
+};
+
+TEST(DeliveryExecutorTests, CapacityIsRoundedToPowerOfTwo)
+{
+    DeliveryExecutorQos qos;
+    qos.thread_count = 1;
+    qos.queue_capacity = 100;
+    DeliveryExecutor executor(qos);
+    EXPECT_EQ(128u, executor.capacity());
+}
+
+TEST(DeliveryExecutorTests, RunsTasksPushedFromSeveralThreads)
+{
+    DeliveryExecutorQos qos;
+    qos.thread_count = 4;
+    qos.queue_capacity = 1024;
+    DeliveryExecutor executor(qos);
+
+    CountingTask task;
+    const uint32_t num_producers = 4;
+    const uint32_t pushes_per_producer = 200;
+    std::atomic<uint32_t> pushed(0);
+
+    std::vector<std::thread> producers;
+    for (uint32_t i = 0; i < num_producers; ++i)
+    {
+        producers.emplace_back([&]()
+                {
+                    for (uint32_t n = 0; n < pushes_per_producer; ++n)
+                    {
+                        while (!executor.push(&task))
+                        {
+                            std::this_thread::yield();
+                        }
+                        ++pushed;
+                    }
+                });
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    ASSERT_EQ(num_producers * pushes_per_producer, pushed.load());
+    EXPECT_TRUE(task.wait_for(pushed.load()));
+    EXPECT_EQ(pushed.load(), task.count());
+}
+
+TEST(DeliveryExecutorTests, PushFailsWhenQueueIsFull)
+{
+    DeliveryExecutorQos qos;
+    qos.thread_count = 1;
+    qos.queue_capacity = 4;
+    DeliveryExecutor executor(qos);
+
+    BlockingTask blocking;
+    CountingTask task;
+
+    // Keep the only thread busy
+    ASSERT_TRUE(executor.push(&blocking));
+    blocking.wait_running();
+
+    for (size_t i = 0; i < executor.capacity(); ++i)
+    {
+        EXPECT_TRUE(executor.push(&task));
+    }
+    EXPECT_FALSE(executor.push(&task));
+
+    blocking.release();
+    EXPECT_TRUE(task.wait_for(static_cast<uint32_t>(executor.capacity())));
+    EXPECT_TRUE(executor.push(&task));
+    EXPECT_TRUE(task.wait_for(static_cast<uint32_t>(executor.capacity()) + 1));
+}
+
+TEST(DeliveryExecutorTests, PushFailsWhenStopped)
+{
+    DeliveryExecutorQos qos;
+    qos.thread_count = 2;
+    DeliveryExecutor executor(qos);
+    executor.stop();
+
+    CountingTask task;
+    EXPECT_FALSE(executor.push(&task));
+}
+
+TEST(DeliveryExecutorTests, TaskDestroysItsExecutor)
+{
+    DeliveryExecutorQos qos;
+    qos.thread_count = 2;
+    DeliveryExecutor* executor = new DeliveryExecutor(qos);
+
+    SelfDestroyingTask task(executor);
+    ASSERT_TRUE(executor->push(&task));
+    EXPECT_TRUE(task.wait_done());
+
+    // Let the detached thread exit
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -2214,6 +2214,54 @@ TEST_F(DynamicComplexTypesTests, Data_Comparison_with_Keys)
     DynamicDataFactory::get_instance()->delete_data(dynDataFromDynamic);
 }
 
+TEST_F(DynamicComplexTypesTests, Compiled_Struct_Static_Comparison)
+{
+    // BasicStruct only has primitives and strings, so it is serialized through its compiled plan.
+    types::DynamicData* dynData = DynamicDataFactory::get_instance()->create_data(GetBasicStructType());
+    dynData->set_bool_value(true, dynData->get_member_id_by_name("my_bool"));
+    dynData->set_byte_value(100, dynData->get_member_id_by_name("my_octet"));
+    dynData->set_int16_value(-12000, dynData->get_member_id_by_name("my_int16"));
+    dynData->set_int32_value(-12000000, dynData->get_member_id_by_name("my_int32"));
+    dynData->set_int64_value(-1200000000, dynData->get_member_id_by_name("my_int64"));
+    dynData->set_uint16_value(12000, dynData->get_member_id_by_name("my_uint16"));
+    dynData->set_uint32_value(12000000, dynData->get_member_id_by_name("my_uint32"));
+    dynData->set_uint64_value(1200000000, dynData->get_member_id_by_name("my_uint64"));
+    dynData->set_float32_value(5.5f, dynData->get_member_id_by_name("my_float32"));
+    dynData->set_float64_value(8.888, dynData->get_member_id_by_name("my_float64"));
+    dynData->set_float128_value(1005.1005, dynData->get_member_id_by_name("my_float128"));
+    dynData->set_char8_value('O', dynData->get_member_id_by_name("my_char"));
+    dynData->set_char16_value(L'M', dynData->get_member_id_by_name("my_wchar"));
+    dynData->set_string_value("G It's", dynData->get_member_id_by_name("my_string"));
+    dynData->set_wstring_value(L" Working", dynData->get_member_id_by_name("my_wstring"));
+
+    DynamicPubSubType pubsubType(GetBasicStructType());
+    uint32_t payloadSize = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(dynData)());
+    SerializedPayload_t dynPayload(payloadSize);
+    ASSERT_TRUE(pubsubType.serialize(dynData, &dynPayload));
+    ASSERT_EQ(payloadSize, dynPayload.length);
+
+    BasicStruct staticData;
+    BasicStructPubSubType pbBasic;
+    ASSERT_TRUE(pbBasic.deserialize(&dynPayload, &staticData));
+    ASSERT_EQ(staticData.my_int32(), -12000000);
+    ASSERT_EQ(staticData.my_uint64(), 1200000000u);
+    ASSERT_EQ(staticData.my_char(), 'O');
+    ASSERT_EQ(staticData.my_string(), "G It's");
+    ASSERT_TRUE(staticData.my_wstring() == L" Working");
+
+    uint32_t staticPayloadSize = static_cast<uint32_t>(pbBasic.getSerializedSizeProvider(&staticData)());
+    SerializedPayload_t stPayload(staticPayloadSize);
+    ASSERT_TRUE(pbBasic.serialize(&staticData, &stPayload));
+    ASSERT_EQ(stPayload.length, dynPayload.length);
+
+    types::DynamicData* dynDataFromStatic = DynamicDataFactory::get_instance()->create_data(GetBasicStructType());
+    ASSERT_TRUE(pubsubType.deserialize(&stPayload, dynDataFromStatic));
+    ASSERT_TRUE(dynDataFromStatic->equals(dynData));
+
+    DynamicDataFactory::get_instance()->delete_data(dynData);
+    DynamicDataFactory::get_instance()->delete_data(dynDataFromStatic);
+}
+
 TEST_F(DynamicComplexTypesTests, TypeInformation)
 {
     const TypeObject* compl_obj = TypeObjectFactory::get_instance()->get_type_object("CompleteStruct", true);
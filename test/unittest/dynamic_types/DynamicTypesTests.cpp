@@ -26,6 +26,7 @@
 #include <fastrtps/types/DynamicData.h>
 #include <fastrtps/types/DynamicDataPtr.h>
 #include <fastrtps/types/TypeObjectFactory.h>
+#include <fastrtps/types/TypeNamesGenerator.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 #include "idl/BasicPubSubTypes.h"
@@ -34,6 +35,8 @@
 
 #include <dds/core/LengthUnlimited.hpp>
 
+#include <thread>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace eprosima::fastrtps::types;
@@ -5069,6 +5072,53 @@ TEST(TypeIdentifierTests, MinimalTypeIdentifierComparision)
     ASSERT_FALSE(unionUnionStruct1 == unionUnion1);
 }
 
+TEST(TypeObjectFactoryTests, ConcurrentRegistration)
+{
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+    const uint32_t num_threads = 8;
+    const uint32_t num_bounds = 300;
+    std::vector<std::vector<const TypeIdentifier*>> results(num_threads);
+
+    // All threads create the same anonymous collections at once
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([factory, t, &results]()
+                {
+                    for (uint32_t bound = 1; bound <= num_bounds; ++bound)
+                    {
+                        const TypeIdentifier* string_id = factory->get_string_identifier(bound);
+                        results[t].push_back(string_id);
+                        results[t].push_back(factory->get_sequence_identifier(TKNAME_INT32, bound));
+                        EXPECT_TRUE(factory->typelookup_check_type_identifier(*string_id));
+                        EXPECT_EQ(TypeNamesGenerator::get_string_type_name(bound, false, false),
+                        factory->get_type_name(string_id));
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every thread resolved the same stored identifiers
+    for (uint32_t t = 1; t < num_threads; ++t)
+    {
+        ASSERT_EQ(results[0].size(), results[t].size());
+        for (size_t i = 0; i < results[0].size(); ++i)
+        {
+            EXPECT_EQ(results[0][i], results[t][i]);
+        }
+    }
+
+    // An equal identifier created outside the factory resolves to the stored one
+    TypeIdentifier external;
+    external._d(TI_STRING8_SMALL);
+    external.string_sdefn().bound(42);
+    TypeObject object;
+    EXPECT_EQ(factory->get_string_identifier(42), factory->typelookup_get_type(external, object));
+}
+
 int main(
         int argc,
         char** argv)
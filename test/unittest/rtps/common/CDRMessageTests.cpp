@@ -0,0 +1,167 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/rtps/messages/CDRMessage.h>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+template<typename T>
+static void check_codec_roundtrip(
+        const std::vector<T>& values)
+{
+    // Use an odd offset to check unaligned accesses
+    std::vector<octet> buffer(values.size() * sizeof(T) + 1);
+    std::vector<T> decoded(values.size());
+
+    for (bool swap : {false, true})
+    {
+        CDRCodecs::encode_array(buffer.data() + 1, values.data(), values.size(), swap);
+        for (size_t i = 0; i < values.size() && sizeof(T) > 1; ++i)
+        {
+            const octet* value = reinterpret_cast<const octet*>(&values[i]);
+            const octet* encoded = buffer.data() + 1 + i * sizeof(T);
+            for (size_t b = 0; b < sizeof(T); ++b)
+            {
+                EXPECT_EQ(swap ? value[sizeof(T) - 1 - b] : value[b], encoded[b]);
+            }
+        }
+
+        CDRCodecs::decode_array(buffer.data() + 1, decoded.data(), decoded.size(), swap);
+        EXPECT_EQ(values, decoded);
+    }
+}
+
+TEST(CDRMessageTests, CodecsRoundtrip)
+{
+    check_codec_roundtrip<int16_t>({0, 1, -2, 0x1234, -32768});
+    check_codec_roundtrip<uint16_t>({0, 1, 0xFFFF, 0x1234});
+    check_codec_roundtrip<int32_t>({0, -1, 0x12345678, -2147483647 - 1});
+    check_codec_roundtrip<uint32_t>({0, 1, 0xDEADBEEF, 0x01020304, 0xFFFFFFFF});
+    check_codec_roundtrip<int64_t>({0, -1, 0x0102030405060708ll});
+    check_codec_roundtrip<uint64_t>({0, 0xFFFFFFFFFFFFFFFFull, 0x0102030405060708ull});
+    check_codec_roundtrip<float>({0.0f, -1.5f, 3.14159f});
+    check_codec_roundtrip<double>({0.0, -1.5, 2.718281828459045});
+}
+
+TEST(CDRMessageTests, PrimitivesBothEndianness)
+{
+    for (Endianness_t endian : {BIGEND, LITTLEEND})
+    {
+        CDRMessage_t msg(64);
+        msg.msg_endian = endian;
+        EXPECT_TRUE(CDRMessage::addUInt16(&msg, 0x0102));
+        EXPECT_TRUE(CDRMessage::addInt32(&msg, -2));
+        EXPECT_TRUE(CDRMessage::addUInt32(&msg, 0x01020304));
+        EXPECT_TRUE(CDRMessage::addInt64(&msg, 0x0102030405060708ll));
+
+        // Check the wire representation of the unsigned values
+        if (endian == BIGEND)
+        {
+            EXPECT_EQ(0x01, msg.buffer[0]);
+            EXPECT_EQ(0x02, msg.buffer[1]);
+            EXPECT_EQ(0x01, msg.buffer[6]);
+            EXPECT_EQ(0x04, msg.buffer[9]);
+        }
+        else
+        {
+            EXPECT_EQ(0x02, msg.buffer[0]);
+            EXPECT_EQ(0x01, msg.buffer[1]);
+            EXPECT_EQ(0x04, msg.buffer[6]);
+            EXPECT_EQ(0x01, msg.buffer[9]);
+        }
+
+        msg.pos = 0;
+        uint16_t u16 = 0;
+        int32_t i32 = 0;
+        uint32_t u32 = 0;
+        int64_t i64 = 0;
+        EXPECT_TRUE(CDRMessage::readUInt16(&msg, &u16));
+        EXPECT_TRUE(CDRMessage::readInt32(&msg, &i32));
+        EXPECT_TRUE(CDRMessage::readUInt32(&msg, &u32));
+        EXPECT_TRUE(CDRMessage::readInt64(&msg, &i64));
+        EXPECT_EQ(0x0102u, u16);
+        EXPECT_EQ(-2, i32);
+        EXPECT_EQ(0x01020304u, u32);
+        EXPECT_EQ(0x0102030405060708ll, i64);
+
+        // Reading past the end of the message fails
+        EXPECT_FALSE(CDRMessage::readUInt32(&msg, &u32));
+    }
+}
+
+TEST(CDRMessageTests, SequenceNumberSetBothEndianness)
+{
+    for (Endianness_t endian : {BIGEND, LITTLEEND})
+    {
+        SequenceNumberSet_t sns(SequenceNumber_t(0, 100));
+        sns.add(SequenceNumber_t(0, 100));
+        sns.add(SequenceNumber_t(0, 131));
+        sns.add(SequenceNumber_t(0, 200));
+        sns.add(SequenceNumber_t(0, 355));
+
+        CDRMessage_t msg(128);
+        msg.msg_endian = endian;
+        EXPECT_TRUE(CDRMessage::addSequenceNumberSet(&msg, &sns));
+        msg.pos = 0;
+        SequenceNumberSet_t read_sns = CDRMessage::readSequenceNumberSet(&msg);
+        EXPECT_EQ(msg.length, msg.pos);
+        EXPECT_EQ(sns.base(), read_sns.base());
+        EXPECT_EQ(sns.max(), read_sns.max());
+        EXPECT_TRUE(read_sns.is_set(SequenceNumber_t(0, 131)));
+        EXPECT_TRUE(read_sns.is_set(SequenceNumber_t(0, 200)));
+        EXPECT_FALSE(read_sns.is_set(SequenceNumber_t(0, 201)));
+
+        FragmentNumberSet_t fns(1u);
+        fns.add(1u);
+        fns.add(33u);
+        fns.add(256u);
+
+        msg.pos = 0;
+        msg.length = 0;
+        EXPECT_TRUE(CDRMessage::addFragmentNumberSet(&msg, &fns));
+        msg.pos = 0;
+        FragmentNumberSet_t read_fns;
+        EXPECT_TRUE(CDRMessage::readFragmentNumberSet(&msg, &read_fns));
+        EXPECT_EQ(fns.base(), read_fns.base());
+        EXPECT_EQ(fns.max(), read_fns.max());
+        EXPECT_TRUE(read_fns.is_set(33u));
+        EXPECT_FALSE(read_fns.is_set(34u));
+    }
+}
+
+TEST(CDRMessageTests, BitmapTooLong)
+{
+    // A set announcing more than 256 bits is malformed
+    CDRMessage_t msg(128);
+    CDRMessage::addUInt32(&msg, 1u);
+    CDRMessage::addUInt32(&msg, 1000u);
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        CDRMessage::addUInt32(&msg, 0xFFFFFFFFu);
+    }
+    msg.pos = 0;
+
+    FragmentNumberSet_t fns;
+    EXPECT_FALSE(CDRMessage::readFragmentNumberSet(&msg, &fns));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
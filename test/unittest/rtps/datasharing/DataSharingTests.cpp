@@ -0,0 +1,278 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/DataSharing/DataSharingListener.hpp>
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+#include <rtps/DataSharing/DataSharingRing.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+class DataSharingTests : public ::testing::Test
+{
+protected:
+
+    DataSharingTests()
+    {
+        // Use a different prefix on each run, so concurrent test runs do not collide.
+        uint32_t seed = static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        memcpy(&writer_guid.guidPrefix.value[4], &seed, sizeof(seed));
+        writer_guid.entityId.value[3] = 3;
+        reader_guid = writer_guid;
+        reader_guid.entityId.value[3] = 4;
+    }
+
+    static void fill_change(
+            CacheChange_t& change,
+            uint32_t sequence,
+            uint32_t length)
+    {
+        change.sequenceNumber = SequenceNumber_t(0, sequence);
+        change.kind = ALIVE;
+        change.sourceTimestamp = Time_t(static_cast<int32_t>(sequence), 0u);
+        change.instanceHandle.value[0] = static_cast<octet>(sequence);
+        change.serializedPayload.encapsulation = CDR_LE;
+        change.serializedPayload.length = length;
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            change.serializedPayload.data[i] = static_cast<octet>(sequence + i);
+        }
+    }
+
+    static bool check_change(
+            const CacheChange_t& change,
+            uint32_t sequence,
+            uint32_t length)
+    {
+        if (change.serializedPayload.length != length ||
+                change.sequenceNumber != SequenceNumber_t(0, sequence) ||
+                change.sourceTimestamp != Time_t(static_cast<int32_t>(sequence), 0u) ||
+                change.instanceHandle.value[0] != static_cast<octet>(sequence))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            if (change.serializedPayload.data[i] != static_cast<octet>(sequence + i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    GUID_t writer_guid;
+    GUID_t reader_guid;
+};
+
+TEST_F(DataSharingTests, RingWriteAndRead)
+{
+    auto ring = DataSharingRing::create(writer_guid, 4, 100);
+    ASSERT_NE(nullptr, ring);
+    EXPECT_EQ(4u, ring->slot_count());
+    EXPECT_EQ(SequenceNumber_t(), ring->last_sequence_number());
+
+    auto reader_ring = DataSharingRing::open(writer_guid);
+    ASSERT_NE(nullptr, reader_ring);
+    EXPECT_EQ(100u, reader_ring->max_payload_size());
+
+    CacheChange_t change(100);
+    for (uint32_t sequence = 1; sequence <= 6; ++sequence)
+    {
+        fill_change(change, sequence, 10 * sequence);
+        ASSERT_TRUE(ring->write(change));
+    }
+    EXPECT_EQ(SequenceNumber_t(0, 6), reader_ring->last_sequence_number());
+
+    // Samples 1 and 2 have been overwritten
+    uint32_t length = 0;
+    EXPECT_FALSE(reader_ring->get_payload_length(SequenceNumber_t(0, 1), length));
+    EXPECT_FALSE(reader_ring->get_payload_length(SequenceNumber_t(0, 2), length));
+    EXPECT_FALSE(reader_ring->get_payload_length(SequenceNumber_t(0, 7), length));
+
+    for (uint32_t sequence = 3; sequence <= 6; ++sequence)
+    {
+        ASSERT_TRUE(reader_ring->get_payload_length(SequenceNumber_t(0, sequence), length));
+        EXPECT_EQ(10 * sequence, length);
+
+        CacheChange_t read_change(length);
+        ASSERT_TRUE(reader_ring->read(SequenceNumber_t(0, sequence), read_change));
+        EXPECT_TRUE(check_change(read_change, sequence, length));
+        EXPECT_EQ(writer_guid, read_change.writerGUID);
+    }
+
+    // Too big for the destination
+    CacheChange_t small_change(10);
+    EXPECT_FALSE(reader_ring->read(SequenceNumber_t(0, 6), small_change));
+
+    // Too big for the ring
+    CacheChange_t big_change(200);
+    fill_change(big_change, 7, 200);
+    EXPECT_FALSE(ring->write(big_change));
+}
+
+TEST_F(DataSharingTests, RingRemovedWithWriter)
+{
+    {
+        auto ring = DataSharingRing::create(writer_guid, 4, 100);
+        ASSERT_NE(nullptr, ring);
+    }
+    EXPECT_EQ(nullptr, DataSharingRing::open(writer_guid));
+    EXPECT_EQ(nullptr, DataSharingNotification::open(reader_guid));
+}
+
+TEST_F(DataSharingTests, Notification)
+{
+    auto notification = DataSharingNotification::create(reader_guid);
+    ASSERT_NE(nullptr, notification);
+    auto writer_side = DataSharingNotification::open(reader_guid);
+    ASSERT_NE(nullptr, writer_side);
+
+    EXPECT_FALSE(notification->wait(10));
+    writer_side->notify();
+    writer_side->notify();
+    EXPECT_TRUE(notification->wait(10));
+    EXPECT_FALSE(notification->wait(10));
+}
+
+TEST_F(DataSharingTests, NotificationWakesUpWaitingReader)
+{
+    auto notification = DataSharingNotification::create(reader_guid);
+    ASSERT_NE(nullptr, notification);
+    auto writer_side = DataSharingNotification::open(reader_guid);
+    ASSERT_NE(nullptr, writer_side);
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread writer_thread([&writer_side]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                writer_side->notify();
+            });
+    EXPECT_TRUE(notification->wait(10000));
+    writer_thread.join();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+#if HAVE_SECURITY
+TEST_F(DataSharingTests, NotAllowedWithProtection)
+{
+    using namespace eprosima::fastrtps::rtps::security;
+
+    ParticipantSecurityAttributes participant_attributes;
+    EndpointSecurityAttributes endpoint_attributes;
+    EXPECT_TRUE(DataSharingRing::is_allowed(participant_attributes, endpoint_attributes, 0));
+    EXPECT_TRUE(DataSharingRing::is_allowed(participant_attributes, endpoint_attributes,
+            ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_VALID | ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_READ_PROTECTED));
+
+    // Protection required by the remote endpoint
+    EXPECT_FALSE(DataSharingRing::is_allowed(participant_attributes, endpoint_attributes,
+            ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_VALID | ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_PROTECTED));
+    EXPECT_FALSE(DataSharingRing::is_allowed(participant_attributes, endpoint_attributes,
+            ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_VALID | ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_PROTECTED));
+
+    // Protection required by the local endpoint
+    endpoint_attributes.is_payload_protected = true;
+    EXPECT_FALSE(DataSharingRing::is_allowed(participant_attributes, endpoint_attributes, 0));
+    endpoint_attributes.is_payload_protected = false;
+    endpoint_attributes.is_submessage_protected = true;
+    EXPECT_FALSE(DataSharingRing::is_allowed(participant_attributes, endpoint_attributes, 0));
+    endpoint_attributes.is_submessage_protected = false;
+
+    // Protection of every RTPS message
+    participant_attributes.is_rtps_protected = true;
+    EXPECT_FALSE(DataSharingRing::is_allowed(participant_attributes, endpoint_attributes, 0));
+}
+
+#endif // if HAVE_SECURITY
+
+TEST_F(DataSharingTests, ListenerTakesNewSamples)
+{
+    auto ring = DataSharingRing::create(writer_guid, 8, 100);
+    ASSERT_NE(nullptr, ring);
+    CacheChange_t change(100);
+
+    // Written before the reader matched the writer. Not taken from the ring.
+    fill_change(change, 1, 50);
+    ASSERT_TRUE(ring->write(change));
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<uint32_t> received;
+
+    auto notification = DataSharingNotification::create(reader_guid);
+    ASSERT_NE(nullptr, notification);
+    DataSharingListener listener(notification,
+            [&](DataSharingRing& reader_ring, const SequenceNumber_t& sequence_number)
+            {
+                uint32_t length = 0;
+                if (!reader_ring.get_payload_length(sequence_number, length))
+                {
+                    return false;
+                }
+
+                CacheChange_t read_change(length);
+                bool ret_val = reader_ring.read(sequence_number, read_change) &&
+                check_change(read_change, sequence_number.low, length);
+                std::lock_guard<std::mutex> guard(mutex);
+                received.push_back(sequence_number.low);
+                cv.notify_all();
+                return ret_val;
+            },
+            eprosima::fastdds::rtps::ThreadSettings());
+    listener.start();
+    EXPECT_TRUE(listener.add_writer(writer_guid));
+    GUID_t unknown_writer = writer_guid;
+    unknown_writer.entityId.value[3] = 5;
+    EXPECT_FALSE(listener.add_writer(unknown_writer));
+
+    auto writer_side = DataSharingNotification::open(reader_guid);
+    ASSERT_NE(nullptr, writer_side);
+    for (uint32_t sequence = 2; sequence <= 4; ++sequence)
+    {
+        fill_change(change, sequence, 50);
+        ASSERT_TRUE(ring->write(change));
+    }
+    writer_side->notify();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return received.size() >= 3u;
+                }));
+    }
+
+    listener.stop();
+    std::vector<uint32_t> expected = {2, 3, 4};
+    EXPECT_EQ(expected, received);
+
+    EXPECT_TRUE(listener.remove_writer(writer_guid));
+    EXPECT_FALSE(listener.remove_writer(writer_guid));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,94 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/rtps/builtin/data/AnnouncementDigest.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace eprosima::fastrtps::rtps;
+
+static void fill_payload(
+        SerializedPayload_t& payload,
+        const char* contents)
+{
+    uint32_t length = static_cast<uint32_t>(strlen(contents));
+    payload.reserve(length);
+    memcpy(payload.data, contents, length);
+    payload.length = length;
+}
+
+/*!
+ * An unchanged announcement matches the stored digest, so its parsing is skipped.
+ */
+TEST(AnnouncementDigestTests, UnchangedAnnouncementMatches)
+{
+    SerializedPayload_t first;
+    SerializedPayload_t repeated;
+    fill_payload(first, "participant announcement");
+    fill_payload(repeated, "participant announcement");
+
+    AnnouncementDigest stored(first);
+    ASSERT_TRUE(stored.matches(AnnouncementDigest(repeated)));
+}
+
+/*!
+ * A changed announcement does not match the stored digest, so it is processed.
+ */
+TEST(AnnouncementDigestTests, ChangedAnnouncementDoesNotMatch)
+{
+    SerializedPayload_t first;
+    SerializedPayload_t same_length;
+    SerializedPayload_t other_length;
+    fill_payload(first, "participant announcement");
+    fill_payload(same_length, "participant announcemenT");
+    fill_payload(other_length, "participant announcement with new qos");
+
+    AnnouncementDigest stored(first);
+    ASSERT_FALSE(stored.matches(AnnouncementDigest(same_length)));
+    ASSERT_FALSE(stored.matches(AnnouncementDigest(other_length)));
+
+    // Once processed, the changed announcement is the one to be skipped
+    stored = AnnouncementDigest(other_length);
+    ASSERT_TRUE(stored.matches(AnnouncementDigest(other_length)));
+    ASSERT_FALSE(stored.matches(AnnouncementDigest(first)));
+}
+
+/*!
+ * An empty digest never matches, so the first announcement of a participant is always processed.
+ */
+TEST(AnnouncementDigestTests, EmptyDigestNeverMatches)
+{
+    SerializedPayload_t payload;
+    SerializedPayload_t empty_payload;
+    fill_payload(payload, "participant announcement");
+
+    AnnouncementDigest empty;
+    ASSERT_FALSE(empty.matches(AnnouncementDigest(payload)));
+    ASSERT_FALSE(empty.matches(AnnouncementDigest(empty_payload)));
+    ASSERT_FALSE(AnnouncementDigest(empty_payload).matches(AnnouncementDigest(empty_payload)));
+
+    AnnouncementDigest stored(payload);
+    stored.clear();
+    ASSERT_FALSE(stored.matches(AnnouncementDigest(payload)));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
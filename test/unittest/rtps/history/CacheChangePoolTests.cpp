@@ -72,7 +72,8 @@ TEST_P(CacheChangePoolTests, init_pool)
 
     size_t expected_size;
     if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
-            memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE)
+            memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE ||
+            memory_policy == MemoryManagementPolicy_t::DYNAMIC_SLAB_MEMORY_MODE)
     {
         expected_size = 0;
     }
@@ -131,6 +132,11 @@ TEST_P(CacheChangePoolTests, reserve_cache)
             case MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE:
                 ASSERT_EQ(ch->serializedPayload.max_size, data_size);
                 break;
+            case MemoryManagementPolicy_t::DYNAMIC_SLAB_MEMORY_MODE:
+                // Rounded up to a power of two
+                ASSERT_GE(ch->serializedPayload.max_size, data_size);
+                ASSERT_EQ(ch->serializedPayload.max_size & (ch->serializedPayload.max_size - 1), 0U);
+                break;
         }
 
         if (max_size > 0)
@@ -170,6 +176,11 @@ TEST_P(CacheChangePoolTests, release_cache)
             ASSERT_EQ(pool->get_allCachesSize(), 1U);
             ASSERT_EQ(pool->get_freeCachesSize(), 0U);
         }
+        else if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_SLAB_MEMORY_MODE)
+        {
+            // Released changes are kept on their size class
+            ASSERT_EQ(pool->get_freeCachesSize(), pool->get_allCachesSize() - 1U);
+        }
         else
         {
             ASSERT_EQ(pool->get_allCachesSize(), all_caches_size);
@@ -188,6 +199,10 @@ TEST_P(CacheChangePoolTests, release_cache)
             ASSERT_EQ(pool->get_allCachesSize(), 1U);
             ASSERT_EQ(pool->get_freeCachesSize(), 1U);
         }
+        else if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_SLAB_MEMORY_MODE)
+        {
+            ASSERT_EQ(pool->get_freeCachesSize(), pool->get_allCachesSize());
+        }
         else
         {
             ASSERT_EQ(pool->get_allCachesSize(), all_caches_size);
@@ -259,6 +274,87 @@ TEST_P(CacheChangePoolTests, chage_change)
     }
 }
 
+TEST(CacheChangePoolSlabTests, size_classes)
+{
+    // Keep up to two free changes per size class
+    CacheChangePool pool(1, 128, 0, MemoryManagementPolicy_t::DYNAMIC_SLAB_MEMORY_MODE);
+
+    std::vector<CacheChange_t*> changes;
+    for (uint32_t data_size : {10U, 64U, 65U, 100U, 128U, 129U})
+    {
+        CacheChange_t* ch = nullptr;
+        ASSERT_TRUE(pool.reserve_Cache(&ch, data_size));
+        changes.push_back(ch);
+    }
+    EXPECT_EQ(changes[0]->serializedPayload.max_size, 64U);
+    EXPECT_EQ(changes[1]->serializedPayload.max_size, 64U);
+    EXPECT_EQ(changes[2]->serializedPayload.max_size, 128U);
+    EXPECT_EQ(changes[5]->serializedPayload.max_size, 256U);
+
+    std::vector<CacheChangePool::SizeClassStatistics> statistics = pool.get_size_class_statistics();
+    ASSERT_EQ(statistics.size(), 3U);
+    EXPECT_EQ(statistics[0].payload_size, 64U);
+    EXPECT_EQ(statistics[0].in_use, 2U);
+    EXPECT_EQ(statistics[1].payload_size, 128U);
+    EXPECT_EQ(statistics[1].in_use, 3U);
+    EXPECT_EQ(statistics[2].payload_size, 256U);
+    EXPECT_EQ(statistics[2].in_use, 1U);
+
+    // Three changes of the 128 bytes class are released, one of them over the high-water mark
+    pool.release_Cache(changes[2]);
+    pool.release_Cache(changes[3]);
+    pool.release_Cache(changes[4]);
+    EXPECT_EQ(pool.get_allCachesSize(), 5U);
+    EXPECT_EQ(pool.get_freeCachesSize(), 2U);
+
+    statistics = pool.get_size_class_statistics();
+    EXPECT_EQ(statistics[1].in_use, 0U);
+    EXPECT_EQ(statistics[1].free, 2U);
+    EXPECT_EQ(statistics[1].peak_in_use, 3U);
+    EXPECT_EQ(statistics[1].trimmed, 1U);
+
+    // A released change is reused for a payload of its class
+    CacheChange_t* ch = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 120U));
+    EXPECT_TRUE(ch == changes[2] || ch == changes[3] || ch == changes[4]);
+    EXPECT_EQ(pool.get_allCachesSize(), 5U);
+    EXPECT_EQ(pool.get_freeCachesSize(), 1U);
+    pool.release_Cache(ch);
+
+    pool.trim();
+    EXPECT_EQ(pool.get_allCachesSize(), 3U);
+    EXPECT_EQ(pool.get_freeCachesSize(), 0U);
+
+    pool.release_Cache(changes[0]);
+    pool.release_Cache(changes[1]);
+    pool.release_Cache(changes[5]);
+    EXPECT_EQ(pool.get_allCachesSize(), 3U);
+    EXPECT_EQ(pool.get_freeCachesSize(), 3U);
+}
+
+TEST(CacheChangePoolSlabTests, max_pool_size)
+{
+    CacheChangePool pool(0, 128, 2, MemoryManagementPolicy_t::DYNAMIC_SLAB_MEMORY_MODE);
+
+    CacheChange_t* ch1 = nullptr;
+    CacheChange_t* ch2 = nullptr;
+    CacheChange_t* ch3 = nullptr;
+    CacheChange_t* ch4 = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&ch1, 10U));
+    ASSERT_TRUE(pool.reserve_Cache(&ch2, 1000U));
+    ASSERT_TRUE(pool.reserve_Cache(&ch3, 100U));
+    ASSERT_FALSE(pool.reserve_Cache(&ch4, 100U));
+
+    // The pool is full, but a free change of the same class can be reused
+    pool.release_Cache(ch3);
+    ASSERT_TRUE(pool.reserve_Cache(&ch4, 100U));
+    EXPECT_EQ(ch3, ch4);
+
+    pool.release_Cache(ch1);
+    pool.release_Cache(ch2);
+    pool.release_Cache(ch4);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -274,7 +370,8 @@ GTEST_INSTANTIATE_TEST_MACRO(
     Values(MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
     MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
     MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
-    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE))
+    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE,
+    MemoryManagementPolicy_t::DYNAMIC_SLAB_MEMORY_MODE))
     );
 
 int main(
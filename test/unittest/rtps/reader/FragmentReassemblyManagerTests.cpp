@@ -0,0 +1,288 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/reader/FragmentReassemblyManager.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+class FragmentReassemblyManagerTests : public ::testing::Test
+{
+protected:
+
+    static constexpr uint16_t fragment_size = 100;
+
+    FragmentReassemblyManagerTests()
+        : max_changes(10)
+    {
+        writer_guid.guidPrefix.value[0] = 1;
+        writer_guid.entityId.value[3] = 2;
+    }
+
+    ~FragmentReassemblyManagerTests()
+    {
+        for (CacheChange_t* change : in_use)
+        {
+            delete change;
+        }
+    }
+
+    std::unique_ptr<FragmentReassemblyManager> create_manager(
+            uint32_t max_bytes)
+    {
+        return std::unique_ptr<FragmentReassemblyManager>(new FragmentReassemblyManager(max_bytes,
+                       [this](CacheChange_t** change, uint32_t size)
+                       {
+                           if (in_use.size() >= max_changes)
+                           {
+                               return false;
+                           }
+                           *change = new CacheChange_t(size);
+                           in_use.push_back(*change);
+                           return true;
+                       },
+                       [this](CacheChange_t* change)
+                       {
+                           in_use.erase(std::find(in_use.begin(), in_use.end(), change));
+                           delete change;
+                       }));
+    }
+
+    // Build the DATA_FRAG of a sample with the fragments [first, first + count), numbered from 1.
+    void fill_fragments(
+            CacheChange_t& change,
+            const SequenceNumber_t& sn,
+            uint32_t sample_size,
+            uint32_t first,
+            uint16_t count)
+    {
+        change.writerGUID = writer_guid;
+        change.sequenceNumber = sn;
+        change.setFragmentSize(fragment_size);
+        change.serializedPayload.length = 0;
+        for (uint32_t pos = (first - 1) * fragment_size;
+                pos < (first - 1 + count) * fragment_size && pos < sample_size;
+                ++pos)
+        {
+            change.serializedPayload.data[change.serializedPayload.length++] = static_cast<octet>(pos);
+        }
+    }
+
+    CacheChange_t* send(
+            FragmentReassemblyManager& manager,
+            const SequenceNumber_t& sn,
+            uint32_t sample_size,
+            uint32_t first,
+            uint16_t count)
+    {
+        CacheChange_t incoming(fragment_size * count);
+        fill_fragments(incoming, sn, sample_size, first, count);
+        return manager.process_fragments(&incoming, sample_size, first, count);
+    }
+
+    static bool check_payload(
+            const CacheChange_t* change,
+            uint32_t sample_size)
+    {
+        if (change->serializedPayload.length != sample_size)
+        {
+            return false;
+        }
+        for (uint32_t pos = 0; pos < sample_size; ++pos)
+        {
+            if (change->serializedPayload.data[pos] != static_cast<octet>(pos))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    GUID_t writer_guid;
+    size_t max_changes;
+    std::vector<CacheChange_t*> in_use;
+};
+
+constexpr uint16_t FragmentReassemblyManagerTests::fragment_size;
+
+TEST_F(FragmentReassemblyManagerTests, InOrderReassembly)
+{
+    auto manager = create_manager(0);
+    const uint32_t sample_size = 950;
+    SequenceNumber_t sn(0, 1);
+
+    for (uint32_t frag = 1; frag < 10; ++frag)
+    {
+        EXPECT_EQ(nullptr, send(*manager, sn, sample_size, frag, 1));
+        EXPECT_EQ(1u, manager->size());
+        EXPECT_EQ(sample_size, manager->bytes_in_use());
+    }
+
+    CacheChange_t* change = send(*manager, sn, sample_size, 10, 1);
+    ASSERT_NE(nullptr, change);
+    EXPECT_TRUE(change->is_fully_assembled());
+    EXPECT_EQ(sn, change->sequenceNumber);
+    EXPECT_TRUE(check_payload(change, sample_size));
+    EXPECT_EQ(0u, manager->size());
+    EXPECT_EQ(0u, manager->bytes_in_use());
+
+    // The change is still reserved, now owned by the caller
+    EXPECT_EQ(1u, in_use.size());
+}
+
+TEST_F(FragmentReassemblyManagerTests, OutOfOrderAndDuplicates)
+{
+    auto manager = create_manager(0);
+    const uint32_t sample_size = 1000;
+    SequenceNumber_t sn(0, 1);
+
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 7, 4));
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 3, 2));
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 3, 2));
+
+    FragmentNumberSet_t missing;
+    ASSERT_TRUE(manager->get_missing_fragments(writer_guid, sn, missing));
+    EXPECT_EQ(1u, missing.base());
+    std::vector<FragmentNumber_t> expected = {1, 2, 5, 6};
+    std::vector<FragmentNumber_t> result;
+    missing.for_each([&result](FragmentNumber_t n)
+            {
+                result.push_back(n);
+            });
+    EXPECT_EQ(expected, result);
+
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 1, 2));
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 6, 1));
+    CacheChange_t* change = send(*manager, sn, sample_size, 5, 1);
+    ASSERT_NE(nullptr, change);
+    EXPECT_TRUE(check_payload(change, sample_size));
+    EXPECT_FALSE(manager->get_missing_fragments(writer_guid, sn, missing));
+}
+
+TEST_F(FragmentReassemblyManagerTests, InvalidFragments)
+{
+    auto manager = create_manager(0);
+    const uint32_t sample_size = 500;
+    SequenceNumber_t sn(0, 1);
+
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 0, 1));
+    EXPECT_EQ(0u, manager->size());
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 5, 2));
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 6, 1));
+
+    // Fragments of a different sample size are ignored
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size, 1, 4));
+    EXPECT_EQ(nullptr, send(*manager, sn, sample_size * 2, 5, 1));
+    CacheChange_t* change = send(*manager, sn, sample_size, 5, 1);
+    ASSERT_NE(nullptr, change);
+    EXPECT_TRUE(check_payload(change, sample_size));
+}
+
+TEST_F(FragmentReassemblyManagerTests, ByteBudgetEvictsLeastRecentlyUsed)
+{
+    const uint32_t sample_size = 1000;
+    auto manager = create_manager(sample_size * 2);
+
+    SequenceNumber_t sn1(0, 1);
+    SequenceNumber_t sn2(0, 2);
+    SequenceNumber_t sn3(0, 3);
+
+    EXPECT_EQ(nullptr, send(*manager, sn1, sample_size, 1, 1));
+    EXPECT_EQ(nullptr, send(*manager, sn2, sample_size, 1, 1));
+    // Sample 1 is now the most recently updated
+    EXPECT_EQ(nullptr, send(*manager, sn1, sample_size, 2, 1));
+    EXPECT_EQ(2u, manager->size());
+
+    // Sample 3 does not fit. Sample 2 should be evicted
+    EXPECT_EQ(nullptr, send(*manager, sn3, sample_size, 1, 1));
+    EXPECT_EQ(2u, manager->size());
+    EXPECT_EQ(1u, manager->evicted_count());
+    EXPECT_EQ(2u * sample_size, manager->bytes_in_use());
+    EXPECT_EQ(2u, in_use.size());
+
+    FragmentNumberSet_t missing;
+    EXPECT_TRUE(manager->get_missing_fragments(writer_guid, sn1, missing));
+    EXPECT_FALSE(manager->get_missing_fragments(writer_guid, sn2, missing));
+    EXPECT_TRUE(manager->get_missing_fragments(writer_guid, sn3, missing));
+
+    // A sample bigger than the budget is accepted when alone
+    EXPECT_EQ(nullptr, send(*manager, SequenceNumber_t(0, 4), sample_size * 3, 1, 1));
+    EXPECT_EQ(1u, manager->size());
+    EXPECT_EQ(3u, manager->evicted_count());
+}
+
+TEST_F(FragmentReassemblyManagerTests, PoolExhaustedEvictsLeastRecentlyUsed)
+{
+    max_changes = 2;
+    auto manager = create_manager(0);
+    const uint32_t sample_size = 1000;
+
+    EXPECT_EQ(nullptr, send(*manager, SequenceNumber_t(0, 1), sample_size, 1, 1));
+    EXPECT_EQ(nullptr, send(*manager, SequenceNumber_t(0, 2), sample_size, 1, 1));
+    EXPECT_EQ(nullptr, send(*manager, SequenceNumber_t(0, 3), sample_size, 1, 1));
+    EXPECT_EQ(2u, manager->size());
+    EXPECT_EQ(1u, manager->evicted_count());
+
+    FragmentNumberSet_t missing;
+    EXPECT_FALSE(manager->get_missing_fragments(writer_guid, SequenceNumber_t(0, 1), missing));
+}
+
+TEST_F(FragmentReassemblyManagerTests, Discard)
+{
+    auto manager = create_manager(0);
+    const uint32_t sample_size = 1000;
+
+    for (uint32_t n = 1; n <= 5; ++n)
+    {
+        EXPECT_EQ(nullptr, send(*manager, SequenceNumber_t(0, n), sample_size, 1, 1));
+    }
+    EXPECT_EQ(5u, manager->size());
+
+    manager->discard_until(writer_guid, SequenceNumber_t(0, 3));
+    EXPECT_EQ(3u, manager->size());
+    EXPECT_EQ(3u, in_use.size());
+
+    manager->discard_sample(writer_guid, SequenceNumber_t(0, 4));
+    EXPECT_EQ(2u, manager->size());
+    EXPECT_EQ(2u * sample_size, manager->bytes_in_use());
+
+    GUID_t other_writer = writer_guid;
+    other_writer.entityId.value[3] = 3;
+    manager->discard_writer(other_writer);
+    EXPECT_EQ(2u, manager->size());
+
+    manager->discard_writer(writer_guid);
+    EXPECT_EQ(0u, manager->size());
+    EXPECT_EQ(0u, manager->bytes_in_use());
+    EXPECT_EQ(0u, manager->evicted_count());
+    EXPECT_TRUE(in_use.empty());
+
+    // Destruction releases what is left
+    EXPECT_EQ(nullptr, send(*manager, SequenceNumber_t(0, 6), sample_size, 1, 1));
+    manager.reset();
+    EXPECT_TRUE(in_use.empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -478,6 +478,56 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that removing writers which are not the timer owner keeps the rest of them expiring in order
+TEST_F(LivelinessManagerTests, WritersRemovedWhileAlive)
+{
+    LivelinessManager liveliness_manager(
+                std::bind(&LivelinessManagerTests::liveliness_changed,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3,
+                          std::placeholders::_4,
+                          std::placeholders::_5),
+                service_);
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+    auto lease = [](uint32_t i)
+            {
+                return Duration_t(i * 0.1);
+            };
+
+    for (uint32_t i = 1; i <= 6; ++i)
+    {
+        liveliness_manager.add_writer(GUID_t(guidP, i), MANUAL_BY_TOPIC_LIVELINESS_QOS, lease(i));
+    }
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+
+    for (uint32_t i = 6; i >= 1; --i)
+    {
+        EXPECT_TRUE(liveliness_manager.assert_liveliness(GUID_t(guidP, i), MANUAL_BY_TOPIC_LIVELINESS_QOS, lease(i)));
+    }
+    wait_liveliness_recovered(6u);
+    EXPECT_TRUE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+
+    // Remove alive writers that are not the timer owner, including the last one added
+    EXPECT_TRUE(liveliness_manager.remove_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, lease(2)));
+    EXPECT_TRUE(liveliness_manager.remove_writer(GUID_t(guidP, 6), MANUAL_BY_TOPIC_LIVELINESS_QOS, lease(6)));
+    EXPECT_FALSE(liveliness_manager.remove_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, lease(2)));
+    EXPECT_EQ(liveliness_manager.get_liveliness_data().size(), 4u);
+
+    wait_liveliness_lost(1u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 1));
+    wait_liveliness_lost(2u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 3));
+    wait_liveliness_lost(3u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 4));
+    wait_liveliness_lost(4u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 5));
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+}
+
 }
 }
 
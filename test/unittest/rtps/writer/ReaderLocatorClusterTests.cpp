@@ -0,0 +1,238 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/writer/ReaderLocator.h>
+#include <fastdds/rtps/writer/ReaderLocatorCluster.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ReaderLocatorClusterTests : public ::testing::Test
+{
+protected:
+
+    ReaderLocatorClusterTests()
+        : readers_(ResourceLimitedContainerConfig::fixed_size_configuration(8u))
+    {
+    }
+
+    static ResourceLimitedVector<Locator_t> locators(
+            std::initializer_list<uint32_t> ports)
+    {
+        ResourceLimitedVector<Locator_t> ret_val;
+        for (uint32_t port : ports)
+        {
+            ret_val.emplace_back(LOCATOR_KIND_UDPv4, port);
+        }
+        return ret_val;
+    }
+
+    static GUID_t reader_guid(
+            octet participant,
+            octet reader)
+    {
+        GUID_t guid;
+        guid.guidPrefix.value[0] = participant;
+        guid.entityId.value[2] = reader;
+        guid.entityId.value[3] = 0x04;
+        return guid;
+    }
+
+    ReaderLocator& add_reader(
+            const GUID_t& guid,
+            const ResourceLimitedVector<Locator_t>& unicast,
+            const ResourceLimitedVector<Locator_t>& multicast)
+    {
+        ReaderLocator* reader = readers_.emplace_back(nullptr, 4u, 4u);
+        EXPECT_TRUE(reader->start(guid, unicast, multicast, false));
+        return *reader;
+    }
+
+    //! Same steps StatelessWriter::matched_reader_remove follows
+    void remove_reader(
+            const GUID_t& guid)
+    {
+        bool found = false;
+        for (ReaderLocator& reader : readers_)
+        {
+            found |= reader.stop(guid);
+        }
+        EXPECT_TRUE(found);
+        build();
+    }
+
+    void build()
+    {
+        ReaderLocatorCluster::build_clusters(nullptr, readers_, clusters_);
+    }
+
+    const ReaderLocatorCluster* cluster_of(
+            const GUID_t& guid) const
+    {
+        for (const ReaderLocatorCluster& cluster : clusters_)
+        {
+            const std::vector<GUID_t>& guids = cluster.remote_guids();
+            if (std::find(guids.begin(), guids.end(), guid) != guids.end())
+            {
+                return &cluster;
+            }
+        }
+        return nullptr;
+    }
+
+    ResourceLimitedVector<ReaderLocator> readers_;
+
+    std::vector<ReaderLocatorCluster> clusters_;
+};
+
+TEST_F(ReaderLocatorClusterTests, locators_match_regardless_of_order)
+{
+    ReaderLocatorCluster cluster(nullptr, locators({7400, 7401, 7402}));
+    EXPECT_TRUE(cluster.has_destinations(locators({7400, 7401, 7402})));
+    EXPECT_TRUE(cluster.has_destinations(locators({7402, 7400, 7401})));
+    EXPECT_FALSE(cluster.has_destinations(locators({7400, 7401})));
+    EXPECT_FALSE(cluster.has_destinations(locators({7400, 7401, 7403})));
+    EXPECT_FALSE(cluster.has_destinations(locators({})));
+
+    GUID_t first = reader_guid(1, 1);
+    GUID_t second = reader_guid(1, 2);
+    GUID_t third = reader_guid(1, 3);
+    add_reader(first, locators({7400, 7401}), locators({}));
+    add_reader(second, locators({7401, 7400}), locators({}));
+    add_reader(third, locators({7400}), locators({}));
+    build();
+
+    ASSERT_EQ(clusters_.size(), 2u);
+    ASSERT_NE(cluster_of(first), nullptr);
+    EXPECT_EQ(cluster_of(first), cluster_of(second));
+    EXPECT_EQ(cluster_of(first)->size(), 2u);
+    EXPECT_NE(cluster_of(first), cluster_of(third));
+    EXPECT_EQ(cluster_of(third)->size(), 1u);
+}
+
+TEST_F(ReaderLocatorClusterTests, unicast_preferred_over_multicast)
+{
+    GUID_t with_unicast = reader_guid(1, 1);
+    GUID_t only_multicast = reader_guid(2, 1);
+    GUID_t other_only_multicast = reader_guid(3, 1);
+    GUID_t other_with_unicast = reader_guid(4, 1);
+
+    ReaderLocator& reader = add_reader(with_unicast, locators({7410}), locators({7500}));
+    add_reader(only_multicast, locators({}), locators({7500}));
+    add_reader(other_only_multicast, locators({}), locators({7500}));
+    add_reader(other_with_unicast, locators({7411}), locators({7500}));
+
+    const ResourceLimitedVector<Locator_t>& destinations = ReaderLocatorCluster::destinations_of(reader);
+    ASSERT_EQ(destinations.size(), 1u);
+    EXPECT_EQ(destinations.at(0), Locator_t(LOCATOR_KIND_UDPv4, 7410));
+
+    build();
+
+    // Readers with unicast locators are not sent through the multicast group they share
+    ASSERT_EQ(clusters_.size(), 3u);
+    ASSERT_NE(cluster_of(with_unicast), nullptr);
+    EXPECT_TRUE(cluster_of(with_unicast)->has_destinations(locators({7410})));
+    EXPECT_EQ(cluster_of(with_unicast)->size(), 1u);
+    ASSERT_NE(cluster_of(other_with_unicast), nullptr);
+    EXPECT_TRUE(cluster_of(other_with_unicast)->has_destinations(locators({7411})));
+    EXPECT_EQ(cluster_of(other_with_unicast)->size(), 1u);
+
+    // Readers without unicast locators share the multicast group
+    ASSERT_NE(cluster_of(only_multicast), nullptr);
+    EXPECT_EQ(cluster_of(only_multicast), cluster_of(other_only_multicast));
+    EXPECT_TRUE(cluster_of(only_multicast)->has_destinations(locators({7500})));
+    EXPECT_EQ(cluster_of(only_multicast)->size(), 2u);
+}
+
+TEST_F(ReaderLocatorClusterTests, readers_of_several_participants)
+{
+    // Two readers of the same participant keep INFO_DST and their entity id
+    GUID_t first = reader_guid(1, 1);
+    GUID_t second = reader_guid(1, 2);
+    add_reader(first, locators({7400}), locators({}));
+    add_reader(second, locators({7400}), locators({}));
+    build();
+
+    ASSERT_EQ(clusters_.size(), 1u);
+    EXPECT_EQ(clusters_.front().destination_guid_prefix(), first.guidPrefix);
+    EXPECT_EQ(clusters_.front().remote_participants().size(), 1u);
+    EXPECT_EQ(clusters_.front().remote_guids().size(), 2u);
+
+    // A reader of another participant on the same locators joins the cluster. There is no single destination
+    // participant, so no INFO_DST is added, and the readers have different entity ids, so messages are sent to
+    // ENTITYID_UNKNOWN.
+    GUID_t third = reader_guid(2, 3);
+    add_reader(third, locators({7400}), locators({}));
+    build();
+
+    ASSERT_EQ(clusters_.size(), 1u);
+    const ReaderLocatorCluster& cluster = clusters_.front();
+    EXPECT_EQ(cluster.destination_guid_prefix(), c_GuidPrefix_Unknown);
+    ASSERT_EQ(cluster.remote_participants().size(), 2u);
+    EXPECT_NE(std::find(cluster.remote_participants().begin(), cluster.remote_participants().end(),
+            first.guidPrefix), cluster.remote_participants().end());
+    EXPECT_NE(std::find(cluster.remote_participants().begin(), cluster.remote_participants().end(),
+            third.guidPrefix), cluster.remote_participants().end());
+    ASSERT_EQ(cluster.remote_guids().size(), 3u);
+    EXPECT_NE(cluster.remote_guids()[0].entityId, cluster.remote_guids()[2].entityId);
+}
+
+TEST_F(ReaderLocatorClusterTests, rebuilt_on_reader_removal)
+{
+    GUID_t first = reader_guid(1, 1);
+    GUID_t second = reader_guid(2, 1);
+    GUID_t third = reader_guid(3, 1);
+    add_reader(first, locators({7400}), locators({}));
+    add_reader(second, locators({7400}), locators({}));
+    add_reader(third, locators({7401}), locators({}));
+    build();
+
+    ASSERT_EQ(clusters_.size(), 2u);
+    ASSERT_NE(cluster_of(first), nullptr);
+    EXPECT_EQ(cluster_of(first)->destination_guid_prefix(), c_GuidPrefix_Unknown);
+
+    // The remaining reader of the cluster is addressed on its own again
+    remove_reader(second);
+    ASSERT_EQ(clusters_.size(), 2u);
+    EXPECT_EQ(cluster_of(second), nullptr);
+    ASSERT_NE(cluster_of(first), nullptr);
+    EXPECT_EQ(cluster_of(first)->size(), 1u);
+    EXPECT_EQ(cluster_of(first)->destination_guid_prefix(), first.guidPrefix);
+
+    remove_reader(third);
+    ASSERT_EQ(clusters_.size(), 1u);
+    EXPECT_EQ(cluster_of(third), nullptr);
+
+    remove_reader(first);
+    EXPECT_TRUE(clusters_.empty());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
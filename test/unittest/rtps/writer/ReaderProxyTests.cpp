@@ -133,6 +133,35 @@ TEST(ReaderProxyTests, are_there_gaps)
     ASSERT_FALSE(rproxy.are_there_gaps());
 }
 
+TEST(ReaderProxyTests, perform_acknack_response_collects_requested)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    for (uint32_t n = 1; n <= 4; ++n)
+    {
+        ChangeForReader_t change(SequenceNumber_t(0, n));
+        change.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change, false);
+    }
+
+    SequenceNumberSet_t requested(SequenceNumber_t(0, 1));
+    requested.add(SequenceNumber_t(0, 1));
+    requested.add(SequenceNumber_t(0, 3));
+    ASSERT_TRUE(rproxy.requested_changes_set(requested));
+
+    std::vector<SequenceNumber_t> sequence_numbers;
+    ASSERT_TRUE(rproxy.perform_acknack_response(&sequence_numbers));
+    std::vector<SequenceNumber_t> expected = { SequenceNumber_t(0, 1), SequenceNumber_t(0, 3) };
+    ASSERT_EQ(expected, sequence_numbers);
+
+    // Nothing else requested
+    ASSERT_FALSE(rproxy.perform_acknack_response(&sequence_numbers));
+    ASSERT_EQ(expected, sequence_numbers);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -0,0 +1,149 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <statistics/StatisticsRegistry.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::statistics;
+using eprosima::fastrtps::rtps::GUID_t;
+using eprosima::fastrtps::rtps::Time_t;
+
+TEST(StatisticsTests, Counters)
+{
+    GUID_t guid;
+    guid.entityId.value[3] = 3;
+    EntityStatisticsCounters counters(guid, StatisticsEntityKind::WRITER);
+
+    EntityStatistics statistics;
+    counters.snapshot(statistics);
+    EXPECT_EQ(guid, statistics.guid);
+    EXPECT_EQ(StatisticsEntityKind::WRITER, statistics.kind);
+    EXPECT_EQ(0u, statistics.data_sent);
+    EXPECT_EQ(0u, statistics.latency.count);
+
+    counters.add(StatisticsCounter::DATA_SENT);
+    counters.add(StatisticsCounter::DATA_SENT);
+    counters.add(StatisticsCounter::HEARTBEATS_SENT, 5);
+    counters.add(StatisticsCounter::DATA_RESENT, 0);
+    counters.snapshot(statistics);
+    EXPECT_EQ(2u, statistics.data_sent);
+    EXPECT_EQ(5u, statistics.heartbeats_sent);
+    EXPECT_EQ(0u, statistics.data_resent);
+    EXPECT_EQ(0u, statistics.gaps_sent);
+}
+
+TEST(StatisticsTests, LatencyHistogram)
+{
+    EntityStatisticsCounters counters(GUID_t(), StatisticsEntityKind::READER);
+
+    counters.add_latency(500);          // Below 1 us
+    counters.add_latency(1000);         // [1, 2) us
+    counters.add_latency(3000);         // [2, 4) us
+    counters.add_latency(3999);         // [2, 4) us
+    counters.add_latency(100000000000); // Way above the last bucket
+
+    // Negative latencies are ignored
+    Time_t source(10, 0u);
+    Time_t reception(9, 0u);
+    counters.add_latency(source, reception);
+    reception.seconds(10);
+    reception.nanosec(2000);
+    counters.add_latency(source, reception);
+
+    EntityStatistics statistics;
+    counters.snapshot(statistics);
+    EXPECT_EQ(6u, statistics.latency.count);
+    EXPECT_EQ(1u, statistics.latency.buckets[0]);
+    EXPECT_EQ(1u, statistics.latency.buckets[1]);
+    EXPECT_EQ(3u, statistics.latency.buckets[2]);  // Including the 2 us from the timestamps
+    EXPECT_EQ(1u, statistics.latency.buckets[LatencyHistogram::BUCKET_COUNT - 1]);
+    EXPECT_EQ(500u + 1000u + 3000u + 3999u + 100000000000u + 2000u, statistics.latency.total_ns);
+    EXPECT_EQ(100000000000u, statistics.latency.max_ns);
+}
+
+TEST(StatisticsTests, ConcurrentUpdates)
+{
+    EntityStatisticsCounters counters(GUID_t(), StatisticsEntityKind::PARTICIPANT);
+    constexpr size_t num_threads = 4;
+    constexpr uint64_t num_updates = 10000;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&counters]()
+                {
+                    for (uint64_t j = 0; j < num_updates; ++j)
+                    {
+                        counters.add(StatisticsCounter::MESSAGES_SENT);
+                        counters.add(StatisticsCounter::BYTES_SENT, 10);
+                        counters.add_latency(j);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EntityStatistics statistics;
+    counters.snapshot(statistics);
+    EXPECT_EQ(num_threads * num_updates, statistics.messages_sent);
+    EXPECT_EQ(num_threads * num_updates * 10, statistics.bytes_sent);
+    EXPECT_EQ(num_threads * num_updates, statistics.latency.count);
+    EXPECT_EQ(num_updates - 1, statistics.latency.max_ns);
+}
+
+TEST(StatisticsTests, Registry)
+{
+    StatisticsRegistry registry;
+    std::vector<EntityStatistics> statistics;
+    registry.snapshot(statistics);
+    EXPECT_TRUE(statistics.empty());
+
+    GUID_t participant_guid;
+    participant_guid.guidPrefix.value[0] = 1;
+    GUID_t reader_guid = participant_guid;
+    reader_guid.entityId.value[3] = 4;
+
+    EntityStatisticsCounters* participant = registry.register_entity(participant_guid,
+                    StatisticsEntityKind::PARTICIPANT);
+    EntityStatisticsCounters* reader = registry.register_entity(reader_guid, StatisticsEntityKind::READER);
+    ASSERT_NE(nullptr, participant);
+    ASSERT_NE(nullptr, reader);
+    reader->add(StatisticsCounter::DATA_RECEIVED, 3);
+
+    registry.snapshot(statistics);
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ(participant_guid, statistics[0].guid);
+    EXPECT_EQ(reader_guid, statistics[1].guid);
+    EXPECT_EQ(StatisticsEntityKind::READER, statistics[1].kind);
+    EXPECT_EQ(3u, statistics[1].data_received);
+
+    registry.unregister_entity(reader);
+    registry.snapshot(statistics);
+    ASSERT_EQ(1u, statistics.size());
+    EXPECT_EQ(participant_guid, statistics[0].guid);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -868,6 +868,61 @@ TEST_F(SHMTransportTests, send_and_receive_between_ports)
     sender_thread->join();
 }
 
+TEST_F(SHMTransportTests, busy_poll_send_and_receive_between_ports)
+{
+    SharedMemTransportDescriptor busy_poll_descriptor(descriptor);
+    busy_poll_descriptor.busy_poll_us(1000);
+    SharedMemTransport transportUnderTest(busy_poll_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    // Messages sent back to back are taken while spinning, and the spaced ones after the listener has parked
+    std::vector<std::chrono::microseconds> delays = {
+        std::chrono::microseconds(0), std::chrono::microseconds(10), std::chrono::microseconds(5000),
+        std::chrono::microseconds(0), std::chrono::microseconds(20000), std::chrono::microseconds(100)
+    };
+
+    for (const auto& delay : delays)
+    {
+        std::this_thread::sleep_for(delay);
+
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+
+        sem.wait();
+    }
+}
+
 TEST_F(SHMTransportTests, port_and_segment_overflow_discard)
 {
     SharedMemTransportDescriptor my_descriptor;
@@ -1611,6 +1666,46 @@ TEST_F(SHMTransportTests, buffer_recover)
     thread_listener2.join();
 }
 
+TEST_F(SHMTransportTests, buffer_slabs)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    // Room for 4 slabs, but only 3 buffers allowed
+    auto segment = shared_mem_manager->create_segment(4 * 64, 3, 64);
+
+    auto timeout = std::chrono::milliseconds(100);
+
+    // Buffers bigger than a slab are rejected
+    ASSERT_THROW(segment->alloc_buffer(65, std::chrono::steady_clock::now() + timeout), std::runtime_error);
+
+    std::vector<std::shared_ptr<SharedMemManager::Buffer>> buffers;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        buffers.push_back(segment->alloc_buffer(1 + i, std::chrono::steady_clock::now() + timeout));
+        ASSERT_EQ(1 + i, buffers.back()->size());
+        memset(buffers.back()->data(), static_cast<int>(i), buffers.back()->size());
+    }
+
+    // Each buffer owns a different slab
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        for (uint32_t j = i + 1; j < 3; j++)
+        {
+            auto distance = std::abs(static_cast<uint8_t*>(buffers[i]->data()) -
+                            static_cast<uint8_t*>(buffers[j]->data()));
+            ASSERT_GE(distance, 64);
+        }
+    }
+
+    // Releasing a buffer gives its slab back
+    void* released_data = buffers.front()->data();
+    buffers.erase(buffers.begin());
+    auto buffer = segment->alloc_buffer(64, std::chrono::steady_clock::now() + timeout);
+    ASSERT_EQ(released_data, buffer->data());
+}
+
 TEST_F(SHMTransportTests, remote_segments_free)
 {
     const std::string domain_name("SHMTests");
@@ -21,6 +21,7 @@
 #include <fastrtps/utils/IPLocator.h>
 //#include <fastdds/dds/log/Log.hpp>
 #include <memory>
+#include <vector>
 #include <asio.hpp>
 #include <MockReceiverResource.h>
 
@@ -181,6 +182,65 @@ TEST_F(UDPv4Tests, send_and_receive_between_ports)
     sem.wait();
 }
 
+TEST_F(UDPv4Tests, send_gather_list)
+{
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t multicastLocator;
+    multicastLocator.port = g_default_port;
+    multicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicastLocator, 239, 255, 0, 1);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+
+    MockReceiverResource receiver(transportUnderTest, multicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(send_resource_list.at(0)->supports_gather());
+
+    // The datagram should be the concatenation of all the buffers
+    octet header[2] = { 'H', 'e' };
+    octet payload[2] = { 'l', 'l' };
+    octet tail[1] = { 'o' };
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::vector<NetworkBuffer> buffers;
+    buffers.emplace_back(header, 2);
+    buffers.emplace_back(payload, 2);
+    buffers.emplace_back(tail, 1);
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    auto sendThreadFunction = [&]()
+            {
+                LocatorList_t locator_list;
+                locator_list.push_back(multicastLocator);
+
+                Locators locators_begin(locator_list.begin());
+                Locators locators_end(locator_list.end());
+
+                EXPECT_TRUE(send_resource_list.at(0)->send(buffers, 5, &locators_begin, &locators_end,
+                        (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+            };
+
+    senderThread.reset(new std::thread(sendThreadFunction));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    senderThread->join();
+    sem.wait();
+}
+
 TEST_F(UDPv4Tests, send_to_loopback)
 {
     UDPv4Transport transportUnderTest(descriptor);
@@ -629,6 +689,74 @@ TEST_F(UDPv4Tests, open_a_blocked_socket)
     }
 }
 
+// Several threads sending through the same send resource, as done by the participant
+TEST_F(UDPv4Tests, concurrent_send)
+{
+    const size_t sample_size = 1024;
+    const int num_threads = 4;
+    const int num_samples_per_thread = 1000;
+
+    std::atomic<int> samples_received(0);
+
+    octet sample_data[sample_size];
+    memset(sample_data, 0, sizeof(sample_data));
+
+    Locator_t sub_locator;
+    sub_locator.kind = LOCATOR_KIND_UDPv4;
+    sub_locator.port = g_default_port + 2;
+    IPLocator::setIPv4(sub_locator, 127, 0, 0, 1);
+
+    UDPv4TransportDescriptor my_descriptor;
+
+    UDPv4Transport sub_transport(my_descriptor);
+    ASSERT_TRUE(sub_transport.init());
+
+    MockReceiverResource sub_receiver(sub_transport, sub_locator);
+    MockMessageReceiver* sub_msg_recv = dynamic_cast<MockMessageReceiver*>(sub_receiver.CreateMessageReceiver());
+
+    std::function<void()> sub_callback = [&]()
+            {
+                samples_received.fetch_add(1);
+            };
+
+    sub_msg_recv->setCallback(sub_callback);
+
+    UDPv4Transport pub_transport(my_descriptor);
+    ASSERT_TRUE(pub_transport.init());
+
+    LocatorList_t send_locators_list;
+    send_locators_list.push_back(sub_locator);
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(pub_transport.OpenOutputChannel(send_resource_list, sub_locator));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    for (int i = 0; i < num_samples_per_thread; i++)
+                    {
+                        Locators locators_begin(send_locators_list.begin());
+                        Locators locators_end(send_locators_list.end());
+
+                        EXPECT_TRUE(send_resource_list.at(0)->send(sample_data, sizeof(sample_data),
+                                &locators_begin, &locators_end,
+                                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Datagrams may be dropped on the receiving side, but some of them should arrive
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_GT(samples_received.load(), 0);
+}
+
 TEST_F(UDPv4Tests, simple_throughput)
 {
     const size_t sample_size = 1024;
@@ -0,0 +1,124 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/collections/lock_free_ring.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+TEST(LockFreeRingTests, capacity_is_power_of_two)
+{
+    LockFreeRing<int> uut_small(1);
+    ASSERT_EQ(uut_small.capacity(), 2u);
+
+    LockFreeRing<int> uut(17);
+    ASSERT_EQ(uut.capacity(), 32u);
+}
+
+TEST(LockFreeRingTests, fifo_until_full)
+{
+    LockFreeRing<int> uut(8);
+    int value = 0;
+
+    // Should be empty
+    ASSERT_FALSE(uut.pop(value));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(uut.push(i));
+    }
+
+    // Should be full
+    ASSERT_FALSE(uut.push(8));
+    ASSERT_EQ(uut.size_approx(), 8u);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(uut.pop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(uut.pop(value));
+    ASSERT_EQ(uut.size_approx(), 0u);
+
+    // Positions should wrap around
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(uut.push(i));
+        ASSERT_TRUE(uut.pop(value));
+        ASSERT_EQ(value, i);
+    }
+}
+
+TEST(LockFreeRingTests, concurrent_producers_and_consumers)
+{
+    constexpr size_t num_threads = 4;
+    constexpr size_t num_items = 20000;
+
+    LockFreeRing<size_t> uut(64);
+    std::atomic<size_t> consumed(0);
+    std::atomic<size_t> sum(0);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&uut, t]()
+                {
+                    for (size_t i = t; i < num_items; i += num_threads)
+                    {
+                        while (!uut.push(i + 1))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+        threads.emplace_back([&uut, &consumed, &sum]()
+                {
+                    size_t value = 0;
+                    while (consumed.load() < num_items)
+                    {
+                        if (uut.pop(value))
+                        {
+                            sum += value;
+                            ++consumed;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every item should have been consumed exactly once
+    ASSERT_EQ(consumed.load(), num_items);
+    ASSERT_EQ(sum.load(), num_items * (num_items + 1) / 2);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
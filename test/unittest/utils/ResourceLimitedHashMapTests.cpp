@@ -0,0 +1,248 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/collections/ResourceLimitedHashMap.hpp>
+#include <fastrtps/utils/collections/ResourceLimitedHashSet.hpp>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace eprosima::fastrtps;
+
+constexpr size_t NUM_ITEMS = 32;
+
+// Hash with a lot of collisions, to check probing and removal on long clusters
+struct BadHash
+{
+    size_t operator ()(
+            uint32_t value) const
+    {
+        return value % 3;
+    }
+
+};
+
+TEST(ResourceLimitedHashMapTests, default_constructor)
+{
+    ResourceLimitedHashMap<uint32_t, std::string> uut;
+
+    // Should be empty and non-allocated
+    ASSERT_TRUE(uut.empty());
+    ASSERT_EQ(uut.capacity(), 0u);
+    ASSERT_EQ(uut.find(1u), uut.end());
+
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        auto ret = uut.try_emplace(i, std::to_string(i));
+        ASSERT_TRUE(ret.second);
+        ASSERT_EQ(ret.first->first, i);
+    }
+    ASSERT_EQ(uut.size(), NUM_ITEMS);
+
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        auto it = uut.find(i);
+        ASSERT_NE(it, uut.end());
+        ASSERT_EQ(it->second, std::to_string(i));
+
+        // Duplicated keys are not inserted
+        auto ret = uut.try_emplace(i, "other");
+        ASSERT_FALSE(ret.second);
+        ASSERT_EQ(ret.first, it);
+    }
+
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        ASSERT_EQ(uut.erase(i), 1u);
+        ASSERT_EQ(uut.erase(i), 0u);
+        ASSERT_EQ(uut.count(i), 0u);
+    }
+    ASSERT_TRUE(uut.empty());
+}
+
+TEST(ResourceLimitedHashMapTests, preallocated)
+{
+    ResourceLimitedContainerConfig cfg(NUM_ITEMS);
+    ResourceLimitedHashMap<uint32_t, uint32_t> uut(cfg);
+    ASSERT_EQ(uut.capacity(), NUM_ITEMS);
+
+    // No reallocation happens while the initial capacity is not exceeded
+    const auto* first = &(*uut.try_emplace(0u, 0u).first);
+    for (uint32_t i = 1; i < NUM_ITEMS; ++i)
+    {
+        ASSERT_TRUE(uut.insert({ i, i }).second);
+    }
+    ASSERT_EQ(uut.capacity(), NUM_ITEMS);
+    ASSERT_EQ(first, &(*uut.begin()));
+
+    // Clearing keeps the memory
+    uut.clear();
+    ASSERT_TRUE(uut.empty());
+    ASSERT_EQ(uut.capacity(), NUM_ITEMS);
+    ASSERT_EQ(uut.find(1u), uut.end());
+
+    // Growing is allowed with the default maximum
+    for (uint32_t i = 0; i <= NUM_ITEMS; ++i)
+    {
+        ASSERT_TRUE(uut.insert({ i, i }).second);
+    }
+    ASSERT_GT(uut.capacity(), NUM_ITEMS);
+    for (uint32_t i = 0; i <= NUM_ITEMS; ++i)
+    {
+        ASSERT_EQ(uut.find(i)->second, i);
+    }
+}
+
+TEST(ResourceLimitedHashMapTests, limits)
+{
+    ResourceLimitedHashMap<uint32_t, uint32_t> uut(ResourceLimitedContainerConfig::fixed_size_configuration(
+                NUM_ITEMS));
+
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        ASSERT_TRUE(uut.insert_or_assign(i, i).second);
+    }
+
+    // No more elements can be added
+    auto ret = uut.insert_or_assign(NUM_ITEMS, NUM_ITEMS);
+    ASSERT_FALSE(ret.second);
+    ASSERT_EQ(ret.first, uut.end());
+    ASSERT_EQ(uut.size(), NUM_ITEMS);
+
+    // But existing ones can be assigned
+    ret = uut.insert_or_assign(1u, 100u);
+    ASSERT_FALSE(ret.second);
+    ASSERT_EQ(ret.first->second, 100u);
+
+    // And removing one makes room for a new one
+    ASSERT_EQ(uut.erase(1u), 1u);
+    ASSERT_TRUE(uut.insert_or_assign(NUM_ITEMS, NUM_ITEMS).second);
+    ASSERT_EQ(uut.capacity(), NUM_ITEMS);
+}
+
+TEST(ResourceLimitedHashMapTests, erase_while_iterating)
+{
+    ResourceLimitedContainerConfig cfg(NUM_ITEMS);
+    ResourceLimitedHashMap<uint32_t, uint32_t, BadHash> uut(cfg);
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        uut.insert({ i, i });
+    }
+
+    // Remove the even keys
+    for (auto it = uut.begin(); it != uut.end();)
+    {
+        if (it->first % 2 == 0)
+        {
+            it = uut.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    ASSERT_EQ(uut.size(), NUM_ITEMS / 2);
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        ASSERT_EQ(uut.count(i), i % 2);
+    }
+}
+
+TEST(ResourceLimitedHashMapTests, random_operations)
+{
+    // Compare against std::unordered_map on a random sequence of operations
+    ResourceLimitedHashMap<uint32_t, uint32_t, BadHash> collisions;
+    ResourceLimitedContainerConfig cfg(16u, 512u, 16u);
+    ResourceLimitedHashMap<uint32_t, uint32_t> uut(cfg);
+    std::unordered_map<uint32_t, uint32_t> reference;
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> keys(0, 255);
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        uint32_t key = keys(gen);
+        if (gen() % 3 == 0)
+        {
+            size_t erased = reference.erase(key);
+            ASSERT_EQ(uut.erase(key), erased);
+            ASSERT_EQ(collisions.erase(key), erased);
+        }
+        else
+        {
+            bool inserted = reference.emplace(key, i).second;
+            ASSERT_EQ(uut.try_emplace(key, i).second, inserted);
+            ASSERT_EQ(collisions.try_emplace(key, i).second, inserted);
+        }
+
+        ASSERT_EQ(uut.size(), reference.size());
+        ASSERT_EQ(collisions.size(), reference.size());
+    }
+
+    for (const auto& pair : reference)
+    {
+        ASSERT_EQ(uut.find(pair.first)->second, pair.second);
+        ASSERT_EQ(collisions.find(pair.first)->second, pair.second);
+    }
+
+    // Copies are independent
+    ResourceLimitedContainerConfig copy_cfg(1u);
+    ResourceLimitedHashMap<uint32_t, uint32_t> copy(copy_cfg);
+    copy = uut;
+    uut.clear();
+    ASSERT_EQ(copy.size(), reference.size());
+    for (const auto& pair : reference)
+    {
+        ASSERT_EQ(copy.find(pair.first)->second, pair.second);
+    }
+}
+
+TEST(ResourceLimitedHashSetTests, insert_find_erase)
+{
+    ResourceLimitedHashSet<uint32_t> uut(ResourceLimitedContainerConfig::fixed_size_configuration(NUM_ITEMS));
+
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        ASSERT_TRUE(uut.insert(i * 7).second);
+        ASSERT_FALSE(uut.insert(i * 7).second);
+    }
+    ASSERT_FALSE(uut.insert(1u).second);
+    ASSERT_EQ(uut.size(), NUM_ITEMS);
+
+    uint32_t sum = 0;
+    for (uint32_t value : uut)
+    {
+        sum += value;
+    }
+    ASSERT_EQ(sum, 7u * NUM_ITEMS * (NUM_ITEMS - 1) / 2);
+
+    for (uint32_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        auto it = uut.find(i * 7);
+        ASSERT_NE(it, uut.end());
+        uut.erase(it);
+        ASSERT_EQ(uut.count(i * 7), 0u);
+    }
+    ASSERT_TRUE(uut.empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
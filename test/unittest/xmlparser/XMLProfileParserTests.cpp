@@ -19,6 +19,7 @@
 #include <fastrtps/transport/TCPTransportDescriptor.h>
 #include <fastrtps/transport/UDPTransportDescriptor.h>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <rtps/xmlparser/XMLProfileCache.hpp>
 #include <tinyxml2.h>
 #include <gtest/gtest.h>
 #include <memory>
@@ -26,6 +27,8 @@
 #include <chrono>
 #include <sstream>
 #include <fstream>
+#include <cstdio>
+#include <cstdlib>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -202,6 +205,14 @@ TEST_F(XMLProfileParserTests, XMLParserParcipant)
     EXPECT_EQ(rtps_atts.throughputController.periodMillisecs, 45u);
     EXPECT_EQ(rtps_atts.useBuiltinTransports, true);
     EXPECT_EQ(std::string(rtps_atts.getName()), "test_name");
+    EXPECT_EQ(rtps_atts.timed_events_thread.scheduling_policy, 0);
+    EXPECT_EQ(rtps_atts.timed_events_thread.priority, 0);
+    EXPECT_EQ(rtps_atts.timed_events_thread.affinity, 3u);
+    EXPECT_EQ(rtps_atts.timed_events_thread.stack_size, 1048576);
+    EXPECT_EQ(rtps_atts.async_writer_thread.scheduling_policy, -1);
+    EXPECT_EQ(rtps_atts.async_writer_thread.priority, -5);
+    EXPECT_EQ(rtps_atts.async_writer_thread.affinity, 12u);
+    EXPECT_EQ(rtps_atts.async_writer_thread.stack_size, -1);
 }
 
 TEST_F(XMLProfileParserTests, XMLParserDefaultParcipantProfile)
@@ -787,7 +798,12 @@ TEST_F(XMLProfileParserTests, SHM_transport_descriptors_config)
     ASSERT_EQ(descriptor->segment_size(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->port_queue_capacity(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->healthy_check_timeout_ms(), std::numeric_limits<uint32_t>::max());
+    ASSERT_EQ(descriptor->busy_poll_us(), std::numeric_limits<uint32_t>::max());
+    ASSERT_EQ(descriptor->buffer_slab_size(), std::numeric_limits<uint32_t>::max());
+    ASSERT_TRUE(descriptor->huge_pages());
     ASSERT_EQ(descriptor->rtps_dump_file(), "test_file.dump");
+    ASSERT_EQ(descriptor->reception_threads.priority, 10);
+    ASSERT_EQ(descriptor->reception_threads.affinity, 0xF0u);
     ASSERT_EQ(descriptor->maxMessageSize, 128000u);
     ASSERT_EQ(descriptor->max_message_size(), 128000u);
 }
@@ -874,6 +890,100 @@ TEST_F(XMLProfileParserTests, extract_profiles_error)
     EXPECT_EQ(xmlparser::XMLP_ret::XML_ERROR, xmlparser::XMLProfileManager::loadXMLNode(xml_doc));
 }
 
+static void set_profiles_cache_directory(
+        const char* directory)
+{
+#ifdef _WIN32
+    _putenv_s("FASTRTPS_PROFILES_CACHE_DIRECTORY", nullptr != directory ? directory : "");
+#else
+    if (nullptr != directory)
+    {
+        setenv("FASTRTPS_PROFILES_CACHE_DIRECTORY", directory, 1);
+    }
+    else
+    {
+        unsetenv("FASTRTPS_PROFILES_CACHE_DIRECTORY");
+    }
+#endif // ifdef _WIN32
+}
+
+//! Tests that profiles loaded from the cache are equal to the parsed ones, and that a corrupt cache file
+//! falls back to parsing the XML file.
+TEST_F(XMLProfileParserTests, profiles_cache)
+{
+    std::string contents;
+    ASSERT_TRUE(xmlparser::XMLProfileCache::read_file("test_xml_profiles.xml", contents));
+    std::string cache_file = xmlparser::XMLProfileCache::cache_file(".", contents);
+    std::remove(cache_file.c_str());
+
+    ParticipantAttributes participant_atts;
+    PublisherAttributes publisher_atts;
+    SubscriberAttributes subscriber_atts;
+    ASSERT_EQ(xmlparser::XMLP_ret::XML_OK, xmlparser::XMLProfileManager::loadXMLFile("test_xml_profiles.xml"));
+    ASSERT_EQ(xmlparser::XMLP_ret::XML_OK,
+            xmlparser::XMLProfileManager::fillParticipantAttributes("test_participant_profile", participant_atts));
+    ASSERT_EQ(xmlparser::XMLP_ret::XML_OK,
+            xmlparser::XMLProfileManager::fillPublisherAttributes("test_publisher_profile", publisher_atts));
+    ASSERT_EQ(xmlparser::XMLP_ret::XML_OK,
+            xmlparser::XMLProfileManager::fillSubscriberAttributes("test_subscriber_profile", subscriber_atts));
+
+    set_profiles_cache_directory(".");
+
+    // First load parses the file and stores the cache file
+    xmlparser::XMLProfileManager::DeleteInstance();
+    ASSERT_EQ(xmlparser::XMLP_ret::XML_OK, xmlparser::XMLProfileManager::loadXMLFile("test_xml_profiles.xml"));
+    std::ifstream cache_stream(cache_file);
+    EXPECT_TRUE(cache_stream.good());
+    cache_stream.close();
+
+    // Second load uses the cache file
+    for (int i = 0; i < 2; ++i)
+    {
+        xmlparser::XMLProfileManager::DeleteInstance();
+        ASSERT_EQ(xmlparser::XMLP_ret::XML_OK, xmlparser::XMLProfileManager::loadXMLFile("test_xml_profiles.xml"));
+
+        ParticipantAttributes cached_participant_atts;
+        PublisherAttributes cached_publisher_atts;
+        SubscriberAttributes cached_subscriber_atts;
+        ASSERT_EQ(xmlparser::XMLP_ret::XML_OK,
+                xmlparser::XMLProfileManager::fillParticipantAttributes("test_participant_profile",
+                cached_participant_atts));
+        ASSERT_EQ(xmlparser::XMLP_ret::XML_OK,
+                xmlparser::XMLProfileManager::fillPublisherAttributes("test_publisher_profile",
+                cached_publisher_atts));
+        ASSERT_EQ(xmlparser::XMLP_ret::XML_OK,
+                xmlparser::XMLProfileManager::fillSubscriberAttributes("test_subscriber_profile",
+                cached_subscriber_atts));
+
+        const RTPSParticipantAttributes& rtps = participant_atts.rtps;
+        const RTPSParticipantAttributes& cached_rtps = cached_participant_atts.rtps;
+        EXPECT_EQ(participant_atts.domainId, cached_participant_atts.domainId);
+        EXPECT_EQ(std::string(rtps.getName()), std::string(cached_rtps.getName()));
+        EXPECT_EQ(rtps.defaultUnicastLocatorList, cached_rtps.defaultUnicastLocatorList);
+        EXPECT_EQ(rtps.defaultMulticastLocatorList, cached_rtps.defaultMulticastLocatorList);
+        EXPECT_EQ(rtps.prefix, cached_rtps.prefix);
+        EXPECT_EQ(rtps.builtin.discovery_config.leaseDuration, cached_rtps.builtin.discovery_config.leaseDuration);
+        EXPECT_EQ(rtps.port.portBase, cached_rtps.port.portBase);
+        EXPECT_EQ(rtps.userData, cached_rtps.userData);
+        EXPECT_EQ(rtps.participantID, cached_rtps.participantID);
+        EXPECT_EQ(rtps.throughputController, cached_rtps.throughputController);
+        EXPECT_EQ(rtps.allocation.participants.initial, cached_rtps.allocation.participants.initial);
+        EXPECT_EQ(rtps.timed_events_thread, cached_rtps.timed_events_thread);
+        EXPECT_EQ(rtps.async_writer_thread, cached_rtps.async_writer_thread);
+        EXPECT_TRUE(publisher_atts == cached_publisher_atts);
+        EXPECT_TRUE(subscriber_atts == cached_subscriber_atts);
+        EXPECT_EQ(xmlparser::XMLProfileManager::library_settings().intraprocess_delivery,
+                IntraprocessDeliveryType::INTRAPROCESS_FULL);
+
+        // Corrupt the cache file, so the next iteration parses the file again
+        std::ofstream corrupt(cache_file, std::ios::binary | std::ios::trunc);
+        corrupt << "corrupt";
+    }
+
+    set_profiles_cache_directory(nullptr);
+    std::remove(cache_file.c_str());
+}
+
 int main(
         int argc,
         char** argv)